@@ -0,0 +1,18 @@
+/*
+===========================================================================
+  VGLX https://vglx.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#pragma once
+
+#include <benchmark/benchmark.h>
+
+#include "scene_helpers.hpp"
+
+#include <cstdint>
+
+// Node counts from 1k to 1M for scene-scale benchmarks.
+constexpr auto kMinNodes = int64_t {1} << 10;
+constexpr auto kMaxNodes = int64_t {1} << 20;
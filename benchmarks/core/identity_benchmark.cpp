@@ -0,0 +1,52 @@
+/*
+===========================================================================
+  VGLX https://vglx.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#include <benchmark/benchmark.h>
+
+#include <vglx/geometries/geometry.hpp>
+#include <vglx/materials/unlit_material.hpp>
+#include <vglx/nodes/node.hpp>
+
+#include <memory>
+#include <vector>
+
+namespace {
+
+// Creates `count` objects per iteration. Destruction is not measured.
+template <typename Factory>
+auto create_bulk(benchmark::State& state, Factory factory) {
+    using Object = decltype(factory());
+    auto objects = std::vector<Object> {};
+    objects.reserve(state.range(0));
+    for (auto _ : state) {
+        for (auto i = 0; i < state.range(0); ++i) {
+            objects.emplace_back(factory());
+        }
+        state.PauseTiming();
+        objects.clear();
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+}
+
+static void BM_Identity_CreateNodes(benchmark::State& state) {
+    create_bulk(state, [] { return vglx::Node::Create(); });
+}
+
+static void BM_Identity_CreateGeometries(benchmark::State& state) {
+    create_bulk(state, [] { return vglx::Geometry::Create(); });
+}
+
+static void BM_Identity_CreateMaterials(benchmark::State& state) {
+    create_bulk(state, [] { return vglx::UnlitMaterial::Create(); });
+}
+
+BENCHMARK(BM_Identity_CreateNodes)->RangeMultiplier(10)->Range(1'000, 100'000);
+BENCHMARK(BM_Identity_CreateGeometries)->RangeMultiplier(10)->Range(1'000, 100'000);
+BENCHMARK(BM_Identity_CreateMaterials)->RangeMultiplier(10)->Range(1'000, 100'000);
\ No newline at end of file
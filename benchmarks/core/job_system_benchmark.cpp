@@ -0,0 +1,73 @@
+/*
+===========================================================================
+  VGLX https://vglx.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#include <benchmark/benchmark.h>
+
+#include <vglx/core/job_system.hpp>
+
+#include <atomic>
+#include <cmath>
+#include <vector>
+
+static void BM_JobSystem_ScheduleEmptyJobs(benchmark::State& state) {
+    auto jobs = vglx::JobSystem {vglx::JobSystem::DefaultWorkerCount()};
+    const auto count = state.range(0);
+
+    for (auto _ : state) {
+        auto counter = vglx::JobCounter {};
+        for (auto i = 0; i < count; ++i) {
+            jobs.Schedule([] {}, &counter);
+        }
+        jobs.Wait(counter);
+    }
+
+    state.SetItemsProcessed(state.iterations() * count);
+}
+
+static void BM_JobSystem_NestedJobs(benchmark::State& state) {
+    auto jobs = vglx::JobSystem {vglx::JobSystem::DefaultWorkerCount()};
+    auto sink = std::atomic<int> {0};
+
+    for (auto _ : state) {
+        auto outer = vglx::JobCounter {};
+        for (auto i = 0; i < 16; ++i) {
+            jobs.Schedule([&] {
+                auto inner = vglx::JobCounter {};
+                for (auto j = 0; j < 64; ++j) {
+                    jobs.Schedule([&sink] { sink.fetch_add(1, std::memory_order_relaxed); }, &inner);
+                }
+                jobs.Wait(inner);
+            }, &outer);
+        }
+        jobs.Wait(outer);
+    }
+
+    state.SetItemsProcessed(state.iterations() * 16 * 64);
+}
+
+static void BM_JobSystem_ParallelFor(benchmark::State& state) {
+    auto jobs = vglx::JobSystem {static_cast<unsigned>(state.range(1))};
+    auto values = std::vector<float>(state.range(0), 1.0f);
+
+    for (auto _ : state) {
+        jobs.ParallelFor(values.size(), [&values](size_t begin, size_t end) {
+            for (auto i = begin; i < end; ++i) values[i] = std::sqrt(values[i] + 1.0f);
+        }, 1024);
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(BM_JobSystem_ScheduleEmptyJobs)->Arg(64)->Arg(1024)->UseRealTime();
+BENCHMARK(BM_JobSystem_NestedJobs)->UseRealTime();
+BENCHMARK(BM_JobSystem_ParallelFor)
+    ->Args({1 << 20, 0})
+    ->Args({1 << 20, 1})
+    ->Args({1 << 20, 3})
+    ->Args({1 << 20, 7})
+    ->UseRealTime();
\ No newline at end of file
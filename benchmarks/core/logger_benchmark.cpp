@@ -0,0 +1,118 @@
+/*
+===========================================================================
+  VGLX https://vglx.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#include <benchmark/benchmark.h>
+
+#include <vglx/utilities/timer.hpp>
+
+#include <utilities/logger.hpp>
+
+#include <chrono>
+#include <format>
+#include <iostream>
+#include <mutex>
+#include <streambuf>
+
+namespace {
+
+// Discards everything written to it, so the benchmarks measure the logging
+// path rather than the terminal.
+class NullBuffer : public std::streambuf {
+protected:
+    auto overflow(int c) -> int override { return c; }
+    auto xsputn(const char*, std::streamsize n) -> std::streamsize override { return n; }
+};
+
+NullBuffer null_buffer;
+std::streambuf* saved_buffer {nullptr};
+
+auto silence_output(const benchmark::State& state) {
+    if (state.thread_index() != 0) return;
+    saved_buffer = std::cout.rdbuf(&null_buffer);
+}
+
+auto restore_output(const benchmark::State& state) {
+    if (state.thread_index() != 0) return;
+    vglx::Logger::Flush();
+    std::cout.rdbuf(saved_buffer);
+}
+
+// Mirrors the previous implementation: a global lock, a local time stamp
+// and a synchronous write on the calling thread.
+std::mutex sync_mutex;
+
+auto log_sync(std::string_view message, int value) {
+    const auto lock = std::scoped_lock(sync_mutex);
+    std::cout << std::format(
+        "[{}]{}: {} {} -> {}:{}\n",
+        vglx::Timer::GetTimestamp(),
+        "[Info]",
+        message,
+        value,
+        "logger_benchmark.cpp",
+        __LINE__
+    );
+}
+
+}
+
+static void BM_Logger_Synchronous(benchmark::State& state) {
+    silence_output(state);
+
+    auto i = 0;
+    for (auto _ : state) {
+        log_sync("frame", i++);
+    }
+
+    restore_output(state);
+    state.SetItemsProcessed(state.iterations());
+}
+
+static void BM_Logger_Asynchronous(benchmark::State& state) {
+    silence_output(state);
+    const auto dropped = vglx::Logger::DroppedMessages();
+
+    auto i = 0;
+    for (auto _ : state) {
+        vglx::Logger::Log(vglx::LogLevel::Info, "frame {}", i++);
+    }
+
+    restore_output(state);
+    state.SetItemsProcessed(state.iterations());
+    if (state.thread_index() == 0) {
+        state.counters["dropped"] = static_cast<double>(vglx::Logger::DroppedMessages() - dropped);
+    }
+}
+
+static void BM_Logger_RateLimited(benchmark::State& state) {
+    silence_output(state);
+
+    auto i = 0;
+    for (auto _ : state) {
+        VGLX_LOG_EVERY(std::chrono::seconds(1), vglx::LogLevel::Error, "frame {}", i++);
+    }
+
+    restore_output(state);
+    state.SetItemsProcessed(state.iterations());
+}
+
+// Only meaningful when Debug messages are compiled out.
+#if VGLX_LOG_LEVEL < 3
+static void BM_Logger_CompiledOut(benchmark::State& state) {
+    auto i = 0;
+    for (auto _ : state) {
+        VGLX_LOG(vglx::LogLevel::Debug, "frame {}", i++);
+        benchmark::DoNotOptimize(i);
+    }
+}
+
+BENCHMARK(BM_Logger_CompiledOut);
+#endif
+
+BENCHMARK(BM_Logger_Synchronous)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK(BM_Logger_Asynchronous)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK(BM_Logger_RateLimited)->ThreadRange(1, 8)->UseRealTime();
\ No newline at end of file
@@ -0,0 +1,92 @@
+/*
+===========================================================================
+  VGLX https://vglx.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#include "benchmark_helpers.hpp"
+
+#include "core/occlusion_buffer.hpp"
+
+#include <vglx/core/job_system.hpp>
+#include <vglx/math/box3.hpp>
+
+#include <optional>
+
+namespace {
+
+// Wall-like boxes spread in front of the camera, as in a street of
+// buildings. The meshes are owned by the returned scene.
+auto make_occluders(int64_t count) {
+    auto scene = vglx::Scene::Create();
+    auto geometry = vglx::BoxGeometry::Create({.width = 8.0f, .height = 6.0f, .depth = 1.0f});
+    auto material = vglx::UnlitMaterial::Create(0xFFFFFF);
+    auto random = std::mt19937 {42};
+    auto x = std::uniform_real_distribution<float> {-60.0f, 60.0f};
+    auto z = std::uniform_real_distribution<float> {-200.0f, -10.0f};
+
+    auto occluders = std::vector<vglx::Mesh*> {};
+    for (auto i = int64_t {0}; i < count; ++i) {
+        auto mesh = vglx::Mesh::Create(geometry, material);
+        mesh->occluder = true;
+        mesh->transform.SetPosition({x(random), 0.0f, z(random)});
+        occluders.emplace_back(mesh.get());
+        scene->Add(mesh);
+    }
+    scene->UpdateTransformHierarchy();
+    return std::pair {scene, occluders};
+}
+
+}
+
+// Arguments are the occluder count and the number of workers.
+static void BM_OcclusionBuffer_Rasterize(benchmark::State& state) {
+    const auto [scene, occluders] = make_occluders(state.range(0));
+    const auto camera = make_camera();
+    auto jobs = std::optional<vglx::JobSystem> {};
+    if (state.range(1)) jobs.emplace(static_cast<unsigned>(state.range(1)));
+    auto buffer = vglx::OcclusionBuffer {};
+
+    for (auto _ : state) {
+        buffer.Rasterize(occluders, camera->projection_matrix * camera->view_matrix, jobs ? &*jobs : nullptr);
+        benchmark::ClobberMemory();
+    }
+
+    state.counters["triangles"] = static_cast<double>(buffer.TriangleCount());
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void BM_OcclusionBuffer_IsOccluded(benchmark::State& state) {
+    const auto [scene, occluders] = make_occluders(64);
+    const auto camera = make_camera();
+    auto buffer = vglx::OcclusionBuffer {};
+    buffer.Rasterize(occluders, camera->projection_matrix * camera->view_matrix);
+
+    auto random = std::mt19937 {7};
+    auto x = std::uniform_real_distribution<float> {-100.0f, 100.0f};
+    auto z = std::uniform_real_distribution<float> {-300.0f, -5.0f};
+    auto boxes = std::vector<vglx::Box3> {};
+    for (auto i = 0; i < 4096; ++i) {
+        const auto center = vglx::Vector3 {x(random), 0.0f, z(random)};
+        boxes.emplace_back(center - vglx::Vector3 {1.0f}, center + vglx::Vector3 {1.0f});
+    }
+
+    auto occluded = size_t {0};
+    for (auto _ : state) {
+        occluded = 0;
+        for (const auto& box : boxes) {
+            occluded += buffer.IsOccluded(box);
+        }
+        benchmark::DoNotOptimize(occluded);
+    }
+
+    state.counters["occluded"] = static_cast<double>(occluded);
+    state.SetItemsProcessed(state.iterations() * boxes.size());
+}
+
+BENCHMARK(BM_OcclusionBuffer_Rasterize)
+    ->ArgsProduct({{16, 64, 256}, {0, 3}})
+    ->Unit(benchmark::kMicrosecond)
+    ->UseRealTime();
+BENCHMARK(BM_OcclusionBuffer_IsOccluded);
\ No newline at end of file
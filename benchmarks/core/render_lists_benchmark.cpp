@@ -0,0 +1,70 @@
+/*
+===========================================================================
+  VGLX https://vglx.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#include "benchmark_helpers.hpp"
+
+#include "core/render_lists.hpp"
+
+#include <vglx/core/job_system.hpp>
+
+static void BM_RenderLists_ProcessScene(benchmark::State& state) {
+    auto scene = make_scene(state.range(0), state.range(1));
+    auto camera = make_camera();
+    auto render_lists = vglx::RenderLists {};
+
+    for (auto _ : state) {
+        render_lists.ProcessScene(scene.get(), camera.get());
+        benchmark::DoNotOptimize(render_lists.Opaque().data());
+    }
+
+    state.counters["visible"] = static_cast<double>(render_lists.Opaque().size());
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void BM_RenderLists_Collect(benchmark::State& state) {
+    auto scene = make_scene(state.range(0), state.range(1));
+    auto camera = make_camera();
+    auto render_lists = vglx::RenderLists {};
+
+    for (auto _ : state) {
+        render_lists.Collect(scene.get(), camera.get());
+        benchmark::DoNotOptimize(render_lists.Opaque().data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void BM_RenderLists_CollectParallel(benchmark::State& state) {
+    auto scene = make_scene(state.range(0), state.range(1));
+    auto camera = make_camera();
+    auto jobs = vglx::JobSystem {static_cast<unsigned>(state.range(2))};
+    auto render_lists = vglx::RenderLists {};
+    render_lists.SetJobSystem(&jobs);
+    render_lists.Collect(scene.get(), camera.get());
+
+    for (auto _ : state) {
+        render_lists.Collect(scene.get(), camera.get());
+        benchmark::DoNotOptimize(render_lists.Opaque().data());
+    }
+
+    state.counters["visible"] = static_cast<double>(render_lists.Opaque().size());
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Arguments are the mesh count and the fanout, where zero is a flat scene.
+BENCHMARK(BM_RenderLists_ProcessScene)
+    ->ArgsProduct({benchmark::CreateRange(kMinNodes, kMaxNodes, 32), {0, 8}})
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_RenderLists_Collect)
+    ->ArgsProduct({benchmark::CreateRange(kMinNodes, kMaxNodes, 32), {0, 8}})
+    ->Unit(benchmark::kMicrosecond);
+
+// Arguments are the mesh count, the fanout and the number of workers.
+BENCHMARK(BM_RenderLists_CollectParallel)
+    ->ArgsProduct({{200'000}, {0, 8}, {0, 1, 3, 7}})
+    ->Unit(benchmark::kMicrosecond)
+    ->UseRealTime();
\ No newline at end of file
@@ -0,0 +1,65 @@
+/*
+===========================================================================
+  VGLX https://vglx.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#include "benchmark_helpers.hpp"
+
+#include <vglx/core/renderer.hpp>
+
+namespace {
+
+// The null backend records calls instead of issuing them, so these measure
+// the CPU side of rendering without a GPU or a context.
+auto make_renderer() {
+    return std::make_unique<vglx::Renderer>(vglx::Renderer::Parameters {
+        .framebuffer_width = 1920,
+        .framebuffer_height = 1080,
+        .clear_color = 0x000000,
+        .backend = vglx::Renderer::Backend::Null
+    });
+}
+
+}
+
+static void BM_Renderer_Render(benchmark::State& state) {
+    auto scene = make_scene(state.range(0), state.range(1));
+    auto camera = make_camera();
+    auto renderer = make_renderer();
+    // Upload buffers and build programs outside of the measured frames.
+    renderer->Render(scene.get(), camera.get());
+
+    for (auto _ : state) {
+        renderer->Render(scene.get(), camera.get());
+        benchmark::DoNotOptimize(renderer->GetCommandStream());
+    }
+
+    const auto stream = renderer->GetCommandStream();
+    state.counters["draws"] = static_cast<double>(stream->Count(vglx::RenderCommandType::Draw));
+    state.counters["commands"] = static_cast<double>(stream->Size());
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void BM_Renderer_Extract(benchmark::State& state) {
+    auto scene = make_scene(state.range(0), state.range(1));
+    auto camera = make_camera();
+    auto renderer = make_renderer();
+    renderer->Render(scene.get(), camera.get());
+
+    for (auto _ : state) {
+        renderer->Extract(scene.get(), camera.get());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Arguments are the mesh count and the fanout, where zero is a flat scene.
+BENCHMARK(BM_Renderer_Render)
+    ->ArgsProduct({benchmark::CreateRange(kMinNodes, kMaxNodes >> 4, 8), {0, 8}})
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_Renderer_Extract)
+    ->ArgsProduct({benchmark::CreateRange(kMinNodes, kMaxNodes >> 4, 8), {0, 8}})
+    ->Unit(benchmark::kMicrosecond);
\ No newline at end of file
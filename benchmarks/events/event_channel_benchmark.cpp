@@ -0,0 +1,67 @@
+/*
+===========================================================================
+  VGLX https://vglx.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#include <benchmark/benchmark.h>
+
+#include "events/event_channel.hpp"
+#include "events/event_dispatcher.hpp"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace {
+
+struct BenchmarkEvent : public vglx::Event {
+    int value {0};
+};
+
+}
+
+static void BM_EventDispatcher_Dispatch(benchmark::State& state) {
+    const auto name = std::string {"benchmark_event"};
+    auto sink = 0;
+    auto listeners = std::vector<std::shared_ptr<vglx::EventListener>> {};
+    for (auto i = 0; i < state.range(0); ++i) {
+        listeners.emplace_back(std::make_shared<vglx::EventListener>(
+            [&sink](vglx::Event* e) { sink += static_cast<BenchmarkEvent*>(e)->value; }
+        ));
+        vglx::EventDispatcher::Get().AddEventListener(name, listeners.back());
+    }
+
+    for (auto _ : state) {
+        auto event = std::make_unique<BenchmarkEvent>();
+        event->value = 1;
+        vglx::EventDispatcher::Get().Dispatch(name, std::move(event));
+    }
+
+    benchmark::DoNotOptimize(sink);
+    vglx::EventDispatcher::Get().RemoveEventListenersForEvent(name);
+    state.SetItemsProcessed(state.iterations());
+}
+
+static void BM_EventChannel_Dispatch(benchmark::State& state) {
+    auto& channel = vglx::EventChannel<BenchmarkEvent>::Get();
+    auto sink = 0;
+    auto ids = std::vector<vglx::ListenerId> {};
+    for (auto i = 0; i < state.range(0); ++i) {
+        ids.emplace_back(channel.Subscribe([&sink](BenchmarkEvent& e) { sink += e.value; }));
+    }
+
+    for (auto _ : state) {
+        auto event = BenchmarkEvent {};
+        event.value = 1;
+        channel.Dispatch(event);
+    }
+
+    benchmark::DoNotOptimize(sink);
+    for (auto id : ids) channel.Unsubscribe(id);
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_EventDispatcher_Dispatch)->Arg(1)->Arg(4)->Arg(32);
+BENCHMARK(BM_EventChannel_Dispatch)->Arg(1)->Arg(4)->Arg(32);
\ No newline at end of file
@@ -0,0 +1,29 @@
+/*
+===========================================================================
+  VGLX https://vglx.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#include <benchmark/benchmark.h>
+
+#include <vglx/geometries/sphere_geometry.hpp>
+#include <vglx/geometries/wireframe_geometry.hpp>
+
+static void BM_WireframeGeometry_Create(benchmark::State& state) {
+    const auto segments = static_cast<unsigned>(state.range(0));
+    const auto sphere = vglx::SphereGeometry::Create({
+        .width_segments = segments,
+        .height_segments = segments
+    });
+
+    for (auto _ : state) {
+        auto wireframe = vglx::WireframeGeometry::Create(sphere.get());
+        benchmark::DoNotOptimize(wireframe);
+    }
+
+    state.counters["triangles"] = static_cast<double>(sphere->IndexCount() / 3);
+    state.SetItemsProcessed(state.iterations() * sphere->IndexCount() / 3);
+}
+
+BENCHMARK(BM_WireframeGeometry_Create)->RangeMultiplier(4)->Range(16, 512)->Unit(benchmark::kMicrosecond);
\ No newline at end of file
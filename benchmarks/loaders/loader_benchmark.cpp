@@ -0,0 +1,135 @@
+/*
+===========================================================================
+  VGLX https://vglx.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#include <benchmark/benchmark.h>
+
+#include <vglx/asset_format.hpp>
+#include <vglx/loaders/mesh_loader.hpp>
+#include <vglx/loaders/texture_loader.hpp>
+
+#include <cstring>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+namespace {
+
+template <typename T>
+auto write_binary(std::ofstream& file, const T& value) {
+    file.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template <typename T>
+auto write_binary(std::ofstream& file, const std::vector<T>& values) {
+    file.write(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(T));
+}
+
+// Writes a single-mesh file with position, normal and UV attributes and no
+// materials, laid out the way the asset builder writes it. Files are reused
+// across runs, so their names include the format version.
+auto write_mesh(uint32_t vertex_count) {
+    const auto path = fs::temp_directory_path() / std::format(
+        "vglx_bench_v{}_{}.msh", VGLX_MSH_VER, vertex_count
+    );
+    if (fs::exists(path)) return path;
+
+    constexpr auto stride = uint32_t {8};
+    const auto index_count = vertex_count / 3 * 3;
+    auto vertices = std::vector<float>(static_cast<size_t>(vertex_count) * stride, 0.5f);
+    auto indices = std::vector<uint32_t>(index_count);
+    for (auto i = uint32_t {0}; i < index_count; ++i) indices[i] = i;
+
+    auto header = MeshHeader {
+        .magic = {'M', 'S', 'H', '0'},
+        .version = VGLX_MSH_VER,
+        .header_size = sizeof(MeshHeader),
+        .material_count = 0,
+        .mesh_count = 1
+    };
+
+    auto record = MeshRecord {
+        .vertex_count = vertex_count,
+        .index_count = index_count,
+        .vertex_stride = stride,
+        .material_index = 0,
+        .vertex_data_size = vertices.size() * sizeof(float),
+        .index_data_size = indices.size() * sizeof(uint32_t),
+        .vertex_flags = VertexAttr_HasPosition | VertexAttr_HasNormal | VertexAttr_HasUV
+    };
+    std::strncpy(record.name, "benchmark", sizeof(record.name) - 1);
+
+    auto file = std::ofstream {path, std::ios::binary};
+    write_binary(file, header);
+    write_binary(file, record);
+    write_binary(file, vertices);
+    write_binary(file, indices);
+    return path;
+}
+
+auto write_texture(uint32_t size) {
+    const auto path = fs::temp_directory_path() / std::format(
+        "vglx_bench_v{}_{}.tex", VGLX_TEX_VER, size
+    );
+    if (fs::exists(path)) return path;
+
+    const auto pixels = std::vector<uint8_t>(static_cast<size_t>(size) * size * 4, 0x7F);
+    auto header = TextureHeader {
+        .magic = {'T', 'E', 'X', '0'},
+        .version = VGLX_TEX_VER,
+        .header_size = sizeof(TextureHeader),
+        .width = size,
+        .height = size,
+        .format = TextureFormat_RGBA8,
+        .mip_levels = 1,
+        .pixel_data_size = pixels.size()
+    };
+
+    auto file = std::ofstream {path, std::ios::binary};
+    write_binary(file, header);
+    write_binary(file, pixels);
+    return path;
+}
+
+}
+
+static void BM_MeshLoader_Load(benchmark::State& state) {
+    const auto path = write_mesh(static_cast<uint32_t>(state.range(0)));
+    const auto loader = vglx::MeshLoader::Create();
+
+    for (auto _ : state) {
+        auto result = loader->Load(path);
+        if (!result) {
+            state.SkipWithError(result.error().c_str());
+            break;
+        }
+        benchmark::DoNotOptimize(result);
+    }
+
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(fs::file_size(path)));
+}
+
+static void BM_TextureLoader_Load(benchmark::State& state) {
+    const auto path = write_texture(static_cast<uint32_t>(state.range(0)));
+    const auto loader = vglx::TextureLoader::Create();
+
+    for (auto _ : state) {
+        auto result = loader->Load(path);
+        if (!result) {
+            state.SkipWithError(result.error().c_str());
+            break;
+        }
+        benchmark::DoNotOptimize(result);
+    }
+
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(fs::file_size(path)));
+}
+
+BENCHMARK(BM_MeshLoader_Load)->RangeMultiplier(32)->Range(1 << 10, 1 << 20)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_TextureLoader_Load)->RangeMultiplier(4)->Range(256, 4096)->Unit(benchmark::kMicrosecond);
\ No newline at end of file
@@ -0,0 +1,92 @@
+/*
+===========================================================================
+  VGLX https://vglx.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#include "benchmark_helpers.hpp"
+
+#include <vglx/math/box3.hpp>
+#include <vglx/math/frustum.hpp>
+#include <vglx/math/sphere.hpp>
+
+#include <random>
+#include <vector>
+
+namespace {
+
+auto make_frustum() {
+    const auto camera = make_camera();
+    return vglx::Frustum {camera->projection_matrix * camera->view_matrix};
+}
+
+auto make_centers(int64_t count) {
+    auto random = std::mt19937 {42};
+    auto value = std::uniform_real_distribution<float> {-100.0f, 100.0f};
+    auto centers = std::vector<vglx::Vector3> {};
+    centers.reserve(count);
+    for (auto i = int64_t {0}; i < count; ++i) {
+        centers.emplace_back(value(random), value(random), value(random));
+    }
+    return centers;
+}
+
+}
+
+static void BM_Frustum_SetWithViewProjection(benchmark::State& state) {
+    const auto camera = make_camera();
+    const auto view_projection = camera->projection_matrix * camera->view_matrix;
+    auto frustum = vglx::Frustum {};
+
+    for (auto _ : state) {
+        frustum.SetWithViewProjection(view_projection);
+        benchmark::DoNotOptimize(frustum);
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+static void BM_Frustum_IntersectsWithSphere(benchmark::State& state) {
+    const auto frustum = make_frustum();
+    auto spheres = std::vector<vglx::Sphere> {};
+    for (const auto& center : make_centers(state.range(0))) {
+        spheres.emplace_back(center, 1.0f);
+    }
+
+    auto visible = int64_t {0};
+    for (auto _ : state) {
+        visible = 0;
+        for (const auto& sphere : spheres) {
+            visible += frustum.IntersectsWithSphere(sphere);
+        }
+        benchmark::DoNotOptimize(visible);
+    }
+
+    state.counters["visible"] = static_cast<double>(visible);
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void BM_Frustum_IntersectsWithBox3(benchmark::State& state) {
+    const auto frustum = make_frustum();
+    auto boxes = std::vector<vglx::Box3> {};
+    for (const auto& center : make_centers(state.range(0))) {
+        boxes.emplace_back(center - vglx::Vector3 {1.0f}, center + vglx::Vector3 {1.0f});
+    }
+
+    auto visible = int64_t {0};
+    for (auto _ : state) {
+        visible = 0;
+        for (const auto& box : boxes) {
+            visible += frustum.IntersectsWithBox3(box);
+        }
+        benchmark::DoNotOptimize(visible);
+    }
+
+    state.counters["visible"] = static_cast<double>(visible);
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(BM_Frustum_SetWithViewProjection);
+BENCHMARK(BM_Frustum_IntersectsWithSphere)->RangeMultiplier(32)->Range(kMinNodes, kMaxNodes);
+BENCHMARK(BM_Frustum_IntersectsWithBox3)->RangeMultiplier(32)->Range(kMinNodes, kMaxNodes);
\ No newline at end of file
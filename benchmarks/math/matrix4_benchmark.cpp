@@ -0,0 +1,85 @@
+/*
+===========================================================================
+  VGLX https://vglx.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#include <benchmark/benchmark.h>
+
+#include <vglx/math/matrix4.hpp>
+#include <vglx/math/vector3.hpp>
+
+#include <random>
+#include <vector>
+
+namespace {
+
+auto make_matrices(int64_t count) {
+    auto random = std::mt19937 {42};
+    auto value = std::uniform_real_distribution<float> {-1.0f, 1.0f};
+    auto matrices = std::vector<vglx::Matrix4> {};
+    matrices.reserve(count);
+    for (auto i = int64_t {0}; i < count; ++i) {
+        // A translated rotation-scale matrix is always invertible.
+        matrices.emplace_back(
+            1.0f + value(random), value(random), value(random), value(random),
+            value(random), 1.0f + value(random), value(random), value(random),
+            value(random), value(random), 3.0f, value(random),
+            0.0f, 0.0f, 0.0f, 1.0f
+        );
+    }
+    return matrices;
+}
+
+}
+
+static void BM_Matrix4_Multiply(benchmark::State& state) {
+    const auto matrices = make_matrices(state.range(0));
+    auto results = std::vector<vglx::Matrix4>(matrices.size());
+
+    for (auto _ : state) {
+        for (auto i = size_t {1}; i < matrices.size(); ++i) {
+            results[i] = matrices[i - 1] * matrices[i];
+        }
+        benchmark::DoNotOptimize(results.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * (state.range(0) - 1));
+}
+
+static void BM_Matrix4_Inverse(benchmark::State& state) {
+    const auto matrices = make_matrices(state.range(0));
+    auto results = std::vector<vglx::Matrix4>(matrices.size());
+
+    for (auto _ : state) {
+        for (auto i = size_t {0}; i < matrices.size(); ++i) {
+            results[i] = vglx::Inverse(matrices[i]);
+        }
+        benchmark::DoNotOptimize(results.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void BM_Matrix4_TransformPoint(benchmark::State& state) {
+    const auto matrices = make_matrices(state.range(0));
+    auto results = std::vector<vglx::Vector3>(matrices.size());
+    const auto point = vglx::Vector3 {1.0f, 2.0f, 3.0f};
+
+    for (auto _ : state) {
+        for (auto i = size_t {0}; i < matrices.size(); ++i) {
+            results[i] = matrices[i] * point;
+        }
+        benchmark::DoNotOptimize(results.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(BM_Matrix4_Multiply)->RangeMultiplier(8)->Range(1 << 10, 1 << 16);
+BENCHMARK(BM_Matrix4_Inverse)->RangeMultiplier(8)->Range(1 << 10, 1 << 16);
+BENCHMARK(BM_Matrix4_TransformPoint)->RangeMultiplier(8)->Range(1 << 10, 1 << 16);
\ No newline at end of file
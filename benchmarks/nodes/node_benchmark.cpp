@@ -0,0 +1,33 @@
+/*
+===========================================================================
+  VGLX https://vglx.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#include <benchmark/benchmark.h>
+
+#include <vglx/nodes/node.hpp>
+
+#include <memory>
+#include <vector>
+
+static void BM_Node_IsChildDeepChain(benchmark::State& state) {
+    auto root = vglx::Node::Create();
+    auto current = root;
+    for (auto i = 0; i < state.range(0); ++i) {
+        // Wide siblings at every level make a breadth-first search expensive.
+        for (auto j = 0; j < 8; ++j) current->Add(vglx::Node::Create());
+        auto child = vglx::Node::Create();
+        current->Add(child);
+        current = child;
+    }
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(root->IsChild(current.get()));
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_Node_IsChildDeepChain)->Arg(8)->Arg(64)->Arg(512);
\ No newline at end of file
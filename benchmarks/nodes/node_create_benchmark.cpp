@@ -0,0 +1,64 @@
+/*
+===========================================================================
+  VGLX https://vglx.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#include <benchmark/benchmark.h>
+
+#include <vglx/geometries/box_geometry.hpp>
+#include <vglx/materials/unlit_material.hpp>
+#include <vglx/nodes/mesh.hpp>
+#include <vglx/nodes/node.hpp>
+
+#include <memory>
+#include <vector>
+
+// Each iteration creates a batch of nodes and destroys it, the pattern of
+// procedurally generated scenes that stream content in and out.
+
+static void BM_Node_CreateDestroy(benchmark::State& state) {
+    auto nodes = std::vector<std::shared_ptr<vglx::Node>> {};
+    nodes.reserve(state.range(0));
+    for (auto _ : state) {
+        for (auto i = 0; i < state.range(0); ++i) {
+            nodes.emplace_back(vglx::Node::Create());
+        }
+        nodes.clear();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void BM_Mesh_CreateDestroy(benchmark::State& state) {
+    auto geometry = vglx::BoxGeometry::Create();
+    auto material = vglx::UnlitMaterial::Create(0xFFFFFF);
+    auto meshes = std::vector<std::shared_ptr<vglx::Mesh>> {};
+    meshes.reserve(state.range(0));
+    for (auto _ : state) {
+        for (auto i = 0; i < state.range(0); ++i) {
+            meshes.emplace_back(vglx::Mesh::Create(geometry, material));
+        }
+        meshes.clear();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Creation through std::make_shared, for comparison with the pooled path.
+static void BM_Mesh_CreateDestroyMakeShared(benchmark::State& state) {
+    auto geometry = vglx::BoxGeometry::Create();
+    auto material = vglx::UnlitMaterial::Create(0xFFFFFF);
+    auto meshes = std::vector<std::shared_ptr<vglx::Mesh>> {};
+    meshes.reserve(state.range(0));
+    for (auto _ : state) {
+        for (auto i = 0; i < state.range(0); ++i) {
+            meshes.emplace_back(std::make_shared<vglx::Mesh>(geometry, material));
+        }
+        meshes.clear();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(BM_Node_CreateDestroy)->RangeMultiplier(10)->Range(1'000, 100'000);
+BENCHMARK(BM_Mesh_CreateDestroy)->RangeMultiplier(10)->Range(1'000, 100'000);
+BENCHMARK(BM_Mesh_CreateDestroyMakeShared)->RangeMultiplier(10)->Range(1'000, 100'000);
\ No newline at end of file
@@ -0,0 +1,60 @@
+/*
+===========================================================================
+  VGLX https://vglx.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#include <benchmark/benchmark.h>
+
+#include <vglx/nodes/node.hpp>
+#include <vglx/nodes/scene.hpp>
+
+#include <memory>
+#include <vector>
+
+namespace {
+
+auto make_nodes(int count) {
+    auto nodes = std::vector<std::shared_ptr<vglx::Node>> {};
+    nodes.reserve(count);
+    for (auto i = 0; i < count; ++i) {
+        nodes.emplace_back(vglx::Node::Create());
+    }
+    return nodes;
+}
+
+}
+
+static void BM_Scene_AddNodes(benchmark::State& state) {
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto scene = vglx::Scene::Create();
+        auto nodes = make_nodes(state.range(0));
+        state.ResumeTiming();
+
+        for (const auto& node : nodes) {
+            scene->Add(node);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void BM_Scene_AddNodesBatched(benchmark::State& state) {
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto scene = vglx::Scene::Create();
+        auto nodes = make_nodes(state.range(0));
+        state.ResumeTiming();
+
+        vglx::Node::BeginBatch();
+        for (const auto& node : nodes) {
+            scene->Add(node);
+        }
+        vglx::Node::CommitBatch();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(BM_Scene_AddNodes)->RangeMultiplier(10)->Range(1'000, 100'000);
+BENCHMARK(BM_Scene_AddNodesBatched)->RangeMultiplier(10)->Range(1'000, 100'000);
\ No newline at end of file
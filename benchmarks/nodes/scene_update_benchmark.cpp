@@ -0,0 +1,44 @@
+/*
+===========================================================================
+  VGLX https://vglx.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#include <benchmark/benchmark.h>
+
+#include <vglx/nodes/node.hpp>
+#include <vglx/nodes/scene.hpp>
+
+#include <memory>
+
+namespace {
+
+class Spinner : public vglx::Node {
+public:
+    auto OnUpdate(float delta) -> void override {
+        RotateY(delta);
+    }
+};
+
+}
+
+static void BM_Scene_Advance(benchmark::State& state) {
+    auto scene = vglx::Scene::Create();
+    for (auto i = 0; i < state.range(0); ++i) {
+        // One node in a hundred carries update logic, the rest are static.
+        if (i % 100 == 0) {
+            scene->Add(std::make_shared<Spinner>());
+        } else {
+            scene->Add(vglx::Node::Create());
+        }
+    }
+
+    for (auto _ : state) {
+        scene->Advance(0.016f);
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(BM_Scene_Advance)->Arg(1000)->Arg(10000)->Arg(100000);
\ No newline at end of file
@@ -0,0 +1,38 @@
+/*
+===========================================================================
+  VGLX https://vglx.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#include "benchmark_helpers.hpp"
+
+static void BM_Node_UpdateTransformHierarchyStatic(benchmark::State& state) {
+    auto scene = make_scene(state.range(0), state.range(1), /* meshes = */ false);
+
+    for (auto _ : state) {
+        scene->UpdateTransformHierarchy();
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void BM_Node_UpdateTransformHierarchyDirty(benchmark::State& state) {
+    auto scene = make_scene(state.range(0), state.range(1), /* meshes = */ false);
+
+    for (auto _ : state) {
+        // Moving the root invalidates every world transform below it.
+        scene->RotateY(0.001f);
+        scene->UpdateTransformHierarchy();
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Arguments are the leaf count and the fanout, where zero is a flat scene.
+BENCHMARK(BM_Node_UpdateTransformHierarchyStatic)
+    ->ArgsProduct({benchmark::CreateRange(kMinNodes, kMaxNodes, 32), {0, 8}})
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_Node_UpdateTransformHierarchyDirty)
+    ->ArgsProduct({benchmark::CreateRange(kMinNodes, kMaxNodes, 32), {0, 8}})
+    ->Unit(benchmark::kMicrosecond);
\ No newline at end of file
@@ -87,7 +87,7 @@ auto main() -> int {
         renderer.Render(examples.scene.get(), camera.get());
         window.EndUIFrame();
 
-        stats.AfterRender(renderer.RenderedObjectsPerFrame());
+        stats.AfterRender(renderer.RenderedObjectsPerFrame(), renderer.GetFrameProfile());
         window.SwapBuffers();
     }
 
@@ -0,0 +1,156 @@
+/*
+===========================================================================
+  VGLX https://vglx.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#include <vglx/vglx.hpp>
+
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <format>
+#include <iostream>
+
+using namespace vglx;
+
+constexpr auto kWidth = 512;
+constexpr auto kHeight = 512;
+constexpr auto kDefaultFrames = 500;
+constexpr auto kSaveInterval = 100;
+
+namespace {
+
+auto create_scene() {
+    auto scene = Scene::Create();
+
+    const auto geometry = SphereGeometry::Create({
+        .radius = 0.3f,
+        .width_segments = 32,
+        .height_segments = 32
+    });
+
+    for (auto x = -2; x <= 2; ++x) {
+        for (auto z = -2; z <= 2; ++z) {
+            auto mesh = Mesh::Create(geometry, PhongMaterial::Create(0xCCCCCC));
+            mesh->transform.Translate({x * 0.8f, 0.0f, z * 0.8f});
+            scene->Add(mesh);
+        }
+    }
+
+    scene->Add(AmbientLight::Create({
+        .color = 0xFFFFFF,
+        .intensity = 0.15f
+    }));
+
+    auto light = DirectionalLight::Create({
+        .color = 0xFFFFFF,
+        .intensity = 1.0f,
+        .target = nullptr
+    });
+    light->transform.Translate({2.0f, 2.0f, 2.0f});
+    scene->Add(light);
+
+    return scene;
+}
+
+}
+
+// Renders a fixed number of frames without a display, reads every frame back
+// asynchronously, and reports the throughput. Every 100th frame is written
+// to the output directory as a TGA image. When a capture file is given, the
+// renderer's commands are captured to it for capture_replay and
+// capture_summary.
+//
+// usage: examples_launcher_offscreen [frames] [output directory] [capture file]
+auto main(int argc, char** argv) -> int {
+    const auto frames = argc > 1 ? std::atoi(argv[1]) : kDefaultFrames;
+    const auto output = std::filesystem::path {argc > 2 ? argv[2] : "offscreen_frames"};
+    const auto capture = std::filesystem::path {argc > 3 ? argv[3] : ""};
+
+    auto offscreen_context = OffscreenContext {};
+    auto init_context = offscreen_context.Initialize();
+    if (!init_context) {
+        std::cerr << init_context.error() << '\n';
+        return 1;
+    }
+
+    auto renderer = Renderer {{
+        .framebuffer_width = kWidth,
+        .framebuffer_height = kHeight,
+        .clear_color = 0x444444,
+        .offscreen = true,
+        .capture_path = capture
+    }};
+    auto init_renderer = renderer.Initialize();
+    if (!init_renderer) {
+        std::cerr << init_renderer.error() << '\n';
+        return 1;
+    }
+
+    auto camera = PerspectiveCamera::Create({
+        .fov = math::DegToRad(60.0f),
+        .aspect = static_cast<float>(kWidth) / kHeight,
+        .near = 0.1f,
+        .far = 100.0f
+    });
+
+    auto context = SharedContext {
+        .camera = camera.get(),
+        .aspect_ratio = static_cast<float>(kWidth) / kHeight,
+        .framebuffer_width = kWidth,
+        .framebuffer_height = kHeight,
+        .window_width = kWidth,
+        .window_height = kHeight,
+        .texture_loader = TextureLoader::Create(),
+        .mesh_loader = MeshLoader::Create(),
+        .jobs = JobSystem::Create()
+    };
+
+    auto scene = create_scene();
+    scene->SetContext(&context);
+
+    std::filesystem::create_directories(output);
+
+    auto frames_read = 0;
+    auto checksum = uint64_t {0};
+    const auto on_frame = [&](const ReadbackImage& image) {
+        ++frames_read;
+        for (const auto value : image.pixels) checksum += value;
+    };
+
+    auto timer = Timer {true};
+
+    for (auto frame = 0; frame < frames; ++frame) {
+        const auto angle = math::two_pi * frame / frames;
+        camera->transform.SetPosition({
+            math::Sin(angle) * 4.0f,
+            2.0f,
+            math::Cos(angle) * 4.0f
+        });
+        camera->LookAt(Vector3::Zero());
+
+        scene->Advance(1.0f / 60.0f);
+        renderer.Render(scene.get(), camera.get());
+
+        if (frame % kSaveInterval == 0) {
+            renderer.ReadPixels(output / std::format("frame_{:04}.tga", frame));
+        }
+        renderer.ReadPixels(on_frame);
+    }
+
+    renderer.FlushReadbacks();
+
+    const auto seconds = timer.GetElapsedSeconds();
+    std::cout << std::format(
+        "Rendered {} frames at {}x{} in {:.2f} s ({:.1f} frames/s, {:.1f} MPixel/s), "
+        "read back {} frames, checksum {}\n",
+        frames, kWidth, kHeight, seconds,
+        frames / seconds,
+        static_cast<double>(frames) * kWidth * kHeight / seconds / 1e6,
+        frames_read, checksum
+    );
+
+    return 0;
+}
\ No newline at end of file
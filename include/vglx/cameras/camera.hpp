@@ -36,6 +36,9 @@ public:
     /**
      * @brief Sets @ref view_matrix to the inverse of the camera's world transform.
      *
+     * When the camera has an interpolated transform, the inverse of
+     * @ref Node::GetRenderTransform is used instead.
+     *
      * Called internally by the renderer before rendering a frame;
      * manual calls are rarely necessary.
      */
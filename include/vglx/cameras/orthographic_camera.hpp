@@ -93,7 +93,7 @@ public:
 
      */
     [[nodiscard]] static auto Create(const Parameters& params) -> std::shared_ptr<OrthographicCamera> {
-        return std::make_shared<OrthographicCamera>(params);
+        return MakePooled<OrthographicCamera>(params);
     }
 
     /**
@@ -74,7 +74,7 @@ public:
      */
     [[nodiscard]] static auto
     Create(const Parameters& params) -> std::shared_ptr<PerspectiveCamera> {
-        return std::make_shared<PerspectiveCamera>(params);
+        return MakePooled<PerspectiveCamera>(params);
     }
 
     /**
@@ -13,6 +13,10 @@
  */
 
 #include "vglx/core/application.hpp"
+#include "vglx/core/job_system.hpp"
+#include "vglx/core/object_pool.hpp"
+#include "vglx/core/offscreen_context.hpp"
+#include "vglx/core/render_capture.hpp"
 #include "vglx/core/renderer.hpp"
 #include "vglx/core/shared_context.hpp"
 #include "vglx/core/window.hpp"
\ No newline at end of file
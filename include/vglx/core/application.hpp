@@ -10,14 +10,21 @@
 #include "vglx_export.h"
 
 #include "vglx/cameras/camera.hpp"
+#include "vglx/core/renderer.hpp"
 #include "vglx/math/color.hpp"
 #include "vglx/nodes/scene.hpp"
 
+#include <expected>
+#include <filesystem>
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace vglx {
 
+class FrameTimer;
+class Stats;
+
 /**
  * @brief The runtime entry point for defining and launching an app.
  *
@@ -68,10 +75,55 @@ namespace vglx {
  * Calling @ref Start initializes the runtime, sets the active user scene and
  * camera, then runs the main loop while invoking @ref Update each frame.
  *
+ * When @ref Parameters::pipelined is set, the main loop captures each frame
+ * with @ref Renderer::Extract and then advances the scene for the next frame
+ * on the job system while the captured frame is submitted and presented.
+ * Input events and @ref Update still run on the main thread while the
+ * scene is idle. Node updates, however, may run on a worker thread and must
+ * not issue OpenGL calls or release GPU resources directly; hand that work
+ * to the main thread with @ref JobSystem::ScheduleOnMainThread.
+ *
+ * When @ref Parameters::fixed_timestep is set, the scene is advanced in
+ * steps of that duration instead of once per frame, driven by a
+ * @ref FixedTimestep. A frame runs as many steps as fit into the accumulated
+ * time, up to @ref Parameters::max_simulation_steps, and node transforms are
+ * interpolated between the last two simulation states before rendering, so
+ * motion stays smooth when rendering faster than the simulation. @ref Update
+ * still runs once per frame with the variable frame delta.
+ *
+ * For servers and CI, @ref Parameters::mode selects an offscreen mode that
+ * renders through an @ref OffscreenContext (falling back to a hidden window
+ * when EGL is unavailable), or a headless mode that creates neither a window
+ * nor an OpenGL context and runs each frame up to culling. Offscreen frames
+ * can be captured from @ref Update with @ref Renderer::ReadPixels. Combined
+ * with @ref Parameters::simulated_delta and @ref Parameters::frame_limit,
+ * this runs a deterministic number of frames and returns from @ref Start,
+ * after which @ref GetFrameTimings reports the CPU cost of every frame.
+ *
  * @ingroup CoreGroup
  */
 class VGLX_EXPORT Application {
 public:
+    /**
+     * @brief Selects how frames are produced and presented.
+     */
+    enum class Mode {
+        Windowed, ///< Visible window with an OpenGL context.
+        Offscreen, ///< No visible window; frames are rendered into an offscreen framebuffer.
+        Headless ///< No window and no OpenGL context; frames end after culling.
+    };
+
+    /**
+     * @brief CPU timings of a single frame.
+     */
+    struct FrameTiming {
+        float delta; ///< Time step passed to the frame, in seconds.
+        double update_ms; ///< Scene advance and @ref Update, in milliseconds.
+        double render_ms; ///< Rendering, or culling in headless mode, in milliseconds.
+        double frame_ms; ///< Whole frame including event polling and presentation, in milliseconds.
+        unsigned rendered_objects; ///< Number of objects that passed culling.
+    };
+
     /**
      * @brief Parameters for configuring an application object.
      *
@@ -87,6 +139,19 @@ public:
         int antialiasing {0}; ///< Antialiasing level (e.g., 4x MSAA).
         bool vsync {true}; ///< Enables vertical sync.
         bool show_stats {false}; ///< Show stats UI overlay.
+        bool pipelined {false}; ///< Simulate the next frame while the current one is submitted.
+        float fixed_timestep {0.0f}; ///< Simulation step in seconds, or zero to advance once per frame.
+        int max_simulation_steps {5}; ///< Maximum fixed simulation steps per frame.
+        Mode mode {Mode::Windowed}; ///< How frames are produced and presented.
+        int frame_limit {0}; ///< Number of frames to run before exiting, or zero to run until closed.
+        float simulated_delta {0.0f}; ///< Time step fed to every frame instead of wall-clock time, or zero.
+        bool gpu_material_timers {false}; ///< Time each draw on the GPU and group the results by shader program.
+        bool draw_phase_timers {false}; ///< Split the CPU time of each draw into program resolve, uniform upload and draw submit.
+        bool occlusion_culling {false}; ///< Skip renderables hidden behind meshes marked as @ref Mesh::occluder.
+        bool occlusion_debug_view {false}; ///< Draw the occlusion buffer over the bottom left corner of the frame.
+        bool occlusion_queries {false}; ///< Skip meshes with @ref Mesh::occlusion_query set while GPU occlusion queries find them hidden.
+        bool depth_prepass {false}; ///< Draw the depth of opaque meshes first, so that each pixel is shaded once.
+        std::filesystem::path capture_path {}; ///< File to capture the renderer's commands to, or empty to disable capture.
     };
 
     Application();
@@ -103,7 +168,9 @@ public:
      * @brief Starts the application loop.
      *
      * This method initializes the window, rendering context, and user scene
-     * and enters the main loop until the application exits.
+     * and enters the main loop until the application exits. If the window
+     * or the renderer cannot be initialized, the error is logged and the
+     * method returns without running any frames.
      */
     auto Start() -> void;
 
@@ -168,6 +235,19 @@ public:
      */
     [[nodiscard]] auto GetCamera() const -> Camera*;
 
+    /**
+     * @brief Returns the renderer, or nullptr in headless mode.
+     */
+    [[nodiscard]] auto GetRenderer() const -> Renderer*;
+
+    /**
+     * @brief Returns the timings of the frames run so far.
+     *
+     * Timings are only recorded when @ref Parameters::frame_limit is set, which
+     * bounds the memory they use. A summary is logged when the run completes.
+     */
+    [[nodiscard]] auto GetFrameTimings() const -> const std::vector<FrameTiming>&;
+
     /**
      * @brief Sets the active scene.
      *
@@ -191,7 +271,15 @@ private:
 
     bool show_stats_ = false;
 
-    auto Setup() -> void;
+    bool pipelined_ = false;
+
+    bool headless_ = false;
+
+    auto Setup() -> std::expected<void, std::string>;
+
+    auto RunPipelined(FrameTimer& frame_timer, Stats& stats) -> void;
+
+    auto RunHeadless(FrameTimer& frame_timer) -> void;
     /// @endcond
 };
 
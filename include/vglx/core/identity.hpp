@@ -7,26 +7,44 @@
 
 #pragma once
 
-#include "vglx/math/utilities.hpp"
+#include "vglx_export.h"
 
+#include <cstdint>
 #include <string>
 #include <string_view>
 
 namespace vglx {
 
 /// @cond INTERNAL
-class Identity {
+// Identity of nodes, geometries, materials and textures. Every object gets
+// a process-unique integer ID that is cheap to hash and compare; the UUID
+// string is derived from it only when someone asks for it.
+class VGLX_EXPORT Identity {
 public:
-    [[nodiscard]] const auto& UUID() const { return uuid_; }
+    Identity() : id_(NextId()) {}
+
+    // Copies are distinct objects and get their own ID.
+    Identity(const Identity& other) : id_(NextId()), name_(other.name_) {}
+
+    auto operator=(const Identity& other) -> Identity& {
+        name_ = other.name_;
+        return *this;
+    }
+
+    [[nodiscard]] auto Id() const { return id_; }
+
+    [[nodiscard]] auto UUID() const -> std::string;
 
     [[nodiscard]] const auto& Name() const { return name_; }
 
     auto SetName(std::string_view name) { name_ = name; }
 
 private:
-    std::string uuid_ {math::GenerateUUID()};
+    uint64_t id_;
 
     std::string name_ {};
+
+    static auto NextId() -> uint64_t;
 };
 /// @endcond
 
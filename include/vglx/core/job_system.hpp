@@ -0,0 +1,225 @@
+/*
+===========================================================================
+  VGLX https://vglx.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#pragma once
+
+#include "vglx_export.h"
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <vector>
+
+namespace vglx {
+
+/**
+ * @brief Unit of work executed by the @ref JobSystem.
+ *
+ * @related JobSystem
+ */
+using Job = std::function<void()>;
+
+/**
+ * @brief Tracks completion of a group of jobs.
+ *
+ * Every job scheduled with a counter increments it, and decrements it once the
+ * job has finished. A counter reaching zero marks the group as complete, which
+ * can be awaited with @ref JobSystem::Wait or used as a dependency for other
+ * jobs with @ref JobSystem::ScheduleAfter.
+ *
+ * Counters must outlive the jobs that reference them and cannot be copied or
+ * moved. Destroy a counter only after @ref JobSystem::Wait returned for it.
+ *
+ * @ingroup CoreGroup
+ */
+class VGLX_EXPORT JobCounter {
+public:
+    JobCounter() = default;
+
+    JobCounter(const JobCounter&) = delete;
+    auto operator=(const JobCounter&) -> JobCounter& = delete;
+
+    /**
+     * @brief Returns true once every job tracked by this counter has finished.
+     */
+    [[nodiscard]] auto Done() const -> bool {
+        return pending_.load(std::memory_order_acquire) == 0;
+    }
+
+private:
+    /// @cond INTERNAL
+    friend class JobSystem;
+
+    std::atomic<size_t> pending_ {0};
+
+    mutable std::mutex mutex_;
+
+    std::vector<Job> continuations_;
+    /// @endcond
+};
+
+/**
+ * @brief Work-stealing job system shared by the engine and applications.
+ *
+ * The job system owns a fixed pool of worker threads. Each worker has its own
+ * queue: jobs scheduled from a worker are pushed to and popped from the back
+ * of that worker's queue, while idle workers steal from the front of other
+ * queues. Jobs scheduled from outside the pool are distributed across the
+ * workers in round-robin order.
+ *
+ * Threads that wait for a counter help run pending jobs instead of blocking,
+ * so it is safe to wait from inside a job. OpenGL calls must stay on the main
+ * thread, which is the thread that created the job system; use
+ * @ref ScheduleOnMainThread to hand work back to it. Those jobs are executed
+ * by the application once per frame before rendering, or while the main
+ * thread waits on a counter.
+ *
+ * An instance is created by the runtime and exposed to nodes through
+ * @ref SharedContext::jobs.
+ *
+ * @code
+ * auto counter = vglx::JobCounter {};
+ * for (const auto& chunk : chunks) {
+ *   context->jobs->Schedule([&chunk] { chunk.Process(); }, &counter);
+ * }
+ * context->jobs->Wait(counter);
+ *
+ * context->jobs->ParallelFor(particles.size(), [&](size_t begin, size_t end) {
+ *   for (auto i = begin; i < end; ++i) particles[i].Integrate(delta);
+ * });
+ * @endcode
+ *
+ * @ingroup CoreGroup
+ */
+class VGLX_EXPORT JobSystem {
+public:
+    /**
+     * @brief Constructs a job system.
+     *
+     * @param worker_count Number of worker threads. When zero, jobs are
+     * executed immediately on the thread that schedules them.
+     */
+    explicit JobSystem(unsigned worker_count);
+
+    /**
+     * @brief Creates a shared pointer to a JobSystem object.
+     *
+     * @param worker_count Number of worker threads, defaults to one less than
+     * the number of hardware threads so the main thread keeps a core.
+     * @return std::shared_ptr<JobSystem>
+     */
+    [[nodiscard]] static auto Create(unsigned worker_count = DefaultWorkerCount()) {
+        return std::make_shared<JobSystem>(worker_count);
+    }
+
+    /**
+     * @brief Returns the default number of worker threads.
+     */
+    [[nodiscard]] static auto DefaultWorkerCount() -> unsigned;
+
+    /**
+     * @brief Schedules a job for execution on a worker thread.
+     *
+     * @param job Job to execute.
+     * @param counter Optional counter tracking completion of the job.
+     */
+    auto Schedule(Job job, JobCounter* counter = nullptr) -> void;
+
+    /**
+     * @brief Schedules a job that only starts after a group of jobs finished.
+     *
+     * If the dependency has already completed the job is scheduled right away.
+     *
+     * @param dependency Counter that must reach zero first.
+     * @param job Job to execute.
+     * @param counter Optional counter tracking completion of the job.
+     */
+    auto ScheduleAfter(JobCounter& dependency, Job job, JobCounter* counter = nullptr) -> void;
+
+    /**
+     * @brief Schedules a job that must run on the main thread.
+     *
+     * Use this for work with thread affinity, such as OpenGL resource
+     * creation. Jobs are executed in submission order by
+     * @ref RunMainThreadJobs.
+     *
+     * @param job Job to execute.
+     * @param counter Optional counter tracking completion of the job.
+     */
+    auto ScheduleOnMainThread(Job job, JobCounter* counter = nullptr) -> void;
+
+    /**
+     * @brief Runs all jobs queued with @ref ScheduleOnMainThread.
+     *
+     * Called by the runtime once per frame. Jobs queued while this runs are
+     * picked up on the next call.
+     */
+    auto RunMainThreadJobs() -> void;
+
+    /**
+     * @brief Blocks until the counter reaches zero.
+     *
+     * The calling thread executes pending jobs while it waits.
+     *
+     * @param counter Counter to wait for.
+     */
+    auto Wait(const JobCounter& counter) -> void;
+
+    /**
+     * @brief Splits an index range into jobs and waits for all of them.
+     *
+     * The range `[0, count)` is divided into chunks of at least `grain_size`
+     * indices, and `fn(begin, end)` is invoked once per chunk. The calling
+     * thread participates in the work. The callable is referenced rather than
+     * copied, and the jobs that claim chunks are small enough to be queued
+     * without allocating, so this can run on the frame path.
+     *
+     * @param count Number of indices to process.
+     * @param fn Callable invoked with each half-open chunk.
+     * @param grain_size Minimum number of indices per chunk.
+     */
+    template <typename Fn>
+    auto ParallelFor(size_t count, Fn&& fn, size_t grain_size = 64) -> void {
+        using Callable = std::remove_reference_t<Fn>;
+        RunParallelFor(
+            count,
+            const_cast<void*>(static_cast<const void*>(std::addressof(fn))),
+            [](void* callable, size_t begin, size_t end) {
+                (*static_cast<Callable*>(callable))(begin, end);
+            },
+            grain_size
+        );
+    }
+
+    /**
+     * @brief Returns the number of worker threads.
+     */
+    [[nodiscard]] auto WorkerCount() const -> unsigned;
+
+    /**
+     * @brief Stops all workers after draining the pending jobs.
+     */
+    ~JobSystem();
+
+private:
+    /// @cond INTERNAL
+    class Impl;
+    std::unique_ptr<Impl> impl_;
+
+    auto RunParallelFor(
+        size_t count,
+        void* callable,
+        void (*invoke)(void* callable, size_t begin, size_t end),
+        size_t grain_size
+    ) -> void;
+    /// @endcond
+};
+
+}
\ No newline at end of file
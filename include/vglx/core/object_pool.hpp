@@ -0,0 +1,114 @@
+/*
+===========================================================================
+  VGLX https://vglx.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#pragma once
+
+#include "vglx_export.h"
+
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+namespace vglx {
+
+/**
+ * @brief Size-class pool for small objects that are created and destroyed often.
+ *
+ * Nodes and their internal state are allocated from this pool rather than
+ * the general heap. Requests are rounded up to a multiple of 16 bytes and
+ * served from slabs carved into blocks of that size. Each thread keeps its
+ * own free lists and exchanges blocks with a shared list in batches, so
+ * steady creation and destruction rarely synchronizes and never calls
+ * `malloc` once the slabs are warm. Slabs are kept for the lifetime of the
+ * program and reused for any object of the same size class.
+ *
+ * Requests larger than @ref kMaxBlockSize or with an alignment above 16
+ * bytes fall back to the global `operator new`.
+ *
+ * @ingroup CoreGroup
+ */
+class VGLX_EXPORT ObjectPool {
+public:
+    /// @brief Largest request served from the pool, in bytes.
+    static constexpr auto kMaxBlockSize = size_t {2048};
+
+    /**
+     * @brief Allocates uninitialized storage for an object.
+     *
+     * @param size Size of the object in bytes.
+     * @param alignment Alignment of the object.
+     */
+    [[nodiscard]] static auto Allocate(size_t size, size_t alignment = alignof(std::max_align_t)) -> void*;
+
+    /**
+     * @brief Returns storage obtained from @ref Allocate.
+     *
+     * @param ptr Pointer returned by @ref Allocate.
+     * @param size Size passed to @ref Allocate.
+     * @param alignment Alignment passed to @ref Allocate.
+     */
+    static auto Deallocate(void* ptr, size_t size, size_t alignment = alignof(std::max_align_t)) -> void;
+
+    /**
+     * @brief Returns the total size of the slabs reserved by the pool.
+     */
+    [[nodiscard]] static auto ReservedBytes() -> size_t;
+};
+
+/**
+ * @brief Standard allocator that takes its storage from the @ref ObjectPool.
+ *
+ * Use it with `std::allocate_shared` to place an object and its shared
+ * pointer control block in a single pooled block. All instances compare
+ * equal.
+ *
+ * @tparam T Allocated type.
+ *
+ * @ingroup CoreGroup
+ */
+template <typename T>
+class PoolAllocator {
+public:
+    using value_type = T;
+
+    PoolAllocator() = default;
+
+    template <typename U>
+    PoolAllocator(const PoolAllocator<U>&) noexcept {}
+
+    [[nodiscard]] auto allocate(size_t n) -> T* {
+        return static_cast<T*>(ObjectPool::Allocate(n * sizeof(T), alignof(T)));
+    }
+
+    auto deallocate(T* ptr, size_t n) -> void {
+        ObjectPool::Deallocate(ptr, n * sizeof(T), alignof(T));
+    }
+
+    template <typename U>
+    [[nodiscard]] auto operator==(const PoolAllocator<U>&) const -> bool {
+        return true;
+    }
+};
+
+/**
+ * @brief Creates a shared object whose storage comes from the @ref ObjectPool.
+ *
+ * The object and its control block share one pooled allocation. Node
+ * `Create` functions use this; the resulting pointers behave like ones
+ * from `std::make_shared`.
+ *
+ * @tparam T Type to create.
+ * @param args Arguments forwarded to the constructor of `T`.
+ *
+ * @ingroup CoreGroup
+ */
+template <typename T, typename... Args>
+[[nodiscard]] auto MakePooled(Args&&... args) -> std::shared_ptr<T> {
+    return std::allocate_shared<T>(PoolAllocator<T> {}, std::forward<Args>(args)...);
+}
+
+}
\ No newline at end of file
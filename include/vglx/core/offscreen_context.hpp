@@ -0,0 +1,88 @@
+/*
+===========================================================================
+  VGLX https://vglx.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#pragma once
+
+#include "vglx_export.h"
+
+#include <expected>
+#include <memory>
+#include <string>
+
+namespace vglx {
+
+/**
+ * @brief OpenGL context that renders without a window or display.
+ *
+ * The context is created on a surfaceless EGL display, which works on
+ * machines without a display server and, through Mesa's llvmpipe driver,
+ * without a GPU. It has no default framebuffer, so pair it with a
+ * @ref Renderer created with @ref Renderer::Parameters::offscreen set and
+ * retrieve frames with @ref Renderer::ReadPixels.
+ *
+ * The context is made current on the thread that initializes it, and the
+ * renderer must be constructed after a successful call to @ref Initialize.
+ *
+ * @code
+ * auto context = vglx::OffscreenContext {};
+ * if (auto ok = context.Initialize(); !ok) {
+ *   HandleError(ok.error());
+ * }
+ *
+ * auto renderer = vglx::Renderer {{
+ *   .framebuffer_width = 512,
+ *   .framebuffer_height = 512,
+ *   .clear_color = 0x000000,
+ *   .offscreen = true
+ * }};
+ * @endcode
+ *
+ * @ingroup CoreGroup
+ */
+class VGLX_EXPORT OffscreenContext {
+public:
+    /**
+     * @brief Constructs an offscreen context.
+     *
+     * Resources are not created until @ref Initialize is called.
+     */
+    OffscreenContext();
+
+    // Non-copyable
+    OffscreenContext(const OffscreenContext&) = delete;
+    auto operator=(const OffscreenContext&) -> OffscreenContext& = delete;
+
+    // Movable
+    OffscreenContext(OffscreenContext&&) noexcept;
+    auto operator=(OffscreenContext&&) noexcept -> OffscreenContext&;
+
+    /**
+     * @brief Creates the context, makes it current, and loads OpenGL.
+     *
+     * @return An empty expected on success, or an error message if the
+     * library was built without EGL or the context could not be created.
+     */
+    [[nodiscard]] auto Initialize() -> std::expected<void, std::string>;
+
+    /**
+     * @brief Returns true if the library was built with EGL support.
+     */
+    [[nodiscard]] static auto IsSupported() -> bool;
+
+    /**
+     * @brief Destroys the context and releases the display.
+     */
+    ~OffscreenContext();
+
+private:
+    /// @cond INTERNAL
+    class Impl;
+    std::unique_ptr<Impl> impl_;
+    /// @endcond
+};
+
+}
\ No newline at end of file
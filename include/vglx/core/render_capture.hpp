@@ -0,0 +1,168 @@
+/*
+===========================================================================
+  VGLX https://vglx.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#pragma once
+
+#include "vglx_export.h"
+
+#include "vglx/core/render_commands.hpp"
+
+#include <cstddef>
+#include <expected>
+#include <filesystem>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace vglx {
+
+/**
+ * @brief Timing of one frame replayed from a capture.
+ *
+ * @related RenderCapture
+ */
+struct ReplayFrameTiming {
+    size_t commands; ///< Number of commands in the frame.
+    double cpu_ms; ///< Time spent issuing the frame's commands, in milliseconds.
+    double total_ms; ///< Time until the GPU finished the frame, in milliseconds.
+};
+
+/**
+ * @brief Time spent issuing one class of command during a replay.
+ *
+ * @related RenderCapture
+ */
+struct ReplayCommandTiming {
+    RenderCommandType type; ///< Command type.
+    size_t count; ///< Number of commands of this type replayed.
+    double cpu_ms; ///< Total time spent issuing them, in milliseconds.
+};
+
+/**
+ * @brief Timings collected by @ref RenderCapture::Replay.
+ *
+ * @related RenderCapture
+ */
+struct ReplayReport {
+    std::vector<ReplayFrameTiming> frames; ///< One entry per captured frame.
+    std::vector<ReplayCommandTiming> commands; ///< One entry per command type found in the capture.
+};
+
+/**
+ * @brief Why a command was reported by @ref FindRedundantCommands.
+ *
+ * @related RenderCapture
+ */
+enum class Redundancy {
+    Bind, ///< Binds the vertex array, program, buffer or texture that is already bound.
+    State, ///< Sets fixed-function state to the value it already has.
+    Upload ///< Uploads a uniform value, buffer or texture identical to its current contents.
+};
+
+/**
+ * @brief Command that had no effect on the graphics state.
+ *
+ * @related RenderCapture
+ */
+struct RedundantCommand {
+    Redundancy kind; ///< Why the command is redundant.
+    size_t frame; ///< Index of the frame in the sequence that was analyzed.
+    size_t index; ///< Index of the command within its frame.
+    RenderCommandType type; ///< Type of the command.
+    size_t bytes; ///< Bytes uploaded again, or zero for binds and state changes.
+};
+
+/**
+ * @brief Finds binds, state changes and uploads that repeat the current state.
+ *
+ * Frames are analyzed in order and state carries over from one frame to the
+ * next, as it does on the GPU. Buffer and texture uploads can only be
+ * compared when their contents were recorded, which is the case for captured
+ * streams but not for streams recorded by the null backend.
+ *
+ * @param frames Command streams in the order they were issued.
+ *
+ * @related RenderCapture
+ */
+[[nodiscard]] VGLX_EXPORT auto FindRedundantCommands(
+    std::span<const RenderCommandStream> frames
+) -> std::vector<RedundantCommand>;
+
+/**
+ * @brief Sequence of frames captured from a renderer.
+ *
+ * A renderer created with @ref Renderer::Parameters::capture_path writes
+ * every call it makes, including the buffer, texture and shader data it
+ * uploads, to a capture file with one @ref RenderCommandStream per frame.
+ * Commands issued before the first frame, such as resource creation, are
+ * stored with the first frame.
+ *
+ * Captures make performance regressions reproducible without the
+ * application that produced them: @ref Replay re-executes the frames
+ * against the current OpenGL context and times them, and
+ * @ref FindRedundantCommands lists the work the renderer could have skipped.
+ * The `capture_replay` and `capture_summary` tools wrap both.
+ *
+ * @code
+ * auto capture = vglx::RenderCapture::Load("frames.vcap");
+ * if (!capture) {
+ *   HandleError(capture.error());
+ * }
+ *
+ * auto context = vglx::OffscreenContext {};
+ * if (context.Initialize()) {
+ *   auto report = capture->Replay();
+ * }
+ * @endcode
+ *
+ * @ingroup CoreGroup
+ */
+class VGLX_EXPORT RenderCapture {
+public:
+    /**
+     * @brief Reads a capture file.
+     *
+     * @param path Path to a file written by a capturing renderer.
+     * @return The capture, or an error message if the file cannot be read or
+     * is not a valid capture.
+     */
+    [[nodiscard]] static auto Load(
+        const std::filesystem::path& path
+    ) -> std::expected<RenderCapture, std::string>;
+
+    /**
+     * @brief Returns the captured frames in the order they were rendered.
+     */
+    [[nodiscard]] auto Frames() const -> std::span<const RenderCommandStream> {
+        return frames_;
+    }
+
+    /**
+     * @brief Re-executes the captured frames and times them.
+     *
+     * Frames are drawn into an offscreen framebuffer sized to the captured
+     * viewport. Resource names and uniform locations are remapped to the
+     * ones handed out by the current context, so a capture recorded with the
+     * null backend replays as well. Each frame waits for the GPU to finish
+     * before the next one starts, and all resources are released at the end.
+     *
+     * The time of every command is measured individually, which adds a
+     * constant overhead to each one; compare command timings between
+     * replays of the same capture rather than against live frames.
+     *
+     * @note Requires an OpenGL context to be current on the calling thread.
+     *
+     * @return Per-frame and per-command timings, or an error message if no
+     * context is current or a captured shader program fails to build.
+     */
+    [[nodiscard]] auto Replay() const -> std::expected<ReplayReport, std::string>;
+
+private:
+    std::vector<RenderCommandStream> frames_;
+};
+
+}
\ No newline at end of file
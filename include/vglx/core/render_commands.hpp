@@ -0,0 +1,174 @@
+/*
+===========================================================================
+  VGLX https://vglx.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#pragma once
+
+#include "vglx_export.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace vglx {
+
+/**
+ * @brief Graphics API calls recorded by the null renderer backend and by
+ * render captures.
+ *
+ * Each type corresponds to one call of the renderer's device interface.
+ * Arguments use OpenGL enum values, and resource names are the identifiers
+ * handed out by the device the renderer was talking to. Buffer contents,
+ * texture pixels and shader sources are only stored in the payload of
+ * captured streams, see @ref RenderCapture.
+ *
+ * @ingroup CoreGroup
+ */
+enum class RenderCommandType : uint8_t {
+    CreateVertexArray, ///< Vertex array created: `id`.
+    BindVertexArray, ///< Vertex array bound: `id`.
+    CreateBuffers, ///< Buffers created: `count`, `first id`; every id is in the payload.
+    DeleteBuffers, ///< Buffers deleted: `count`; every id is in the payload.
+    BindBuffer, ///< Buffer bound: `target`, `id`.
+    BindBufferBase, ///< Buffer bound to an indexed target: `target`, `index`, `id`.
+    BufferData, ///< Buffer storage allocated and filled: `target`, `bytes`, `usage`; captures store the data.
+    BufferSubData, ///< Whole buffer contents replaced: `target`, `bytes`; captures store the data.
+    VertexAttribPointer, ///< Vertex attribute layout: `index`, `components`, `stride`, `offset`.
+    EnableVertexAttribArray, ///< Vertex attribute enabled: `index`.
+    VertexAttribDivisor, ///< Instancing divisor: `index`, `divisor`.
+    CreateTexture, ///< Texture created: `id`.
+    DeleteTexture, ///< Texture deleted: `id`.
+    ActiveTexture, ///< Texture unit selected: `unit`.
+    BindTexture, ///< 2D texture bound to the active unit: `id`.
+    TexImage2D, ///< RGBA8 texture uploaded: `width`, `height`, `row alignment`; captures store the pixels.
+    CreateProgram, ///< Shader program compiled and linked: `id`; captures store the sources.
+    DeleteProgram, ///< Shader program deleted: `id`.
+    UniformLocation, ///< Uniform location queried: `program`, `location`; the name is in the payload.
+    UseProgram, ///< Shader program bound: `id`.
+    UniformBlockBinding, ///< Uniform block bound: `program`, `block index`, `binding`; the block name is in the payload.
+    SetUniform, ///< Uniform uploaded: `location`, `type`; the value is in the payload.
+    Enable, ///< Capability enabled: `capability`.
+    Disable, ///< Capability disabled: `capability`.
+    Viewport, ///< Viewport set: `x`, `y`, `width`, `height`.
+    DepthMask, ///< Depth writes toggled: `enabled`.
+    PolygonOffset, ///< Polygon offset set: `factor`, `units` as float bits.
+    BlendFunc, ///< Blend factors set: `source`, `destination`.
+    ClearColor, ///< Clear color set: `r`, `g`, `b`, `a` as float bits.
+    FrontFace, ///< Front face winding set: `mode`.
+    PolygonMode, ///< Polygon rasterization set: `face`, `mode`.
+    Clear, ///< Framebuffer cleared: `mask`.
+    Draw, ///< Draw call: `primitive`, `count`, `instances` (1 unless instanced), `indexed`.
+    ColorMask, ///< Color writes toggled: `enabled`.
+    CreateQuery, ///< Query object created: `id`.
+    DeleteQuery, ///< Query object deleted: `id`.
+    BeginQuery, ///< Query started: `target`, `id`.
+    EndQuery, ///< Query ended: `target`.
+    BeginConditionalRender, ///< Following draws skipped if the query passed no samples: `id`, `mode`.
+    EndConditionalRender, ///< Conditional rendering ended.
+    DepthFunc, ///< Depth comparison set: `func`.
+    Count ///< Number of command types.
+};
+
+/**
+ * @brief Returns the display name of a render command type.
+ *
+ * @related RenderCommandType
+ */
+[[nodiscard]] VGLX_EXPORT auto GetName(RenderCommandType type) -> std::string_view;
+
+/**
+ * @brief Fixed-size record of a single graphics API call.
+ *
+ * @ingroup CoreGroup
+ */
+struct RenderCommand {
+    RenderCommandType type; ///< Call that was recorded.
+    uint32_t payload_size; ///< Size of the payload in bytes.
+    uint32_t payload_offset; ///< Offset of the payload in the stream's payload buffer.
+    std::array<uint32_t, 4> args; ///< Call arguments; unused arguments are zero.
+};
+
+/**
+ * @brief Compact stream of graphics API calls recorded during a frame.
+ *
+ * Commands are stored as fixed-size records in a single array, and the few
+ * calls that carry data, such as uniform uploads, append it to a shared
+ * payload buffer. The null backend does not copy buffer and texture
+ * contents; only their sizes are recorded.
+ *
+ * The stream is filled by the null renderer backend selected with
+ * @ref Renderer::Backend::Null and read with @ref Renderer::GetCommandStream.
+ * It can be used to count the work a frame issues, or rendered to text with
+ * @ref Describe to compare frames in tests. A @ref RenderCapture holds one
+ * stream per captured frame.
+ *
+ * @ingroup CoreGroup
+ */
+class VGLX_EXPORT RenderCommandStream {
+public:
+    /**
+     * @brief Returns the recorded commands in call order.
+     */
+    [[nodiscard]] auto Commands() const -> std::span<const RenderCommand> {
+        return commands_;
+    }
+
+    /**
+     * @brief Returns the data recorded with a command.
+     *
+     * @param command Command from this stream.
+     */
+    [[nodiscard]] auto Payload(const RenderCommand& command) const -> std::span<const std::byte> {
+        return std::span {payload_}.subspan(command.payload_offset, command.payload_size);
+    }
+
+    /**
+     * @brief Returns the number of recorded commands of a given type.
+     *
+     * @param type Command type to count.
+     */
+    [[nodiscard]] auto Count(RenderCommandType type) const -> size_t;
+
+    /**
+     * @brief Returns the total number of recorded commands.
+     */
+    [[nodiscard]] auto Size() const { return commands_.size(); }
+
+    /**
+     * @brief Renders the stream as text, one command per line.
+     *
+     * Each line holds the command name, its arguments and, for commands that
+     * carry data, the payload as hexadecimal 32-bit words.
+     */
+    [[nodiscard]] auto Describe() const -> std::string;
+
+    /**
+     * @brief Removes all commands while keeping the allocated storage.
+     */
+    auto Clear() -> void;
+
+    /// @cond INTERNAL
+    auto Record(
+        RenderCommandType type,
+        std::initializer_list<uint32_t> args = {},
+        std::span<const std::byte> payload = {}
+    ) -> void;
+
+    auto Append(const RenderCommand& command, std::span<const std::byte> payload) -> void;
+    /// @endcond
+
+private:
+    std::vector<RenderCommand> commands_;
+
+    std::vector<std::byte> payload_;
+};
+
+}
\ No newline at end of file
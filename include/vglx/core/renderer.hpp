@@ -10,14 +10,55 @@
 #include "vglx_export.h"
 
 #include "vglx/cameras/camera.hpp"
+#include "vglx/core/job_system.hpp"
+#include "vglx/core/render_commands.hpp"
+#include "vglx/materials/material.hpp"
 #include "vglx/math/color.hpp"
 #include "vglx/nodes/scene.hpp"
+#include "vglx/utilities/frame_profile.hpp"
 
+#include <cstdint>
+#include <filesystem>
+#include <functional>
 #include <memory>
+#include <span>
 #include <string>
+#include <vector>
 
 namespace vglx {
 
+/**
+ * @brief Pixels read back from the renderer's framebuffer.
+ *
+ * @related Renderer
+ */
+struct ReadbackImage {
+    int width; ///< Image width in pixels.
+    int height; ///< Image height in pixels.
+    std::span<const uint8_t> pixels; ///< Tightly packed RGBA8 rows, top row first.
+};
+
+/**
+ * @brief Function signature for receiving framebuffer readbacks.
+ *
+ * The pixel span is only valid for the duration of the call.
+ *
+ * @related Renderer
+ */
+using ReadbackCallback = std::function<void(const ReadbackImage& image)>;
+
+/**
+ * @brief GPU time spent drawing with one shader program variant.
+ *
+ * @related Renderer
+ */
+struct GpuMaterialTiming {
+    Material::Type type; ///< Material type the program was built for.
+    size_t program; ///< Key identifying the shader program variant.
+    double ms; ///< GPU time of all draws using the program, in milliseconds.
+    unsigned draws; ///< Number of draws using the program.
+};
+
 /**
  * @brief Renderer object for drawing a scene from a given camera.
  *
@@ -46,15 +87,63 @@ namespace vglx {
  * the render area (or recreate with new parameters if you manage your own
  * framebuffers).
  *
+ * With @ref Parameters::offscreen set, frames are drawn into a framebuffer
+ * object owned by the renderer instead of the default framebuffer, which
+ * allows rendering with an @ref OffscreenContext that has no window. Frames
+ * are retrieved with @ref ReadPixels.
+ *
+ * With @ref Parameters::gpu_timers set, the clear, opaque and transparent
+ * passes are timed on the GPU with timestamp queries. Queries are kept in a
+ * ring spanning several frames and only read once their results are
+ * available, so timing never stalls the pipeline; the results appear in
+ * @ref GetFrameProfile a few frames later. @ref Parameters::gpu_material_timers
+ * additionally times every draw and groups the results by shader program
+ * variant, see @ref GetGpuMaterialTimings.
+ *
+ * On the CPU, all draws of a frame are timed together as
+ * @ref ProfilePhase::DrawSubmit. @ref Parameters::draw_phase_timers splits
+ * each draw into program resolve, uniform upload and draw submit instead,
+ * which reads the clock three times per draw.
+ *
+ * With @ref Parameters::backend set to @ref Backend::Null, no graphics
+ * context is needed. Every call the renderer would make is recorded into a
+ * @ref RenderCommandStream instead, available from @ref GetCommandStream,
+ * which measures the CPU cost of rendering without a GPU and lets tests
+ * inspect and compare the binds, uniform uploads and draws of a frame.
+ *
+ * With @ref Parameters::capture_path set, the calls of every frame are also
+ * written to a file, along with the buffer, texture and shader data they
+ * upload, for either backend. The file is created by @ref Initialize and
+ * completed when the renderer is destroyed; load it with
+ * @ref RenderCapture::Load to replay or analyze the frames.
+ *
  * @ingroup CoreGroup
  */
 class VGLX_EXPORT Renderer {
 public:
+    /**
+     * @brief Selects the graphics API the renderer issues its calls to.
+     */
+    enum class Backend {
+        OpenGL, ///< Draw with the OpenGL context current on the calling thread.
+        Null ///< Record calls into a @ref RenderCommandStream without a context.
+    };
+
     /// @brief Parameters for constructing a @ref Renderer object.
     struct Parameters {
         int framebuffer_width; ///< Current framebuffer width in pixels.
         int framebuffer_height; ///< Current framebuffer height in pixels.
         Color clear_color; ///< Clear color used at the start of a frame.
+        bool offscreen {false}; ///< Render into an internal framebuffer object instead of the default framebuffer.
+        bool gpu_timers {true}; ///< Time render passes on the GPU with timer queries.
+        bool gpu_material_timers {false}; ///< Also time each draw and group the results by shader program.
+        bool draw_phase_timers {false}; ///< Split the CPU time of each draw into program resolve, uniform upload and draw submit. Otherwise all draws are timed together as draw submit.
+        bool occlusion_culling {false}; ///< Skip renderables hidden behind meshes marked as @ref Mesh::occluder, using a depth buffer rasterized on the CPU.
+        bool occlusion_debug_view {false}; ///< Draw the occlusion buffer over the bottom left corner of the frame. Ignored by the null backend.
+        bool occlusion_queries {false}; ///< Skip meshes with @ref Mesh::occlusion_query set while GPU occlusion queries find them hidden.
+        bool depth_prepass {false}; ///< Draw the depth of opaque meshes first, so that each pixel is shaded once. With @ref gpu_timers, one frame in 60 skips the pre-pass to measure its saving. See @ref Material::depth_prepass.
+        Backend backend {Backend::OpenGL}; ///< Graphics API the renderer issues its calls to.
+        std::filesystem::path capture_path {}; ///< File to capture every frame's commands to, or empty to disable capture.
     };
 
     /**
@@ -77,6 +166,9 @@ public:
 
     /**
      * @brief Initializes GPU state and allocates required resources.
+     *
+     * Fails if @ref Parameters::capture_path is set and the file cannot be
+     * created.
      */
     [[nodiscard]] auto Initialize() -> std::expected<void, std::string>;
 
@@ -93,6 +185,29 @@ public:
      */
     auto Render(Scene* scene, Camera* camera) -> void;
 
+    /**
+     * @brief Captures the render-relevant state of a scene for the next submit.
+     *
+     * Updates world transforms, culls and sorts renderables, uploads pending
+     * buffer, light and camera data, and copies per-object transforms and
+     * material parameters into an internal frame snapshot. This is the only
+     * part of rendering that reads the scene graph, so once it returns the
+     * scene may be updated again, even from another thread, while
+     * @ref Submit draws the captured frame.
+     *
+     * @ref Render is equivalent to calling @ref Extract followed by
+     * @ref Submit.
+     *
+     * @param scene Pointer to the scene to capture.
+     * @param camera Pointer to the active camera.
+     */
+    auto Extract(Scene* scene, Camera* camera) -> void;
+
+    /**
+     * @brief Draws the frame captured by the last call to @ref Extract.
+     */
+    auto Submit() -> void;
+
     /**
      * @brief Sets the active viewport rectangle in pixels.
      *
@@ -122,6 +237,17 @@ public:
      */
     auto SetClearColor(const Color& color) -> void;
 
+    /**
+     * @brief Sets the job system used to cull large scenes in parallel.
+     *
+     * Scenes with thousands of nodes are split into subtrees that are culled
+     * on the job system's workers. Draw order is the same as with culling on
+     * a single thread. The runtime passes the application's job system.
+     *
+     * @param jobs Job system to use, or nullptr to cull on the calling thread.
+     */
+    auto SetJobSystem(std::shared_ptr<JobSystem> jobs) -> void;
+
     /**
      * @brief Returns the number of renderable objects drawn in the last frame.
      *
@@ -129,6 +255,81 @@ public:
      */
     [[nodiscard]] auto RenderedObjectsPerFrame() const -> size_t;
 
+    /**
+     * @brief Returns the CPU phase timings and counters of the last frame.
+     *
+     * The profile is reset by @ref Extract and completed by @ref Submit. The
+     * @ref ProfilePhase::Advance phase is left for the caller to fill in.
+     */
+    [[nodiscard]] auto GetFrameProfile() const -> const FrameProfile&;
+
+    /**
+     * @brief Returns the GPU time per shader program of the last timed frame.
+     *
+     * Entries are sorted by descending GPU time and belong to the same frame
+     * as the GPU timings in @ref GetFrameProfile. Empty unless
+     * @ref Parameters::gpu_material_timers is set.
+     */
+    [[nodiscard]] auto GetGpuMaterialTimings() const -> const std::vector<GpuMaterialTiming>&;
+
+    /**
+     * @brief Starts timing a GPU pass issued outside of the renderer.
+     *
+     * Used by the runtime to time the @ref GpuPass::UI pass. Call after
+     * @ref Submit and close it with @ref EndGpuPass before the next frame.
+     *
+     * @param pass Pass to time.
+     */
+    auto BeginGpuPass(GpuPass pass) -> void;
+
+    /**
+     * @brief Stops timing a GPU pass started with @ref BeginGpuPass.
+     *
+     * @param pass Pass to stop timing.
+     */
+    auto EndGpuPass(GpuPass pass) -> void;
+
+    /**
+     * @brief Returns the calls recorded since the start of the last frame.
+     *
+     * The stream is cleared by @ref Extract, so after @ref Render it holds
+     * exactly one frame. GPU timers, offscreen framebuffers and readbacks are
+     * not available with the null backend and are not recorded.
+     *
+     * @return The recorded stream, or nullptr unless @ref Parameters::backend
+     * is @ref Backend::Null.
+     */
+    [[nodiscard]] auto GetCommandStream() const -> const RenderCommandStream*;
+
+    /**
+     * @brief Queues an asynchronous copy of the last rendered frame.
+     *
+     * Call after @ref Render (or @ref Submit) and before presenting. The copy
+     * is written into a pixel buffer object without stalling the pipeline,
+     * and the callback runs on the calling thread from a later @ref Render,
+     * @ref Submit or @ref FlushReadbacks once the GPU has finished it.
+     * Callbacks run in request order. A few copies may be in flight at once;
+     * requesting more waits for the oldest one.
+     *
+     * @param callback Function receiving the pixels.
+     */
+    auto ReadPixels(ReadbackCallback callback) -> void;
+
+    /**
+     * @brief Queues an asynchronous copy of the last rendered frame to a file.
+     *
+     * Behaves like @ref ReadPixels(ReadbackCallback), writing the pixels as
+     * an uncompressed TGA image once they are available.
+     *
+     * @param path Destination file path.
+     */
+    auto ReadPixels(const std::filesystem::path& path) -> void;
+
+    /**
+     * @brief Waits for all queued readbacks and runs their callbacks.
+     */
+    auto FlushReadbacks() -> void;
+
     virtual ~Renderer();
 
 private:
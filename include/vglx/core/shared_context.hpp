@@ -9,6 +9,7 @@
 
 #include "vglx_export.h"
 
+#include "vglx/core/job_system.hpp"
 #include "vglx/loaders.hpp"
 
 #include <memory>
@@ -112,6 +113,15 @@ public:
      * custom `.msh` format.
      */
     std::shared_ptr<MeshLoader> mesh_loader = MeshLoader::Create();
+
+    /**
+     * @brief Shared job system.
+     *
+     * Runs work on the engine's worker threads. Set by the runtime before the
+     * scene is attached. Use @ref JobSystem::ScheduleOnMainThread for work
+     * that issues OpenGL calls.
+     */
+    std::shared_ptr<JobSystem> jobs;
 };
 
 /**
@@ -217,11 +217,19 @@ protected:
     /// @brief Cached bounding sphere.
     std::optional<Sphere> bounding_sphere_;
 
+    /// @brief Set once both bounds are cached. Accessed atomically.
+    bool bounds_ready_ {false};
+
     /// @brief Vertex attribute metadata.
     std::array<GeometryAttribute, std::to_underlying(
         VertexAttributeType::None
     )> attributes_ {};
 
+    /**
+     * @brief Computes and caches both bounds unless another thread did.
+     */
+    auto CreateBounds() -> void;
+
     /**
      * @brief Computes and caches the bounding box.
      */
@@ -59,7 +59,7 @@ public:
      * for constructing the light.
      */
     [[nodiscard]] static auto Create(const Parameters& params) {
-        return std::make_shared<AmbientLight>(params);
+        return MakePooled<AmbientLight>(params);
     }
 
     /**
@@ -64,7 +64,7 @@ public:
      * for constructing the light.
      */
     [[nodiscard]] static auto Create(const Parameters& params) {
-        return std::make_shared<DirectionalLight>(params);
+        return MakePooled<DirectionalLight>(params);
     }
 
     /**
@@ -63,7 +63,7 @@ public:
      * for constructing the light.
      */
     [[nodiscard]] static auto Create(const Parameters& params) {
-        return std::make_shared<PointLight>(params);
+        return MakePooled<PointLight>(params);
     }
 
     /**
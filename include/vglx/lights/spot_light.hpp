@@ -83,7 +83,7 @@ public:
      * for constructing the light.
      */
     [[nodiscard]] static auto Create(const Parameters& params) {
-        return std::make_shared<SpotLight>(params);
+        return MakePooled<SpotLight>(params);
     }
 
     /**
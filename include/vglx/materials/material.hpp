@@ -72,6 +72,15 @@ public:
     /// @brief Enables depth testing.
     bool depth_test {true};
 
+    /**
+     * @brief Includes opaque meshes using this material in the depth pre-pass.
+     *
+     * Only has an effect with @ref Renderer::Parameters::depth_prepass
+     * enabled. Turn it off for materials that are cheap to shade, where
+     * drawing the geometry twice costs more than the overdraw it saves.
+     */
+    bool depth_prepass {true};
+
     /// @brief Enables wireframe rendering.
     bool wireframe {false};
 
@@ -213,4 +213,27 @@ private:
     /// @endcond
 };
 
+/**
+ * @brief Interpolates between two transforms component-wise.
+ * @related Transform3
+ *
+ * Position and scale are interpolated linearly, and each Euler angle is
+ * interpolated along the shortest arc using @ref math::LerpAngle.
+ *
+ * @param a Start transform.
+ * @param b End transform.
+ * @param f Interpolation factor in $[0, 1]$.
+ */
+[[nodiscard]] constexpr auto Lerp(const Transform3& a, const Transform3& b, float f) -> Transform3 {
+    auto t = Transform3 {};
+    t.position = Lerp(a.position, b.position, f);
+    t.scale = Lerp(a.scale, b.scale, f);
+    t.rotation = Euler {
+        math::LerpAngle(a.rotation.pitch, b.rotation.pitch, f),
+        math::LerpAngle(a.rotation.yaw, b.rotation.yaw, f),
+        math::LerpAngle(a.rotation.roll, b.rotation.roll, f)
+    };
+    return t;
+}
+
 }
\ No newline at end of file
@@ -132,6 +132,25 @@ alignas(64) constexpr uint32_t arctan_table[65] {
     return std::lerp(a, b, f);
 }
 
+/**
+ * @brief Interpolates between two angles along the shortest arc.
+ * @ingroup MathGroup
+ *
+ * The difference between the angles is wrapped to $[-\pi, \pi]$ before
+ * interpolating, so interpolating from just below $\pi$ to just above
+ * $-\pi$ does not sweep through zero.
+ *
+ * @param a Start angle in radians.
+ * @param b End angle in radians.
+ * @param f Interpolation factor in [0, 1].
+ * @return Interpolated angle in radians.
+ */
+[[nodiscard]] constexpr auto LerpAngle(const float a, const float b, const float f) {
+    auto delta = b - a;
+    delta -= two_pi * std::floor((delta + pi) / two_pi);
+    return a + delta * f;
+}
+
 /**
  * @brief Computes the Cantor pairing of two values.
  * @ingroup MathGroup
@@ -62,7 +62,7 @@ public:
      * @return std::shared_ptr<Arrow>
      */
     [[nodiscard]] static auto Create(const Parameters& params) {
-        return std::make_shared<Arrow>(params);
+        return MakePooled<Arrow>(params);
     }
 
     /**
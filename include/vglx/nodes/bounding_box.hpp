@@ -56,7 +56,7 @@ public:
      * @return std::shared_ptr<BoundingBox>
      */
     [[nodiscard]] static auto Create(const Box3& box, const Color& color) {
-        return std::make_shared<BoundingBox>(box, color);
+        return MakePooled<BoundingBox>(box, color);
     }
 };
 
@@ -55,7 +55,7 @@ public:
      * @return std::shared_ptr<BoundingPlane>
      */
     [[nodiscard]] static auto Create(const Plane& plane, float size, const Color& color) {
-        return std::make_shared<BoundingPlane>(plane, size, color);
+        return MakePooled<BoundingPlane>(plane, size, color);
     }
 };
 
@@ -56,7 +56,7 @@ public:
      * @return std::shared_ptr<BoundingSphere>
      */
     [[nodiscard]] static auto Create(const Sphere& sphere, const Color& color) {
-        return std::make_shared<BoundingSphere>(sphere, color);
+        return MakePooled<BoundingSphere>(sphere, color);
     }
 };
 
@@ -60,7 +60,7 @@ public:
      * @return std::shared_ptr<Grid>
      */
     [[nodiscard]] static auto Create(const Parameters& params) {
-        return std::make_shared<Grid>(params);
+        return MakePooled<Grid>(params);
     }
 };
 
@@ -85,7 +85,7 @@ public:
         std::shared_ptr<Material> material,
         std::size_t count
     ) {
-        return std::make_shared<InstancedMesh>(geometry, material, count);
+        return MakePooled<InstancedMesh>(geometry, material, count);
     }
 
     /**
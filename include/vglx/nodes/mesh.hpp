@@ -36,6 +36,36 @@ namespace vglx {
  */
 class VGLX_EXPORT Mesh : public Renderable {
 public:
+    /**
+     * @brief Whether the mesh hides the renderables behind it.
+     *
+     * With @ref Renderer::Parameters::occlusion_culling enabled, occluders
+     * are rasterized into a small depth buffer on the CPU every frame and
+     * renderables entirely behind them are not drawn. Mark large, opaque,
+     * closed meshes such as walls and buildings.
+     */
+    bool occluder {false};
+
+    /**
+     * @brief Simplified geometry rasterized in place of the mesh's own.
+     *
+     * Must fit inside the mesh so that it never hides what the mesh leaves
+     * visible. Only used when @ref occluder is set.
+     */
+    std::shared_ptr<Geometry> occluder_proxy;
+
+    /**
+     * @brief Whether the mesh is skipped while GPU occlusion queries find it hidden.
+     *
+     * With @ref Renderer::Parameters::occlusion_queries enabled, the mesh's
+     * bounding box is tested against the depth buffer on the GPU. Results
+     * are read back a frame or more later and reused across frames, so a
+     * mesh can appear a frame late when it comes into view. Suits meshes
+     * that are expensive to draw and often hidden. Ignored by instanced
+     * meshes.
+     */
+    bool occlusion_query {false};
+
     /**
      * @brief Constructs a mesh instance with the given geometry and material.
      *
@@ -56,7 +86,7 @@ public:
         std::shared_ptr<Geometry> geometry,
         std::shared_ptr<Material> material
     ) {
-        return std::make_shared<Mesh>(geometry, material);
+        return MakePooled<Mesh>(geometry, material);
     }
 
     /**
@@ -73,7 +103,7 @@ public:
      *
      * @return Shared pointer to the current geometry.
      */
-    [[nodiscard]] auto GetGeometry() -> std::shared_ptr<Geometry> override {
+    [[nodiscard]] auto GetGeometry() -> const std::shared_ptr<Geometry>& override {
         return geometry_;
     }
 
@@ -82,7 +112,7 @@ public:
      *
      * @return Shared pointer to the current material.
      */
-    [[nodiscard]] auto GetMaterial() -> std::shared_ptr<Material> override {
+    [[nodiscard]] auto GetMaterial() -> const std::shared_ptr<Material>& override {
         return material_;
     }
 
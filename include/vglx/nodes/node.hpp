@@ -10,6 +10,7 @@
 #include "vglx_export.h"
 
 #include "vglx/core/identity.hpp"
+#include "vglx/core/object_pool.hpp"
 #include "vglx/core/shared_context.hpp"
 #include "vglx/events/keyboard_event.hpp"
 #include "vglx/events/mouse_event.hpp"
@@ -23,6 +24,8 @@
 
 namespace vglx {
 
+class Scene;
+
 /**
  * @brief Base class for all scene graph objects.
  *
@@ -37,7 +40,9 @@ namespace vglx {
  * @ref OnAttached.
  *
  * To define behavior, override virtual methods such as @ref OnUpdate,
- * @ref OnKeyboardEvent, or @ref OnMouseEvent.
+ * @ref OnKeyboardEvent, or @ref OnMouseEvent. Attached nodes that override
+ * @ref OnUpdate receive it every frame unless they opt out with
+ * @ref SetUpdateEnabled.
  *
  * @ingroup NodesGroup
  */
@@ -74,6 +79,18 @@ public:
     /// @brief If true, the node is subject to frustum culling during rendering.
     bool frustum_culled {true};
 
+    /**
+     * @brief If true, @ref OnUpdate may run on a worker thread.
+     *
+     * Thread-safe nodes are updated concurrently after all other nodes in the
+     * scene, so they do not keep their registration order relative to nodes
+     * that are not thread-safe. A thread-safe node that another node detaches
+     * or disables during the same update is skipped. Their @ref OnUpdate must
+     * only modify the node's own state and must not add or remove nodes from
+     * the scene graph or call @ref SetUpdateEnabled.
+     */
+    bool update_thread_safe {false};
+
     /**
      * @brief Constructs an Node instance.
      */
@@ -98,6 +115,38 @@ public:
      */
     auto RemoveAllChildren() -> void;
 
+    /**
+     * @brief Starts batching scene graph change notifications.
+     *
+     * While a batch is open, @ref Add and @ref Remove only record their
+     * change notifications instead of dispatching them immediately. The
+     * recorded changes are resolved in a single pass by @ref CommitBatch:
+     * nodes that were removed again before the commit are dropped, and nodes
+     * whose ancestor was added in the same batch are attached together with
+     * that ancestor. Batches nest, and only the outermost commit dispatches.
+     *
+     * Batching is tracked per thread, so a loader building a hierarchy on a
+     * background thread does not affect the main thread.
+     *
+     * @code
+     * vglx::Node::BeginBatch();
+     * for (const auto& mesh : meshes) {
+     *   scene->Add(mesh);
+     * }
+     * vglx::Node::CommitBatch();
+     * @endcode
+     */
+    static auto BeginBatch() -> void;
+
+    /**
+     * @brief Closes the batch opened by @ref BeginBatch.
+     *
+     * When the outermost batch is closed, pending removals are dispatched in
+     * order followed by one addition per top-most node that is still part of
+     * a hierarchy.
+     */
+    static auto CommitBatch() -> void;
+
     /**
      * @brief Returns the list of child nodes.
      *
@@ -106,7 +155,11 @@ public:
     [[nodiscard]] auto Children() const -> const std::vector<std::shared_ptr<Node>>&;
 
     /**
-     * @brief Checks whether the given node is a direct child of this node.
+     * @brief Checks whether the given node is a descendant of this node.
+     *
+     * Walks up the parent chain of the given node until it reaches the depth
+     * of this node, so the cost is proportional to the depth difference rather
+     * than to the size of the subtree.
      *
      * @param node Pointer to the node to check.
      * @return True if the node is a child.
@@ -120,6 +173,25 @@ public:
      */
     [[nodiscard]] auto Parent() const -> const Node*;
 
+    /**
+     * @brief Returns the depth of this node in its hierarchy.
+     *
+     * Root nodes have a depth of zero. The depth is maintained incrementally
+     * as nodes are added and removed.
+     */
+    [[nodiscard]] auto Depth() const -> unsigned;
+
+    /**
+     * @brief Returns the scene this node is attached to.
+     *
+     * The pointer is cached when the node joins a scene hierarchy and cleared
+     * when it is removed, so the query runs in constant time.
+     *
+     * @return Pointer to the owning scene, or nullptr if the node is not part
+     * of a scene.
+     */
+    [[nodiscard]] auto GetScene() const -> Scene*;
+
     /**
      * @brief Recursively updates this node and all child world transforms.
      *
@@ -151,6 +223,59 @@ public:
      */
     [[nodiscard]] auto GetWorldTransform() -> Matrix4;
 
+    /// @name Transform interpolation
+    /// @{
+
+    /**
+     * @brief Records the current local transforms as the previous simulation state.
+     *
+     * Call this on the root of a hierarchy before each fixed simulation step.
+     * The recorded state is the starting point of
+     * @ref InterpolateTransformHierarchy.
+     */
+    auto StoreTransformHistory() -> void;
+
+    /**
+     * @brief Computes render transforms between the last two simulation states.
+     *
+     * Interpolates each node's local transform from the state recorded by
+     * @ref StoreTransformHistory to its current state and composes the
+     * results down the hierarchy. Nodes without recorded history use their
+     * current transform. The simulated transforms are left untouched.
+     *
+     * @param alpha Interpolation factor in $[0, 1]$, typically
+     * @ref FixedTimestep::Alpha.
+     */
+    auto InterpolateTransformHierarchy(float alpha) -> void;
+
+    /**
+     * @brief Returns the transformation matrix used for rendering.
+     *
+     * This is the interpolated world transform once
+     * @ref InterpolateTransformHierarchy ran for this node, and the world
+     * transform otherwise.
+     */
+    [[nodiscard]] auto GetRenderTransform() -> Matrix4;
+
+    /**
+     * @brief Returns the transformation matrix used for rendering as last computed.
+     *
+     * Unlike @ref GetRenderTransform, this never updates the hierarchy, so it
+     * is safe to call from several threads once
+     * @ref UpdateTransformHierarchy ran for the scene.
+     */
+    [[nodiscard]] auto CachedRenderTransform() const -> const Matrix4&;
+
+    /**
+     * @brief Returns true if the node has an interpolated render transform.
+     *
+     * The render transform is discarded when the node is removed from its
+     * scene.
+     */
+    [[nodiscard]] auto IsInterpolated() const -> bool;
+
+    /// @}
+
     /**
      * @brief Returns node type.
      *
@@ -172,10 +297,14 @@ public:
     /**
      * @brief Creates a shared pointer to a Node object.
      *
+     * Like every node type's `Create`, the node and its control block are
+     * allocated together from the @ref ObjectPool. Nodes can also be created
+     * with `std::allocate_shared` and any other allocator.
+     *
      * @return std::shared_ptr<Node>
      */
     [[nodiscard]] static auto Create() {
-        return std::make_shared<Node>();
+        return MakePooled<Node>();
     }
 
     /**
@@ -238,17 +367,41 @@ public:
 
     /// @}
 
+    /**
+     * @brief Enables or disables per-frame calls to @ref OnUpdate.
+     *
+     * By default the scene calls @ref OnUpdate on every attached node, and
+     * drops a node from its update list the first time the default
+     * implementation runs, so nodes whose type does not override it stop
+     * costing anything after their first frame. Calling this method replaces
+     * that default for the node; types whose override calls the default
+     * implementation must enable updates explicitly. The setting can change
+     * at any time; a node attached to a scene is added to or removed from its
+     * update list immediately.
+     *
+     * @param enabled Whether the scene calls @ref OnUpdate every frame.
+     */
+    auto SetUpdateEnabled(bool enabled) -> void;
+
+    /**
+     * @brief Returns true if the scene calls @ref OnUpdate every frame.
+     */
+    [[nodiscard]] auto IsUpdateEnabled() const -> bool;
+
     /// @name Event hooks
     /// @{
 
     /**
-     * @brief Called every frame.
+     * @brief Called every frame while updates are enabled.
      *
      * Override this method to implement per-frame logic or animation.
+     * Overrides do not need to call this implementation, which does nothing
+     * but drop the node from the update list. An override that does call it
+     * must enable updates with @ref SetUpdateEnabled to keep being updated.
      *
      * @param delta Time in seconds since the last frame.
      */
-    virtual auto OnUpdate(float delta) -> void { /* No-op by default */ }
+    virtual auto OnUpdate(float delta) -> void;
 
     /**
      * @brief Called when the node becomes part of an attached scene.
@@ -288,7 +441,13 @@ private:
     std::unique_ptr<Impl> impl_;
 
     friend class Scene;
-    auto AttachRecursive(SharedContextPointer context) -> void;
+    static constexpr auto kNoUpdateSlot = ~size_t {0};
+    auto AttachRecursive(Scene* scene, SharedContextPointer context) -> void;
+    auto DetachRecursive() -> void;
+    auto DispatchUpdate(float delta) -> bool;
+    auto InterpolateRecursive(const Matrix4& parent_transform, float alpha) -> void;
+    auto SetOwningScene(Scene* scene) -> void;
+    auto UpdateSlot() -> size_t&;
     /// @endcond
 };
 
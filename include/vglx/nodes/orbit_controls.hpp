@@ -70,7 +70,7 @@ public:
      * @return std::shared_ptr<OrbitControls>
      */
     [[nodiscard]] static auto Create(Camera* camera, const Parameters& params) {
-        return std::make_shared<OrbitControls>(camera, params);
+        return MakePooled<OrbitControls>(camera, params);
     }
 
     /**
@@ -14,6 +14,7 @@
 #include "vglx/math/frustum.hpp"
 #include "vglx/nodes/node.hpp"
 
+#include <cstdint>
 #include <memory>
 
 namespace vglx {
@@ -30,9 +31,9 @@ class VGLX_EXPORT Renderable : public Node {
 public:
     virtual ~Renderable() = default;
 
-    [[nodiscard]] virtual auto GetGeometry() -> std::shared_ptr<Geometry> = 0;
+    [[nodiscard]] virtual auto GetGeometry() -> const std::shared_ptr<Geometry>& = 0;
 
-    [[nodiscard]] virtual auto GetMaterial() -> std::shared_ptr<Material> = 0;
+    [[nodiscard]] virtual auto GetMaterial() -> const std::shared_ptr<Material>& = 0;
 
     [[nodiscard]] virtual auto BoundingBox() -> Box3;
 
@@ -52,6 +53,12 @@ public:
 
 protected:
     Renderable() = default;
+
+private:
+    // IDs of the geometry and material that last passed CanRender. Checks
+    // only run again when either is replaced or the geometry is disposed.
+    uint64_t validated_geometry_ {0};
+    uint64_t validated_material_ {0};
 };
 /// @endcond
 
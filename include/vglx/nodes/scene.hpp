@@ -77,9 +77,22 @@ public:
     /**
      * @brief Advances the scene by one frame.
      *
-     * Propagates the per-frame update through the scene graph, calling
-     * `Node::Update(float delta)` on all attached nodes in depth-first order.
-     * This is invoked automatically by the runtime each frame.
+     * Calls the scene's own `OnUpdate`, then `Node::OnUpdate(float delta)` on
+     * every attached node whose updates are enabled (see
+     * `Node::SetUpdateEnabled`). Nodes that do not override `OnUpdate` are
+     * dropped from the update list after their first call, so the cost scales
+     * with the number of nodes that have update logic rather than with the
+     * size of the scene. This is invoked automatically by the runtime each
+     * frame.
+     *
+     * Nodes are not updated in scene graph order. They are updated in the
+     * order they joined the update list, which is when they were attached
+     * or when updates were enabled on an attached node, so a child may be
+     * updated before its parent. Nodes flagged with
+     * `Node::update_thread_safe` are updated after all other nodes, in
+     * parallel on the context's job system when there are enough of them.
+     * Nodes that join the list during an update are first updated on the
+     * next frame.
      *
      * @param delta Elapsed time in seconds since the last frame.
      */
@@ -104,7 +117,7 @@ public:
      * @return std::shared_ptr<Scene>
      */
     [[nodiscard]] static auto Create() {
-        return std::make_shared<Scene>();
+        return MakePooled<Scene>();
     }
 
     /**
@@ -125,6 +138,11 @@ private:
     /// @cond INTERNAL
     class Impl;
     std::unique_ptr<Impl> impl_;
+
+    friend class Node;
+    auto RegisterUpdate(Node* node) -> void;
+    auto UnregisterUpdate(Node* node) -> void;
+    auto RetainDuringUpdate(const std::shared_ptr<Node>& node) -> void;
     /// @endcond
 };
 
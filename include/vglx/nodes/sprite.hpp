@@ -86,7 +86,7 @@ public:
      * @return std::shared_ptr<Sprite>
      */
     [[nodiscard]] static auto Create(std::shared_ptr<SpriteMaterial> material = nullptr) {
-        return std::make_shared<Sprite>(material);
+        return MakePooled<Sprite>(material);
     }
 
     /**
@@ -99,7 +99,7 @@ public:
     }
 
     /// @cond INTERNAL
-    [[nodiscard]] auto GetGeometry() -> std::shared_ptr<Geometry> override {
+    [[nodiscard]] auto GetGeometry() -> const std::shared_ptr<Geometry>& override {
         return geometry_;
     }
     /// @endcond
@@ -109,7 +109,7 @@ public:
      *
      * @return Shared pointer to the current material.
      */
-    [[nodiscard]] auto GetMaterial() -> std::shared_ptr<Material> override {
+    [[nodiscard]] auto GetMaterial() -> const std::shared_ptr<Material>& override {
         return material_;
     }
 
@@ -12,6 +12,10 @@
  * @brief Utility classes for rendering and debugging
  */
 
+#include "vglx/utilities/allocation_tracker.hpp"
+#include "vglx/utilities/fixed_timestep.hpp"
+#include "vglx/utilities/frame_profile.hpp"
 #include "vglx/utilities/frame_timer.hpp"
 #include "vglx/utilities/stats.hpp"
-#include "vglx/utilities/timer.hpp"
\ No newline at end of file
+#include "vglx/utilities/timer.hpp"
+#include "vglx/utilities/tracer.hpp"
\ No newline at end of file
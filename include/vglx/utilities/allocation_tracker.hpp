@@ -0,0 +1,113 @@
+/*
+===========================================================================
+  VGLX https://vglx.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#pragma once
+
+#include "vglx_export.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace vglx {
+
+/**
+ * @brief Counts heap allocations made through the global `operator new`.
+ *
+ * Executables that link the `vglx_allocation_hooks` target replace the
+ * global `operator new` and `operator delete` with versions that forward to
+ * `malloc` and `free` and, while recording, count every allocation and its
+ * size. The engine itself never replaces them. The target is installed with
+ * the engine, so applications opt in with
+ * `target_link_libraries(MyApp PRIVATE vglx::vglx_allocation_hooks)`; the
+ * tests, benchmarks and examples link it when
+ * `VGLX_ENABLE_ALLOCATION_TRACKING` is on.
+ *
+ * Counts are kept per thread and summed across all threads. The renderer
+ * attributes allocations to each @ref ProfilePhase by reading them at phase
+ * boundaries, the same way it measures time. Phases that run jobs read the
+ * totals, so allocations on job system workers are included. Submission
+ * reads the counts of the rendering thread, which it never leaves, so the
+ * simulation running alongside it in pipelined mode is left out. The
+ * Advance phase reads the totals, so in that mode it also includes what
+ * submission allocates meanwhile. When not recording, an allocation costs a single atomic load on
+ * top of `malloc`, and while recording, two relaxed atomic additions.
+ *
+ * Frame profiles report the allocations in
+ * @ref ProfileCounter::Allocations and @ref FrameProfile::phase_allocations,
+ * which @ref Stats keeps a history of. Direct calls to `malloc` are not
+ * counted.
+ *
+ * @code
+ * vglx::AllocationTracker::Start();
+ * renderer.Render(scene.get(), camera.get());
+ * const auto& profile = renderer.GetFrameProfile();
+ * assert(profile[vglx::ProfileCounter::Allocations] == 0);
+ * @endcode
+ *
+ * @note Replacing the global allocation functions affects the whole
+ * program, so do not link the hooks into applications that provide their
+ * own replacements or run under a sanitizer that does.
+ *
+ * @ingroup UtilitiesGroup
+ */
+class VGLX_EXPORT AllocationTracker {
+public:
+    /// @brief Number and total size of allocations.
+    struct Counts {
+        uint64_t allocations {0}; ///< Number of allocations.
+        uint64_t bytes {0}; ///< Total bytes requested.
+
+        /// @brief Returns the allocations made between two readings.
+        [[nodiscard]] auto operator-(const Counts& other) const -> Counts {
+            return {allocations - other.allocations, bytes - other.bytes};
+        }
+    };
+
+    /**
+     * @brief Returns true if the program links the allocation hooks.
+     */
+    [[nodiscard]] static auto IsSupported() -> bool;
+
+    /**
+     * @brief Starts counting allocations on every thread.
+     */
+    static auto Start() -> void;
+
+    /**
+     * @brief Stops counting allocations. Counts are kept.
+     */
+    static auto Stop() -> void;
+
+    /**
+     * @brief Returns true while allocations are being counted.
+     */
+    [[nodiscard]] static auto IsRecording() -> bool;
+
+    /**
+     * @brief Returns the allocations counted on the calling thread so far.
+     *
+     * Counts only increase; subtract two readings to get the allocations
+     * made in between.
+     */
+    [[nodiscard]] static auto ThreadCounts() -> Counts;
+
+    /**
+     * @brief Returns the allocations counted on all threads so far.
+     *
+     * Counts only increase; subtract two readings to get the allocations
+     * made in between by any thread.
+     */
+    [[nodiscard]] static auto TotalCounts() -> Counts;
+
+    /// @cond INTERNAL
+    static auto Install() -> bool;
+
+    static auto Record(std::size_t size) -> void;
+    /// @endcond
+};
+
+}
\ No newline at end of file
@@ -0,0 +1,119 @@
+/*
+===========================================================================
+  VGLX https://vglx.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#pragma once
+
+#include "vglx_export.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace vglx {
+
+/**
+ * @brief Accumulator that converts variable frame deltas into fixed steps.
+ *
+ * Each call to @ref Accumulate adds the elapsed frame time to an internal
+ * accumulator and returns how many whole simulation steps fit into it. The
+ * remainder carries over to the next frame and is exposed through @ref Alpha
+ * as the fraction of a step the renderer is ahead of the last simulated
+ * state, which is used to interpolate between the last two states.
+ *
+ * To avoid falling further behind when a frame takes longer than the steps
+ * it produces, the number of steps per call is capped. Time beyond the cap is
+ * dropped, so the simulation slows down instead of stalling the frame.
+ *
+ * @code
+ * auto timestep = vglx::FixedTimestep {1.0f / 30.0f};
+ * while (running) {
+ *   const auto steps = timestep.Accumulate(frame_timer.Tick());
+ *   for (auto i = 0; i < steps; ++i) {
+ *     scene.StoreTransformHistory();
+ *     scene.Advance(timestep.Step());
+ *   }
+ *   scene.InterpolateTransformHierarchy(timestep.Alpha());
+ *   renderer.Render(&scene, &camera);
+ * }
+ * @endcode
+ *
+ * @ingroup UtilitiesGroup
+ */
+class VGLX_EXPORT FixedTimestep {
+public:
+    /// @brief Shortest step accepted, in seconds.
+    static constexpr auto kMinStep = 1e-6f;
+
+    /**
+     * @brief Constructs a fixed timestep.
+     *
+     * @param step Duration of a simulation step in seconds, raised to
+     * @ref kMinStep if shorter.
+     * @param max_steps Maximum number of steps returned by a single call to
+     * @ref Accumulate.
+     */
+    explicit FixedTimestep(float step, int max_steps = 5)
+      : step_(std::max(kMinStep, step)), max_steps_(std::max(max_steps, 1)) {}
+
+    /**
+     * @brief Adds a frame delta and returns the number of steps to simulate.
+     *
+     * @param delta Elapsed frame time in seconds. Negative and non-finite
+     * values are ignored.
+     */
+    [[nodiscard]] auto Accumulate(float delta) -> int {
+        if (std::isfinite(delta) && delta > 0.0f) accumulator_ += delta;
+
+        // Clamped before the conversion so that a huge delta cannot overflow
+        // the step count.
+        const auto available = std::min(
+            accumulator_ / step_,
+            static_cast<double>(max_steps_) + 1.0
+        );
+        const auto steps = std::min(static_cast<int>(available), max_steps_);
+        accumulator_ -= static_cast<double>(steps) * step_;
+
+        if (available > max_steps_) {
+            accumulator_ = std::fmod(accumulator_, static_cast<double>(step_));
+        }
+
+        return steps;
+    }
+
+    /**
+     * @brief Returns the leftover fraction of a step, in $[0, 1)$.
+     */
+    [[nodiscard]] auto Alpha() const -> float {
+        return static_cast<float>(accumulator_ / step_);
+    }
+
+    /**
+     * @brief Returns the duration of a simulation step in seconds.
+     */
+    [[nodiscard]] auto Step() const -> float { return step_; }
+
+    /**
+     * @brief Returns the maximum number of steps per call to @ref Accumulate.
+     */
+    [[nodiscard]] auto MaxSteps() const -> int { return max_steps_; }
+
+    /**
+     * @brief Discards any accumulated time.
+     */
+    auto Reset() -> void { accumulator_ = 0.0; }
+
+private:
+    /// @brief Duration of a simulation step in seconds.
+    float step_;
+
+    /// @brief Maximum number of steps per accumulation.
+    int max_steps_;
+
+    /// @brief Simulation time not yet consumed by a step, in seconds.
+    double accumulator_ {0.0};
+};
+
+}
\ No newline at end of file
@@ -0,0 +1,232 @@
+/*
+===========================================================================
+  VGLX https://vglx.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <utility>
+
+namespace vglx {
+
+/**
+ * @brief CPU phases of a frame measured by the @ref FrameProfile.
+ *
+ * @ingroup UtilitiesGroup
+ */
+enum class ProfilePhase {
+    Advance, ///< Scene and node updates.
+    TransformUpdate, ///< World transform propagation.
+    Cull, ///< Scene traversal and frustum culling.
+    Occlusion, ///< Occluder rasterization and occlusion tests, see @ref Renderer::Parameters::occlusion_culling.
+    Sort, ///< Depth sorting of the render lists.
+    Extract, ///< Draw item extraction and buffer uploads.
+    ProgramResolve, ///< Shader program lookup for each draw, with @ref Renderer::Parameters::draw_phase_timers.
+    UniformUpload, ///< Uniform and texture binding for each draw, with @ref Renderer::Parameters::draw_phase_timers.
+    DrawSubmit, ///< Render state changes and draw calls, or all of draw submission without @ref Renderer::Parameters::draw_phase_timers.
+    Count ///< Number of phases.
+};
+
+/**
+ * @brief Per-frame counters recorded by the @ref FrameProfile.
+ *
+ * @ingroup UtilitiesGroup
+ */
+enum class ProfileCounter {
+    DrawCalls, ///< Draw calls issued.
+    Triangles, ///< Triangles submitted, including instances.
+    OccludedObjects, ///< Renderables in the view frustum hidden behind occluders or by occlusion queries.
+    OcclusionQueries, ///< GPU occlusion queries issued.
+    ProgramSwitches, ///< Shader program binds.
+    VertexArraySwitches, ///< Vertex array object binds.
+    TextureSwitches, ///< Texture binds.
+    UploadedBytes, ///< Bytes uploaded to vertex, index, instance, texture and uniform buffers.
+    Allocations, ///< Heap allocations of the frame, see @ref AllocationTracker.
+    AllocatedBytes, ///< Bytes allocated by the frame, see @ref AllocationTracker.
+    Count ///< Number of counters.
+};
+
+/**
+ * @brief GPU passes of a frame timed by the @ref FrameProfile.
+ *
+ * @ingroup UtilitiesGroup
+ */
+enum class GpuPass {
+    Clear, ///< Framebuffer clear.
+    DepthPrepass, ///< Depth-only draws of the depth pre-pass.
+    Opaque, ///< Opaque draws.
+    Transparent, ///< Transparent draws.
+    UI, ///< User interface overlay.
+    Count ///< Number of passes.
+};
+
+/**
+ * @brief Returns the display name of a profile phase.
+ *
+ * @related ProfilePhase
+ */
+[[nodiscard]] constexpr auto GetName(ProfilePhase phase) -> std::string_view {
+    using enum ProfilePhase;
+    switch (phase) {
+        case Advance: return "Advance";
+        case TransformUpdate: return "Transform update";
+        case Cull: return "Cull";
+        case Occlusion: return "Occlusion";
+        case Sort: return "Sort";
+        case Extract: return "Extract";
+        case ProgramResolve: return "Program resolve";
+        case UniformUpload: return "Uniform upload";
+        case DrawSubmit: return "Draw submit";
+        default: return "Unknown";
+    }
+}
+
+/**
+ * @brief Returns the display name of a profile counter.
+ *
+ * @related ProfileCounter
+ */
+[[nodiscard]] constexpr auto GetName(ProfileCounter counter) -> std::string_view {
+    using enum ProfileCounter;
+    switch (counter) {
+        case DrawCalls: return "Draw calls";
+        case Triangles: return "Triangles";
+        case OccludedObjects: return "Occluded objects";
+        case OcclusionQueries: return "Occlusion queries";
+        case ProgramSwitches: return "Program switches";
+        case VertexArraySwitches: return "VAO switches";
+        case TextureSwitches: return "Texture switches";
+        case UploadedBytes: return "Uploaded bytes";
+        case Allocations: return "Allocations";
+        case AllocatedBytes: return "Allocated bytes";
+        default: return "Unknown";
+    }
+}
+
+/**
+ * @brief Returns the display name of a GPU pass.
+ *
+ * @related GpuPass
+ */
+[[nodiscard]] constexpr auto GetName(GpuPass pass) -> std::string_view {
+    using enum GpuPass;
+    switch (pass) {
+        case Clear: return "Clear";
+        case DepthPrepass: return "Depth pre-pass";
+        case Opaque: return "Opaque";
+        case Transparent: return "Transparent";
+        case UI: return "UI";
+        default: return "Unknown";
+    }
+}
+
+/**
+ * @brief CPU phase timings, GPU pass timings and counters of a single frame.
+ *
+ * The renderer fills a profile for every frame it renders, which can be read
+ * with @ref Renderer::GetFrameProfile and recorded by @ref Stats.
+ *
+ * GPU timings are measured with timer queries that are read back a few
+ * frames later so the CPU never waits for the GPU. They therefore belong to
+ * an earlier frame, @ref gpu_latency frames before the one the CPU timings
+ * describe, and are only present when @ref gpu_latency is not zero.
+ *
+ * While the @ref AllocationTracker is recording, the heap allocations of
+ * each phase are counted alongside its time, which makes allocations in
+ * steady-state frames easy to trace back to their source.
+ *
+ * @ingroup UtilitiesGroup
+ */
+struct FrameProfile {
+    static constexpr auto kPhaseCount = std::to_underlying(ProfilePhase::Count);
+    static constexpr auto kCounterCount = std::to_underlying(ProfileCounter::Count);
+    static constexpr auto kGpuPassCount = std::to_underlying(GpuPass::Count);
+
+    /// @brief Time spent in each phase, in milliseconds.
+    std::array<double, kPhaseCount> phase_ms {};
+
+    /// @brief Value of each counter.
+    std::array<uint64_t, kCounterCount> counters {};
+
+    /// @brief GPU time of each pass, in milliseconds.
+    std::array<double, kGpuPassCount> gpu_ms {};
+
+    /// @brief Heap allocations made in each phase, while the @ref AllocationTracker is recording.
+    std::array<uint64_t, kPhaseCount> phase_allocations {};
+
+    /// @brief Number of frames the GPU timings lag behind, or zero if none completed.
+    uint32_t gpu_latency {0};
+
+    /**
+     * @brief Estimated opaque GPU time saved by the depth pre-pass, in milliseconds.
+     *
+     * The difference between the opaque pass of frames drawn without the
+     * pre-pass, which the renderer samples once every 60 frames while GPU
+     * pass timers are enabled, and the pre-pass and opaque pass together. It
+     * is negative when the pre-pass costs more than the overdraw it avoids,
+     * and zero until both have been measured.
+     */
+    double depth_prepass_saved_ms {0.0};
+
+    /**
+     * @brief Returns the time spent in a phase, in milliseconds.
+     */
+    [[nodiscard]] auto operator[](ProfilePhase phase) -> double& {
+        return phase_ms[std::to_underlying(phase)];
+    }
+
+    /**
+     * @brief Returns the time spent in a phase, in milliseconds.
+     */
+    [[nodiscard]] auto operator[](ProfilePhase phase) const -> double {
+        return phase_ms[std::to_underlying(phase)];
+    }
+
+    /**
+     * @brief Returns the value of a counter.
+     */
+    [[nodiscard]] auto operator[](ProfileCounter counter) -> uint64_t& {
+        return counters[std::to_underlying(counter)];
+    }
+
+    /**
+     * @brief Returns the value of a counter.
+     */
+    [[nodiscard]] auto operator[](ProfileCounter counter) const -> uint64_t {
+        return counters[std::to_underlying(counter)];
+    }
+
+    /**
+     * @brief Returns the GPU time of a pass, in milliseconds.
+     */
+    [[nodiscard]] auto operator[](GpuPass pass) -> double& {
+        return gpu_ms[std::to_underlying(pass)];
+    }
+
+    /**
+     * @brief Returns the GPU time of a pass, in milliseconds.
+     */
+    [[nodiscard]] auto operator[](GpuPass pass) const -> double {
+        return gpu_ms[std::to_underlying(pass)];
+    }
+
+    /**
+     * @brief Clears all timings and counters.
+     */
+    auto Reset() -> void {
+        phase_ms.fill(0.0);
+        counters.fill(0);
+        gpu_ms.fill(0.0);
+        phase_allocations.fill(0);
+        gpu_latency = 0;
+        depth_prepass_saved_ms = 0.0;
+    }
+};
+
+}
\ No newline at end of file
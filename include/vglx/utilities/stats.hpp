@@ -9,6 +9,9 @@
 
 #include "vglx_export.h"
 
+#include "vglx/utilities/frame_profile.hpp"
+
+#include <cstddef>
 #include <memory>
 
 namespace vglx {
@@ -21,13 +24,32 @@ namespace vglx {
  * "show_stats" is set to true to provide an on-screen performance overlay
  * during development and debugging.
  *
+ * When given the renderer's @ref FrameProfile, it also acts as a frame
+ * profiler: the CPU time of each @ref ProfilePhase and the value of each
+ * @ref ProfileCounter are kept for the last @ref kHistorySize frames in
+ * fixed-size ring buffers, and can be summarized over any window of recent
+ * frames with @ref Query, without going through the overlay.
+ *
+ * GPU timings of each @ref GpuPass are recorded alongside the CPU phases
+ * whenever the profile carries them. Since they are read back with a delay
+ * of a few frames, the GPU history covers the frames whose timer queries
+ * completed rather than the most recent ones; compare the CPU frame time
+ * against the summed GPU passes to tell whether a frame is GPU-bound.
+ *
+ * Heap allocations per frame are recorded as @ref ProfileCounter::Allocations
+ * and per phase with @ref QueryAllocations, and are non-zero only while the
+ * @ref AllocationTracker is recording.
+ *
  * @code
  * while (running) {
  *   stats.BeforeRender();
  *   renderer.Render(scene, camera);
- *   stats.AfterRender(renderer.RenderedObjectsPerFrame());
+ *   stats.AfterRender(renderer.RenderedObjectsPerFrame(), renderer.GetFrameProfile());
  *   stats.Draw();
  * }
+ *
+ * const auto cull = stats.Query(vglx::ProfilePhase::Cull, 120);
+ * dashboard.Plot("cull p99", cull.p99);
  * @endcode
  *
  * This overlay currently requires [ImGui](https://github.com/ocornut/imgui) support.
@@ -36,8 +58,21 @@ namespace vglx {
  *
  * @ingroup UtilitiesGroup
  */
-class Stats {
+class VGLX_EXPORT Stats {
 public:
+    /// @brief Number of frames kept in the profiler history.
+    static constexpr auto kHistorySize = size_t {600};
+
+    /**
+     * @brief Summary of a metric over a window of frames.
+     */
+    struct Summary {
+        double min {0.0}; ///< Smallest value in the window.
+        double avg {0.0}; ///< Mean value over the window.
+        double p99 {0.0}; ///< 99th percentile of the window.
+        size_t frames {0}; ///< Number of frames summarized.
+    };
+
     /**
      * @brief Constructs a stats object.
      */
@@ -62,11 +97,70 @@ public:
      */
     auto AfterRender(unsigned n_objects) -> void;
 
+    /**
+     * @brief Marks the end of a frame render and records its profile.
+     *
+     * @param n_objects Number of objects rendered in the frame.
+     * @param profile Phase timings and counters of the frame, typically from
+     * @ref Renderer::GetFrameProfile.
+     */
+    auto AfterRender(unsigned n_objects, const FrameProfile& profile) -> void;
+
+    /**
+     * @brief Summarizes the frame time over the most recent frames.
+     *
+     * @param window Number of frames to summarize, clamped to the recorded
+     * history.
+     */
+    [[nodiscard]] auto FrameTime(size_t window = kHistorySize) const -> Summary;
+
+    /**
+     * @brief Summarizes the time of a phase over the most recent frames.
+     *
+     * @param phase Phase to summarize, in milliseconds.
+     * @param window Number of frames to summarize, clamped to the recorded
+     * history.
+     */
+    [[nodiscard]] auto Query(ProfilePhase phase, size_t window = kHistorySize) const -> Summary;
+
+    /**
+     * @brief Summarizes the GPU time of a pass over the most recent timed frames.
+     *
+     * @param pass Pass to summarize, in milliseconds.
+     * @param window Number of timed frames to summarize, clamped to the
+     * recorded history.
+     */
+    [[nodiscard]] auto Query(GpuPass pass, size_t window = kHistorySize) const -> Summary;
+
+    /**
+     * @brief Summarizes a counter over the most recent frames.
+     *
+     * @param counter Counter to summarize.
+     * @param window Number of frames to summarize, clamped to the recorded
+     * history.
+     */
+    [[nodiscard]] auto Query(ProfileCounter counter, size_t window = kHistorySize) const -> Summary;
+
+    /**
+     * @brief Summarizes the heap allocations of a phase over the most recent frames.
+     *
+     * @param phase Phase to summarize, in allocations per frame.
+     * @param window Number of frames to summarize, clamped to the recorded
+     * history.
+     */
+    [[nodiscard]] auto QueryAllocations(ProfilePhase phase, size_t window = kHistorySize) const -> Summary;
+
+    /**
+     * @brief Returns the profile recorded for the most recent frame.
+     */
+    [[nodiscard]] auto LastProfile() const -> const FrameProfile&;
+
     /**
      * @brief Draws the performance overlay.
      *
      * Renders a window containing FPS, frame time, and rendered object
-     * histograms.
+     * histograms, followed by the average CPU phase and GPU pass timings and
+     * the counters of the last frame.
      */
     auto Draw() const -> void;
 
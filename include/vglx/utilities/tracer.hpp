@@ -0,0 +1,175 @@
+/*
+===========================================================================
+  VGLX https://vglx.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#pragma once
+
+#include "vglx_export.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+#include <filesystem>
+#include <limits>
+#include <string>
+#include <string_view>
+
+#define VGLX_TRACE_CONCAT_IMPL(a, b) a##b
+#define VGLX_TRACE_CONCAT(a, b) VGLX_TRACE_CONCAT_IMPL(a, b)
+
+/**
+ * @brief Records a trace zone from this line to the end of the enclosing scope.
+ *
+ * Expands to nothing unless the engine is built with `VGLX_ENABLE_TRACING`.
+ * The name must be a string literal or otherwise outlive the trace.
+ *
+ * @ingroup UtilitiesGroup
+ */
+#ifdef VGLX_TRACING
+#define VGLX_TRACE_ZONE(name) \
+    const auto VGLX_TRACE_CONCAT(vglx_trace_zone_, __LINE__) = ::vglx::TraceZone {name}
+#else
+#define VGLX_TRACE_ZONE(name) static_cast<void>(0)
+#endif
+
+namespace vglx {
+
+/**
+ * @brief Records timed zones from every thread and exports them as a trace.
+ *
+ * Zones are recorded with @ref VGLX_TRACE_ZONE, or directly with a
+ * @ref TraceZone. While recording, each finished zone is appended to a buffer
+ * owned by the thread that ran it, tagged with the thread and the frame it
+ * started in. Each buffer keeps the most recent @ref kMaxEventsPerThread
+ * zones, so a long capture overwrites its oldest zones instead of growing
+ * without bound. When not recording, a zone costs a call and an atomic load.
+ * Trace zones are only compiled in when the engine is built with
+ * `VGLX_ENABLE_TRACING`, which is off by default.
+ *
+ * The engine instruments rendering, scene processing, loaders and shader
+ * compilation, and @ref Application advances the frame number once per
+ * frame. The recorded zones can be exported in the Chrome Trace Event format
+ * and opened in `chrome://tracing` or [Perfetto](https://ui.perfetto.dev).
+ *
+ * @code
+ * vglx::Tracer::Start();
+ * // run some frames...
+ * vglx::Tracer::Stop();
+ * auto result = vglx::Tracer::Export("frames.json", first_frame, last_frame);
+ * @endcode
+ *
+ * @ingroup UtilitiesGroup
+ */
+class VGLX_EXPORT Tracer {
+public:
+    /// @brief Frame number of the last frame when exporting a range.
+    static constexpr auto kLastFrame = std::numeric_limits<uint32_t>::max();
+
+    /// @brief Zones each thread keeps while recording before overwriting its oldest.
+    static constexpr auto kMaxEventsPerThread = size_t {1} << 18;
+
+    /**
+     * @brief Discards recorded zones and starts recording.
+     */
+    static auto Start() -> void;
+
+    /**
+     * @brief Stops recording. Zones that are still open are recorded when
+     * they close.
+     */
+    static auto Stop() -> void;
+
+    /**
+     * @brief Returns true while zones are being recorded.
+     */
+    [[nodiscard]] static auto IsRecording() -> bool;
+
+    /**
+     * @brief Advances the frame number zones are tagged with.
+     */
+    static auto NextFrame() -> void;
+
+    /**
+     * @brief Returns the current frame number.
+     */
+    [[nodiscard]] static auto CurrentFrame() -> uint32_t;
+
+    /**
+     * @brief Names the calling thread in exported traces.
+     *
+     * @param name Thread name.
+     */
+    static auto SetThreadName(std::string_view name) -> void;
+
+    /**
+     * @brief Serializes recorded zones to Chrome Trace Event JSON.
+     *
+     * @param first_frame First frame to include.
+     * @param last_frame Last frame to include.
+     */
+    [[nodiscard]] static auto ToJson(
+        uint32_t first_frame = 0,
+        uint32_t last_frame = kLastFrame
+    ) -> std::string;
+
+    /**
+     * @brief Writes recorded zones to a Chrome Trace Event JSON file.
+     *
+     * @param path Output file path.
+     * @param first_frame First frame to include.
+     * @param last_frame Last frame to include.
+     */
+    [[nodiscard]] static auto Export(
+        const std::filesystem::path& path,
+        uint32_t first_frame = 0,
+        uint32_t last_frame = kLastFrame
+    ) -> std::expected<void, std::string>;
+
+    /// @cond INTERNAL
+    [[nodiscard]] static auto Now() -> int64_t;
+
+    static auto Record(const char* name, int64_t start, uint32_t frame) -> void;
+    /// @endcond
+};
+
+/**
+ * @brief RAII zone recorded by the @ref Tracer from construction to destruction.
+ *
+ * Prefer @ref VGLX_TRACE_ZONE, which compiles to nothing when tracing is
+ * disabled.
+ *
+ * @ingroup UtilitiesGroup
+ */
+class TraceZone {
+public:
+    /**
+     * @brief Opens a zone.
+     *
+     * @param name Zone name, which must outlive the trace.
+     */
+    explicit TraceZone(const char* name) : name_(name) {
+        if (Tracer::IsRecording()) {
+            frame_ = Tracer::CurrentFrame();
+            start_ = Tracer::Now();
+        }
+    }
+
+    TraceZone(const TraceZone&) = delete;
+    auto operator=(const TraceZone&) -> TraceZone& = delete;
+
+    ~TraceZone() {
+        if (start_ >= 0) Tracer::Record(name_, start_, frame_);
+    }
+
+private:
+    const char* name_;
+
+    int64_t start_ {-1};
+
+    uint32_t frame_ {0};
+};
+
+}
\ No newline at end of file
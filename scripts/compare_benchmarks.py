@@ -0,0 +1,95 @@
+#!/usr/bin/env python3
+
+"""Compares two sets of Google Benchmark JSON results.
+
+Each argument is either a single JSON file written with
+--benchmark_out_format=json or a directory of them, as produced by
+scripts/run_benchmarks.sh. Benchmarks are matched by name and compared by
+real time. The script exits with a non-zero status when any benchmark is
+slower than the baseline by more than the threshold.
+"""
+
+import argparse
+import json
+import sys
+from pathlib import Path
+
+
+def load_results(path):
+    files = sorted(path.glob("*.json")) if path.is_dir() else [path]
+    results = {}
+    for file in files:
+        with open(file) as f:
+            data = json.load(f)
+        for benchmark in data.get("benchmarks", []):
+            # Skip aggregates other than the mean when repetitions were used.
+            if benchmark.get("run_type") == "aggregate" and benchmark.get("aggregate_name") != "mean":
+                continue
+            if "error_occurred" in benchmark:
+                continue
+            results[benchmark["name"]] = benchmark
+    return results
+
+
+def to_ns(benchmark):
+    scale = {"ns": 1.0, "us": 1e3, "ms": 1e6, "s": 1e9}
+    return benchmark["real_time"] * scale[benchmark.get("time_unit", "ns")]
+
+
+def format_time(ns):
+    for unit, scale in (("s", 1e9), ("ms", 1e6), ("us", 1e3)):
+        if ns >= scale:
+            return f"{ns / scale:.3f} {unit}"
+    return f"{ns:.1f} ns"
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("baseline", type=Path, help="Baseline JSON file or directory")
+    parser.add_argument("current", type=Path, help="Current JSON file or directory")
+    parser.add_argument(
+        "--threshold",
+        type=float,
+        default=0.10,
+        help="Relative slowdown reported as a regression (default: 0.10)"
+    )
+    args = parser.parse_args()
+
+    baseline = load_results(args.baseline)
+    current = load_results(args.current)
+    names = [name for name in current if name in baseline]
+    if not names:
+        print("No common benchmarks to compare")
+        return 1
+
+    width = max(len(name) for name in names)
+    print(f"{'Benchmark':<{width}}  {'Baseline':>12}  {'Current':>12}  {'Change':>8}")
+
+    regressions = []
+    for name in names:
+        old = to_ns(baseline[name])
+        new = to_ns(current[name])
+        change = (new - old) / old if old > 0 else 0.0
+        marker = ""
+        if change > args.threshold:
+            marker = "  regression"
+            regressions.append(name)
+        elif change < -args.threshold:
+            marker = "  improvement"
+        print(
+            f"{name:<{width}}  {format_time(old):>12}  {format_time(new):>12}  "
+            f"{change * 100:>+7.1f}%{marker}"
+        )
+
+    missing = sorted(set(baseline) - set(current))
+    if missing:
+        print(f"\n{len(missing)} baseline benchmarks missing from the current results")
+
+    if regressions:
+        print(f"\n{len(regressions)} benchmarks regressed by more than {args.threshold * 100:.0f}%")
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,35 @@
+#!/usr/bin/env sh
+
+set -e  # Exit on error
+
+BUILD_DIR=${1:-build/bench}
+OUT_DIR=${2:-$BUILD_DIR/benchmark_results}
+if [ $# -ge 2 ]; then shift 2; else shift $#; fi
+
+# Ensure build directory exists and CMake is configured
+if [ ! -f "$BUILD_DIR/Makefile" ] && [ ! -f "$BUILD_DIR/build.ninja" ]; then
+    echo "Configuring CMake"
+    cmake -S . -B "$BUILD_DIR" \
+        -D CMAKE_BUILD_TYPE=Release \
+        -D VGLX_BUILD_BENCHMARKS=ON \
+        -D VGLX_BUILD_EXAMPLES=OFF \
+        -D VGLX_BUILD_TESTS=OFF
+fi
+
+cmake --build "$BUILD_DIR" --config Release
+
+mkdir -p "$OUT_DIR"
+
+# Each benchmark binary writes its results as JSON; any remaining arguments
+# are forwarded, e.g. --benchmark_filter=RenderLists
+for BENCHMARK in "$BUILD_DIR"/benchmarks/bench_*; do
+    [ -x "$BENCHMARK" ] || continue
+    NAME=$(basename "$BENCHMARK")
+    echo "Running $NAME"
+    "$BENCHMARK" \
+        --benchmark_out="$OUT_DIR/$NAME.json" \
+        --benchmark_out_format=json \
+        "$@"
+done
+
+echo "Results written to $OUT_DIR"
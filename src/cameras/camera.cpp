@@ -10,6 +10,11 @@
 namespace vglx {
 
 auto Camera::UpdateViewMatrix() -> void {
+    if (IsInterpolated()) {
+        this->view_matrix = Inverse(GetRenderTransform());
+        return;
+    }
+
     if (ShouldUpdateWorldTransform()) {
         UpdateWorldTransform();
         this->view_matrix = Inverse(GetWorldTransform());
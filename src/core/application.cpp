@@ -8,17 +8,26 @@
 #include "vglx/core/application.hpp"
 
 #include "vglx/cameras/perspective_camera.hpp"
+#include "vglx/core/job_system.hpp"
+#include "vglx/core/offscreen_context.hpp"
 #include "vglx/core/renderer.hpp"
 #include "vglx/core/shared_context.hpp"
 #include "vglx/core/window.hpp"
+#include "vglx/utilities/allocation_tracker.hpp"
+#include "vglx/utilities/fixed_timestep.hpp"
 #include "vglx/utilities/frame_timer.hpp"
 #include "vglx/utilities/stats.hpp"
+#include "vglx/utilities/timer.hpp"
+#include "vglx/utilities/tracer.hpp"
 
+#include "core/render_lists.hpp"
 #include "utilities/logger.hpp"
 
 #include <algorithm>
 #include <expected>
+#include <optional>
 #include <string>
+#include <vector>
 
 namespace vglx {
 
@@ -41,10 +50,29 @@ struct Application::Impl {
     std::shared_ptr<Scene> scene;
     std::shared_ptr<Camera> camera;
     std::unique_ptr<Window> window;
+    std::unique_ptr<OffscreenContext> offscreen_context;
     std::unique_ptr<Renderer> renderer;
     std::unique_ptr<SharedContext> context;
 
-    double last_frame_time = 0.0;
+    std::optional<FixedTimestep> fixed_timestep;
+
+    RenderLists render_lists;
+
+    std::vector<Application::FrameTiming> frame_timings;
+
+    Timer frame_clock {false};
+
+    double frame_start = 0.0;
+    double update_end = 0.0;
+    double advance_ms = 0.0;
+    uint64_t advance_allocations = 0;
+
+    float simulated_delta = 0.0f;
+
+    int frame_limit = 0;
+    int frame_count = 0;
+
+    bool close_requested = false;
 
     auto InitializeWindow(const Application::Parameters& params) -> std::expected<void, std::string> {
         window = std::make_unique<Window>(Window::Parameters{
@@ -52,29 +80,54 @@ struct Application::Impl {
             .width = params.width,
             .height = params.height,
             .antialiasing = params.antialiasing,
-            .vsync = params.vsync
+            .vsync = params.vsync,
+            .visible = params.mode == Application::Mode::Windowed
         });
         return window->Initialize();
     }
 
+    auto InitializeOffscreenContext() -> std::expected<void, std::string> {
+        offscreen_context = std::make_unique<OffscreenContext>();
+        auto result = offscreen_context->Initialize();
+        if (!result) offscreen_context.reset();
+        return result;
+    }
+
     auto InitializeRenderer(const Application::Parameters& params) -> std::expected<void, std::string> {
         renderer = std::make_unique<Renderer>(Renderer::Parameters {
-            .framebuffer_width = window->FramebufferWidth(),
-            .framebuffer_height = window->FramebufferHeight(),
-            .clear_color = params.clear_color
+            .framebuffer_width = window ? window->FramebufferWidth() : params.width,
+            .framebuffer_height = window ? window->FramebufferHeight() : params.height,
+            .clear_color = params.clear_color,
+            .offscreen = window == nullptr,
+            .gpu_material_timers = params.gpu_material_timers,
+            .draw_phase_timers = params.draw_phase_timers,
+            .occlusion_culling = params.occlusion_culling,
+            .occlusion_debug_view = params.occlusion_debug_view,
+            .occlusion_queries = params.occlusion_queries,
+            .depth_prepass = params.depth_prepass,
+            .capture_path = params.capture_path
         });
         return renderer->Initialize();
     }
 
-    auto MakeSharedContext() -> void {
-        context = std::make_unique<SharedContext> (
+    auto MakeSharedContext(const Application::Parameters& params) -> void {
+        context = window ? std::make_unique<SharedContext> (
             camera.get(),
             window->AspectRatio(),
             window->FramebufferWidth(),
             window->FramebufferHeight(),
             window->Width(),
             window->Height()
+        ) : std::make_unique<SharedContext> (
+            camera.get(),
+            static_cast<float>(params.width) / params.height,
+            params.width,
+            params.height,
+            params.width,
+            params.height
         );
+        context->jobs = JobSystem::Create();
+        if (renderer) renderer->SetJobSystem(context->jobs);
     }
 
     auto SetCamera(std::shared_ptr<Camera> camera) -> void {
@@ -92,30 +145,166 @@ struct Application::Impl {
         this->scene = scene;
         this->scene->SetContext(context.get());
     }
+
+    auto Advance(float delta) -> void {
+        VGLX_TRACE_ZONE("Advance");
+        const auto start = Now();
+        const auto allocations = AllocationTracker::TotalCounts();
+        if (!fixed_timestep) {
+            scene->Advance(delta);
+        } else {
+            const auto steps = fixed_timestep->Accumulate(delta);
+            for (auto i = 0; i < steps; ++i) {
+                scene->StoreTransformHistory();
+                if (camera->GetScene() != scene.get()) {
+                    camera->StoreTransformHistory();
+                }
+                scene->Advance(fixed_timestep->Step());
+            }
+        }
+        advance_ms = Now() - start;
+        advance_allocations = (AllocationTracker::TotalCounts() - allocations).allocations;
+    }
+
+    auto EndUIFrame() -> void {
+        renderer->BeginGpuPass(GpuPass::UI);
+        window->EndUIFrame();
+        renderer->EndGpuPass(GpuPass::UI);
+    }
+
+    auto RecordStats(Stats& stats, double advance, uint64_t allocations) const -> void {
+        auto profile = renderer->GetFrameProfile();
+        profile[ProfilePhase::Advance] = advance;
+        profile.phase_allocations[std::to_underlying(ProfilePhase::Advance)] = allocations;
+        stats.AfterRender(renderer->RenderedObjectsPerFrame(), profile);
+    }
+
+    auto Tick(FrameTimer& frame_timer) -> float {
+        const auto dt = frame_timer.Tick(kMaxDelta);
+        return simulated_delta > 0.0f ? simulated_delta : dt;
+    }
+
+    auto Running() -> bool {
+        if (frame_limit > 0 && frame_count >= frame_limit) return false;
+        return window ? !window->ShouldClose() : !close_requested;
+    }
+
+    auto RequestClose() -> void {
+        if (window) window->RequestClose();
+        close_requested = true;
+    }
+
+    auto Cull() -> unsigned {
+        VGLX_TRACE_ZONE("Cull");
+        {
+            VGLX_TRACE_ZONE("UpdateTransformHierarchy");
+            scene->UpdateTransformHierarchy();
+        }
+        camera->UpdateViewMatrix();
+        render_lists.ProcessScene(scene.get(), camera.get());
+        return static_cast<unsigned>(
+            render_lists.Opaque().size() + render_lists.Transparent().size()
+        );
+    }
+
+    auto Now() const -> double {
+        // Millisecond precision from the timer is too coarse for frame timings.
+        return frame_clock.GetElapsedSeconds() * 1000.0;
+    }
+
+    auto BeginFrame() -> void {
+        Tracer::NextFrame();
+        frame_start = Now();
+    }
+
+    auto EndUpdate() -> void {
+        update_end = Now();
+    }
+
+    auto EndFrame(float delta, double render_ms, unsigned rendered_objects) -> void {
+        ++frame_count;
+        if (frame_limit == 0) return;
+
+        frame_timings.emplace_back(Application::FrameTiming {
+            .delta = delta,
+            .update_ms = update_end - frame_start,
+            .render_ms = render_ms,
+            .frame_ms = Now() - frame_start,
+            .rendered_objects = rendered_objects
+        });
+    }
+
+    auto LogFrameTimings() const -> void {
+        if (frame_timings.empty()) return;
+
+        auto total = 0.0;
+        auto min = frame_timings.front().frame_ms;
+        auto max = min;
+        for (const auto& timing : frame_timings) {
+            total += timing.frame_ms;
+            min = std::min(min, timing.frame_ms);
+            max = std::max(max, timing.frame_ms);
+        }
+
+        VGLX_LOG(
+            LogLevel::Info,
+            "Ran {} frames, frame time avg {:.3f} ms, min {:.3f} ms, max {:.3f} ms",
+            frame_timings.size(), total / frame_timings.size(), min, max
+        );
+    }
+
+    auto Interpolate() -> void {
+        if (!fixed_timestep) return;
+
+        const auto alpha = fixed_timestep->Alpha();
+        scene->InterpolateTransformHierarchy(alpha);
+        if (camera->GetScene() != scene.get()) {
+            camera->InterpolateTransformHierarchy(alpha);
+        }
+    }
 };
 
 Application::Application() : impl_(std::make_unique<Impl>()) {}
 
-auto Application::Setup() -> void {
+auto Application::Setup() -> std::expected<void, std::string> {
     const auto params = Configure();
     show_stats_ = params.show_stats;
-
-    auto init_window_result = impl_->InitializeWindow(params);
-    if (!init_window_result) {
-        Logger::Log(LogLevel::Error, "{}", init_window_result.error());
-        return;
+    pipelined_ = params.pipelined;
+    headless_ = params.mode == Mode::Headless;
+    if (params.fixed_timestep > 0.0f) {
+        impl_->fixed_timestep.emplace(params.fixed_timestep, params.max_simulation_steps);
+    }
+    impl_->simulated_delta = params.simulated_delta;
+    impl_->frame_limit = std::max(params.frame_limit, 0);
+    impl_->frame_timings.reserve(impl_->frame_limit);
+
+    if (params.mode == Mode::Offscreen && OffscreenContext::IsSupported()) {
+        auto init_context_result = impl_->InitializeOffscreenContext();
+        if (!init_context_result) {
+            VGLX_LOG(LogLevel::Warning, "{}, using a hidden window", init_context_result.error());
+        }
     }
 
-    auto init_renderer_result = impl_->InitializeRenderer(params);
-    if (!init_renderer_result) {
-        Logger::Log(LogLevel::Error, "{}", init_renderer_result.error());
-        return;
+    if (!headless_) {
+        if (!impl_->offscreen_context) {
+            auto init_window_result = impl_->InitializeWindow(params);
+            if (!init_window_result) {
+                return std::unexpected(init_window_result.error());
+            }
+        }
+
+        auto init_renderer_result = impl_->InitializeRenderer(params);
+        if (!init_renderer_result) {
+            return std::unexpected(init_renderer_result.error());
+        }
     }
 
-    impl_->MakeSharedContext();
+    impl_->MakeSharedContext(params);
     impl_->SetCamera(CreateCamera());
     impl_->SetScene(CreateScene());
 
+    if (!impl_->window) return {};
+
     impl_->window->OnResize([this](const ResizeParameters& params){
         auto context = impl_->context.get();
         context->framebuffer_width = params.framebuffer_width;
@@ -129,34 +318,148 @@ auto Application::Setup() -> void {
         );
         impl_->camera->Resize(params.window_width, params.window_height);
     });
+    return {};
 }
 
 auto Application::Start() -> void {
-    Setup();
+    // A failed setup leaves no context or scene to run, so it must not fall
+    // through to the headless loop.
+    auto setup_result = Setup();
+    if (!setup_result) {
+        VGLX_LOG(LogLevel::Error, "{}", setup_result.error());
+        return;
+    }
 
     auto frame_timer = FrameTimer {true};
     auto stats = Stats {};
+    impl_->frame_clock.Start();
+#ifdef VGLX_TRACING
+    Tracer::SetThreadName("Main");
+#endif
+
+    if (!impl_->window) {
+        RunHeadless(frame_timer);
+    } else if (pipelined_) {
+        RunPipelined(frame_timer, stats);
+    } else {
+        while (impl_->Running()) {
+            impl_->BeginFrame();
+            VGLX_TRACE_ZONE("Frame");
+            impl_->window->PollEvents();
+            impl_->context->jobs->RunMainThreadJobs();
+
+            const auto dt = impl_->Tick(frame_timer);
+            impl_->Advance(dt);
+
+            impl_->window->BeginUIFrame();
+            {
+                VGLX_TRACE_ZONE("Update");
+                if (!Update(dt)) {
+                    impl_->RequestClose();
+                }
+            }
+            if (show_stats_) {
+                stats.Draw();
+            }
+            impl_->EndUpdate();
+
+            stats.BeforeRender();
+            impl_->Interpolate();
+            impl_->renderer->Render(impl_->scene.get(), impl_->camera.get());
+            impl_->EndUIFrame();
+
+            impl_->RecordStats(stats, impl_->advance_ms, impl_->advance_allocations);
+            const auto render_ms = impl_->Now() - impl_->update_end;
+            impl_->window->SwapBuffers();
+            impl_->EndFrame(dt, render_ms, impl_->renderer->RenderedObjectsPerFrame());
+        }
+    }
+
+    impl_->LogFrameTimings();
+}
+
+auto Application::RunPipelined(FrameTimer& frame_timer, Stats& stats) -> void {
+    auto& jobs = *impl_->context->jobs;
+    auto simulation = JobCounter {};
+
+    while (impl_->Running()) {
+        impl_->BeginFrame();
+        VGLX_TRACE_ZONE("Frame");
+
+        // The scene must be idle before events, user code, or extraction
+        // touch it again.
+        jobs.Wait(simulation);
+        const auto advance_ms = impl_->advance_ms;
+        const auto advance_allocations = impl_->advance_allocations;
 
-    while (!impl_->window->ShouldClose()) {
         impl_->window->PollEvents();
+        jobs.RunMainThreadJobs();
 
-        const auto dt = frame_timer.Tick();
-        impl_->scene->Advance(dt);
+        const auto dt = impl_->Tick(frame_timer);
 
         impl_->window->BeginUIFrame();
-        if (!Update(dt)) {
-            impl_->window->RequestClose();
+        {
+            VGLX_TRACE_ZONE("Update");
+            if (!Update(dt)) {
+                impl_->RequestClose();
+            }
         }
         if (show_stats_) {
             stats.Draw();
         }
+        impl_->EndUpdate();
 
         stats.BeforeRender();
-        impl_->renderer->Render(impl_->scene.get(), impl_->camera.get());
-        impl_->window->EndUIFrame();
+        impl_->Interpolate();
+        impl_->renderer->Extract(impl_->scene.get(), impl_->camera.get());
 
-        stats.AfterRender(impl_->renderer->RenderedObjectsPerFrame());
+        // Simulate the next frame while this one is submitted and presented.
+        // With a fixed timestep, the frame above is interpolated with the
+        // remainder left by the previous frame's steps.
+        jobs.Schedule([impl = impl_.get(), dt] { impl->Advance(dt); }, &simulation);
+
+        impl_->renderer->Submit();
+        impl_->EndUIFrame();
+
+        impl_->RecordStats(stats, advance_ms, advance_allocations);
+        const auto render_ms = impl_->Now() - impl_->update_end;
         impl_->window->SwapBuffers();
+        impl_->EndFrame(dt, render_ms, impl_->renderer->RenderedObjectsPerFrame());
+    }
+
+    jobs.Wait(simulation);
+}
+
+auto Application::RunHeadless(FrameTimer& frame_timer) -> void {
+    while (impl_->Running()) {
+        impl_->BeginFrame();
+        VGLX_TRACE_ZONE("Frame");
+        impl_->context->jobs->RunMainThreadJobs();
+
+        const auto dt = impl_->Tick(frame_timer);
+        impl_->Advance(dt);
+
+        {
+            VGLX_TRACE_ZONE("Update");
+            if (!Update(dt)) {
+                impl_->RequestClose();
+            }
+        }
+        impl_->EndUpdate();
+
+        // Offscreen frames are rendered but never presented. Without a
+        // context there is nothing to submit, so the frame ends once the
+        // renderer's CPU side has produced its draw lists.
+        impl_->Interpolate();
+        auto rendered_objects = 0u;
+        if (impl_->renderer) {
+            impl_->renderer->Render(impl_->scene.get(), impl_->camera.get());
+            rendered_objects = impl_->renderer->RenderedObjectsPerFrame();
+        } else {
+            rendered_objects = impl_->Cull();
+        }
+        const auto render_ms = impl_->Now() - impl_->update_end;
+        impl_->EndFrame(dt, render_ms, rendered_objects);
     }
 }
 
@@ -172,6 +475,14 @@ auto Application::GetCamera() const -> Camera* {
     return impl_->camera.get();
 }
 
+auto Application::GetRenderer() const -> Renderer* {
+    return impl_->renderer.get();
+}
+
+auto Application::GetFrameTimings() const -> const std::vector<FrameTiming>& {
+    return impl_->frame_timings;
+}
+
 auto Application::SetScene(std::shared_ptr<Scene> scene) -> void {
     impl_->SetScene(scene);
 }
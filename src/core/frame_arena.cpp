@@ -0,0 +1,48 @@
+/*
+===========================================================================
+  VGLX https://vglx.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#include "core/frame_arena.hpp"
+
+#include <algorithm>
+
+namespace vglx {
+
+auto LinearArena::Capacity() const -> size_t {
+    auto capacity = size_t {0};
+    for (const auto& block : blocks_) capacity += block.size;
+    return capacity;
+}
+
+auto LinearArena::do_allocate(size_t bytes, size_t alignment) -> void* {
+    while (true) {
+        if (block_ == blocks_.size()) {
+            // Each new block doubles the last, so a growing frame settles
+            // after a few frames and later frames reuse the same blocks.
+            const auto size = std::max(
+                blocks_.empty() ? block_size_ : blocks_.back().size * 2,
+                bytes + alignment
+            );
+            blocks_.emplace_back(std::make_unique_for_overwrite<std::byte[]>(size), size);
+        }
+
+        auto& block = blocks_[block_];
+        const auto start = block.data.get() + offset_;
+        auto ptr = static_cast<void*>(start);
+        auto space = block.size - offset_;
+        if (std::align(alignment, bytes, ptr, space)) {
+            const auto end = static_cast<std::byte*>(ptr) + bytes;
+            used_ += static_cast<size_t>(end - start);
+            offset_ = static_cast<size_t>(end - block.data.get());
+            return ptr;
+        }
+
+        ++block_;
+        offset_ = 0;
+    }
+}
+
+}
\ No newline at end of file
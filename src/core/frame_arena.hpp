@@ -0,0 +1,117 @@
+/*
+===========================================================================
+  VGLX https://vglx.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <unordered_map>
+#include <vector>
+
+namespace vglx {
+
+// Bump allocator for memory that lives for a single frame. Blocks are kept
+// between frames, deallocation is a no-op, and Reset rewinds to the first
+// block in O(1), so a frame that fits in the blocks of earlier frames never
+// touches the heap. Not thread-safe.
+class LinearArena : public std::pmr::memory_resource {
+public:
+    static constexpr auto kDefaultBlockSize = size_t {64 * 1024};
+
+    explicit LinearArena(size_t block_size = kDefaultBlockSize) : block_size_(block_size) {}
+
+    LinearArena(const LinearArena&) = delete;
+
+    auto operator=(const LinearArena&) -> LinearArena& = delete;
+
+    auto Reset() -> void {
+        block_ = 0;
+        offset_ = 0;
+        used_ = 0;
+    }
+
+    // Bytes handed out since the last reset, including alignment padding.
+    [[nodiscard]] auto Used() const { return used_; }
+
+    [[nodiscard]] auto Capacity() const -> size_t;
+
+private:
+    struct Block {
+        std::unique_ptr<std::byte[]> data;
+        size_t size;
+    };
+
+    std::vector<Block> blocks_;
+
+    size_t block_size_;
+    size_t block_ {0};
+    size_t offset_ {0};
+    size_t used_ {0};
+
+    auto do_allocate(size_t bytes, size_t alignment) -> void* override;
+
+    auto do_deallocate(void*, size_t, size_t) -> void override {}
+
+    auto do_is_equal(const std::pmr::memory_resource& other) const noexcept -> bool override {
+        return this == &other;
+    }
+};
+
+// One linear arena per frame in flight. BeginFrame moves to the next arena
+// and rewinds it, so memory taken during a frame stays valid while the
+// following frame is extracted, and a pipelined submit can still read it.
+class FrameArena {
+public:
+    static constexpr auto kFramesInFlight = size_t {2};
+
+    auto BeginFrame() -> void {
+        current_ = (current_ + 1) % kFramesInFlight;
+        arenas_[current_].Reset();
+    }
+
+    [[nodiscard]] auto Resource() -> std::pmr::memory_resource* {
+        return &arenas_[current_];
+    }
+
+    [[nodiscard]] auto Current() const -> const LinearArena& {
+        return arenas_[current_];
+    }
+
+    template <typename T>
+    [[nodiscard]] auto Allocator() -> std::pmr::polymorphic_allocator<T> {
+        return Resource();
+    }
+
+private:
+    std::array<LinearArena, kFramesInFlight> arenas_;
+
+    size_t current_ {0};
+};
+
+// Recreates an empty vector on `memory` with room for the elements it held.
+// Polymorphic allocators do not propagate on assignment, so moving a new
+// vector in would keep the old resource.
+template <typename T>
+auto rebind_vector(std::pmr::vector<T>& vector, std::pmr::memory_resource* memory) {
+    const auto size = vector.size();
+    std::destroy_at(&vector);
+    std::construct_at(&vector, memory);
+    vector.reserve(size);
+}
+
+// Same as rebind_vector for hash maps, with buckets for the entries it held.
+template <typename Key, typename T>
+auto rebind_map(std::pmr::unordered_map<Key, T>& map, std::pmr::memory_resource* memory) {
+    const auto size = map.size();
+    std::destroy_at(&map);
+    std::construct_at(&map, memory);
+    map.reserve(size);
+}
+
+}
\ No newline at end of file
@@ -0,0 +1,177 @@
+/*
+===========================================================================
+  VGLX https://vglx.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#pragma once
+
+#include "vglx/geometries/geometry.hpp"
+#include "vglx/materials/material.hpp"
+#include "vglx/materials/shader_material.hpp"
+#include "vglx/math/color.hpp"
+#include "vglx/math/matrix3.hpp"
+#include "vglx/math/matrix4.hpp"
+#include "vglx/math/vector2.hpp"
+#include "vglx/nodes/fog.hpp"
+
+#include "core/frame_arena.hpp"
+#include "core/program_attributes.hpp"
+
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace vglx {
+
+class GLProgram;
+
+struct MaterialState {
+    float polygon_offset_factor {0.0f};
+    float polygon_offset_units {0.0f};
+    Material::Blending blending {Material::Blending::Normal};
+    bool two_sided {false};
+    bool depth_test {true};
+    bool transparent {false};
+};
+
+// Texture uploaded during extraction, referred to by its GL name.
+struct TextureBinding {
+    uint32_t texture {0};
+    Matrix3 transform {1.0f};
+};
+
+// Shader material uniform, with its name copied into the frame arena.
+struct UniformData {
+    std::pmr::string name;
+    ShaderMaterial::UniformValue value;
+};
+
+// Material parameters as of extraction. Packets refer to it by handle, so
+// all draws that share a material share one copy.
+struct MaterialData {
+    std::shared_ptr<Material> material;
+    MaterialState state;
+
+    Color color {0xFFFFFF};
+    Color specular {0x111111};
+    float shininess {32.0f};
+    float opacity {1.0f};
+
+    TextureBinding albedo_map;
+    TextureBinding alpha_map;
+    TextureBinding normal_map;
+    TextureBinding specular_map;
+    TextureBinding texture_map;
+
+    // Range of the material's uniforms in the snapshot's uniform table.
+    uint32_t first_uniform {0};
+    uint32_t uniform_count {0};
+};
+
+// Geometry with the draw parameters derived from it. The geometry is only
+// held so that it outlives the frame; submission binds `vertex_array`
+// without reading it.
+struct GeometryData {
+    std::shared_ptr<Geometry> geometry;
+    uint32_t vertex_array {0};
+    GeometryPrimitiveType primitive {GeometryPrimitiveType::Triangles};
+    uint32_t count {0};
+    bool indexed {false};
+};
+
+// Program variant. The GL program is resolved on first use during submit.
+struct ProgramData {
+    ProgramAttributes attributes;
+    GLProgram* program {nullptr};
+};
+
+// One draw, with handles into the snapshot's program, material and geometry
+// tables. Packets are plain data, so sorting and copying them never touches
+// reference counts or scene nodes.
+struct DrawPacket {
+    static constexpr auto kNoQuery = ~uint32_t {0};
+    static constexpr auto kNoProgram = ~uint32_t {0};
+
+    Matrix4 model {1.0f};
+
+    // Opaque packets are ordered by program, then material, then depth, so
+    // that state changes are grouped. Transparent packets keep depth order.
+    uint64_t sort_key {0};
+
+    uint32_t program {0};
+    uint32_t material {0};
+    uint32_t geometry {0};
+    uint32_t instance_count {0};
+
+    // Occlusion query drawn before the packet, which is then only drawn if
+    // the query passes.
+    uint32_t query {kNoQuery};
+
+    // Depth-only program the packet is drawn with in the depth pre-pass.
+    uint32_t depth_program {kNoProgram};
+
+    Vector2 anchor {0.5f, 0.5f};
+    float rotation {0.0f};
+};
+
+static_assert(std::is_trivially_copyable_v<DrawPacket>);
+
+// Occlusion query for a renderable, drawn as its world space bounding box.
+struct OcclusionQuery {
+    DrawPacket bounds;
+    uint64_t object {0};
+};
+
+struct FogState {
+    FogType type {FogType::LinearFog};
+    Color color {0xFFFFFF};
+    float near {0.0f};
+    float far {0.0f};
+    float density {0.0f};
+    bool enabled {false};
+};
+
+// Immutable copy of everything the renderer needs to submit a frame. It is
+// produced from the scene on the main thread and consumed without touching
+// scene nodes, which lets the next frame's simulation run during submission.
+// Its lists are taken from the frame arena and rebuilt for every frame.
+struct FrameSnapshot {
+    std::pmr::vector<DrawPacket> opaque;
+    std::pmr::vector<DrawPacket> transparent;
+
+    // Opaque packets drawn in the depth pre-pass, and then again with depth
+    // tests against their own depth.
+    std::pmr::vector<DrawPacket> prepassed;
+
+    std::pmr::vector<ProgramData> programs;
+    std::pmr::vector<MaterialData> materials;
+    std::pmr::vector<GeometryData> geometries;
+    std::pmr::vector<UniformData> uniforms;
+
+    // Queries referenced by draw packets, and queries of hidden renderables
+    // that are not drawn.
+    std::pmr::vector<OcclusionQuery> queries;
+    std::pmr::vector<OcclusionQuery> hidden_queries;
+
+    FogState fog;
+
+    auto Reset(std::pmr::memory_resource* memory) -> void {
+        rebind_vector(opaque, memory);
+        rebind_vector(transparent, memory);
+        rebind_vector(prepassed, memory);
+        rebind_vector(programs, memory);
+        rebind_vector(materials, memory);
+        rebind_vector(geometries, memory);
+        rebind_vector(uniforms, memory);
+        rebind_vector(queries, memory);
+        rebind_vector(hidden_queries, memory);
+        fog = {};
+    }
+};
+
+}
\ No newline at end of file
@@ -0,0 +1,72 @@
+/*
+===========================================================================
+  VGLX https://vglx.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#include "vglx/core/identity.hpp"
+
+#include <array>
+#include <atomic>
+#include <random>
+
+namespace vglx {
+
+namespace {
+
+std::atomic<uint64_t> next_id {1};
+
+// Random per process, so that the same IDs in different runs do not map to
+// the same UUIDs.
+auto session_seed() {
+    static const auto seed = [] {
+        auto device = std::random_device {};
+        return uint64_t {device()} << 32 | device();
+    }();
+    return seed;
+}
+
+// SplitMix64 finalizer. It is a bijection, so distinct IDs give distinct
+// values.
+auto mix(uint64_t x) {
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111eb;
+    return x ^ (x >> 31);
+}
+
+}
+
+auto Identity::NextId() -> uint64_t {
+    return next_id.fetch_add(1, std::memory_order_relaxed);
+}
+
+auto Identity::UUID() const -> std::string {
+    const auto unique = mix(id_ + session_seed());
+    const auto random = mix(unique ^ 0x9e3779b97f4a7c15);
+
+    // Version 4 layout. The bytes that carry the version and variant bits
+    // come from `random`, so all 64 bits of `unique` survive and UUIDs stay
+    // unique within the process.
+    auto bytes = std::array<uint8_t, 16> {};
+    constexpr auto unique_bytes = std::array {0, 1, 2, 3, 4, 5, 7, 9};
+    constexpr auto random_bytes = std::array {6, 8, 10, 11, 12, 13, 14, 15};
+    for (auto i = 0; i < 8; ++i) {
+        bytes[unique_bytes[i]] = static_cast<uint8_t>(unique >> (8 * i));
+        bytes[random_bytes[i]] = static_cast<uint8_t>(random >> (8 * i));
+    }
+    bytes[6] = (bytes[6] & 0x0f) | 0x40;
+    bytes[8] = (bytes[8] & 0x3f) | 0x80;
+
+    constexpr auto digits = "0123456789abcdef";
+    auto uuid = std::string {};
+    uuid.reserve(36);
+    for (auto i = 0; i < 16; ++i) {
+        if (i == 4 || i == 6 || i == 8 || i == 10) uuid += '-';
+        uuid += digits[bytes[i] >> 4];
+        uuid += digits[bytes[i] & 0xf];
+    }
+    return uuid;
+}
+
+}
\ No newline at end of file
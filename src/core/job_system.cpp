@@ -0,0 +1,345 @@
+/*
+===========================================================================
+  VGLX https://vglx.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#include "vglx/core/job_system.hpp"
+
+#include "vglx/utilities/tracer.hpp"
+
+#include <algorithm>
+#include <condition_variable>
+#include <format>
+#include <thread>
+#include <utility>
+
+namespace vglx {
+
+namespace {
+
+struct Task {
+    Job job;
+    JobCounter* counter {nullptr};
+};
+
+// Ring buffer of tasks. The owning worker pushes and pops at the back and
+// thieves pop at the front. Unlike a deque, it keeps its storage once grown,
+// so a steady workload queues jobs without allocating.
+class TaskRing {
+public:
+    [[nodiscard]] auto Empty() const { return size_ == 0; }
+
+    auto PushBack(Task task) -> void {
+        if (size_ == tasks_.size()) Grow();
+        tasks_[(head_ + size_) & (tasks_.size() - 1)] = std::move(task);
+        ++size_;
+    }
+
+    auto PopBack() -> Task {
+        --size_;
+        return std::move(tasks_[(head_ + size_) & (tasks_.size() - 1)]);
+    }
+
+    auto PopFront() -> Task {
+        auto task = std::move(tasks_[head_]);
+        head_ = (head_ + 1) & (tasks_.size() - 1);
+        --size_;
+        return task;
+    }
+
+private:
+    std::vector<Task> tasks_;
+    size_t head_ {0};
+    size_t size_ {0};
+
+    auto Grow() -> void {
+        auto tasks = std::vector<Task>(std::max<size_t>(tasks_.size() * 2, 64));
+        for (auto i = size_t {0}; i < size_; ++i) {
+            tasks[i] = std::move(tasks_[(head_ + i) & (tasks_.size() - 1)]);
+        }
+        tasks_ = std::move(tasks);
+        head_ = 0;
+    }
+};
+
+struct WorkQueue {
+    std::mutex mutex;
+    TaskRing tasks;
+};
+
+// Range shared by the jobs of a ParallelFor. Each job only holds a pointer to
+// it, which fits in the small buffer of a Job, and claims chunks until the
+// range is exhausted.
+struct ParallelRange {
+    void* callable;
+    void (*invoke)(void* callable, size_t begin, size_t end);
+    size_t count;
+    size_t chunk;
+    std::atomic<size_t> next {0};
+
+    auto Run() -> void {
+        while (true) {
+            const auto begin = next.fetch_add(chunk, std::memory_order_relaxed);
+            if (begin >= count) return;
+            invoke(callable, begin, std::min(begin + chunk, count));
+        }
+    }
+};
+
+constexpr auto kNotAWorker = static_cast<size_t>(-1);
+
+}
+
+struct JobSystem::Impl {
+    std::vector<std::unique_ptr<WorkQueue>> queues;
+    std::vector<std::jthread> workers;
+
+    std::atomic<size_t> queued {0};
+    std::atomic<size_t> next_queue {0};
+
+    std::mutex sleep_mutex;
+    std::condition_variable wake;
+    bool stopping {false};
+
+    std::mutex main_mutex;
+    std::vector<Task> main_tasks;
+    std::thread::id main_thread {std::this_thread::get_id()};
+
+    static thread_local Impl* current_system;
+    static thread_local size_t current_worker;
+
+    explicit Impl(unsigned worker_count) {
+        queues.reserve(worker_count);
+        for (auto i = 0u; i < worker_count; ++i) {
+            queues.emplace_back(std::make_unique<WorkQueue>());
+        }
+        workers.reserve(worker_count);
+        for (auto i = size_t {0}; i < worker_count; ++i) {
+            workers.emplace_back([this, i] { WorkerLoop(i); });
+        }
+    }
+
+    ~Impl() {
+        {
+            auto lock = std::scoped_lock {sleep_mutex};
+            stopping = true;
+        }
+        wake.notify_all();
+        workers.clear();
+    }
+
+    [[nodiscard]] auto WorkerIndex() const {
+        return current_system == this ? current_worker : kNotAWorker;
+    }
+
+    auto Push(Task task) -> void {
+        if (task.counter) task.counter->pending_.fetch_add(1, std::memory_order_relaxed);
+
+        if (queues.empty()) {
+            Execute(task);
+            return;
+        }
+
+        auto index = WorkerIndex();
+        if (index == kNotAWorker) {
+            index = next_queue.fetch_add(1, std::memory_order_relaxed) % queues.size();
+        }
+
+        {
+            auto& queue = *queues[index];
+            auto lock = std::scoped_lock {queue.mutex};
+            queue.tasks.PushBack(std::move(task));
+        }
+
+        queued.fetch_add(1, std::memory_order_release);
+        {
+            // Pairs with the predicate check in WorkerLoop so a worker that is
+            // about to sleep cannot miss the wake-up.
+            auto lock = std::scoped_lock {sleep_mutex};
+        }
+        wake.notify_one();
+    }
+
+    auto TryPop(size_t index, Task& task) -> bool {
+        if (index != kNotAWorker) {
+            auto& queue = *queues[index];
+            auto lock = std::scoped_lock {queue.mutex};
+            if (!queue.tasks.Empty()) {
+                task = queue.tasks.PopBack();
+                return true;
+            }
+        }
+
+        const auto count = queues.size();
+        const auto start = index == kNotAWorker
+            ? next_queue.load(std::memory_order_relaxed)
+            : index + 1;
+
+        for (auto i = size_t {0}; i < count; ++i) {
+            auto& queue = *queues[(start + i) % count];
+            auto lock = std::scoped_lock {queue.mutex};
+            if (!queue.tasks.Empty()) {
+                task = queue.tasks.PopFront();
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    auto TryRunOne(size_t index) -> bool {
+        if (queued.load(std::memory_order_acquire) == 0) return false;
+
+        auto task = Task {};
+        if (!TryPop(index, task)) return false;
+        queued.fetch_sub(1, std::memory_order_relaxed);
+        Execute(task);
+        return true;
+    }
+
+    auto Execute(Task& task) -> void {
+        task.job();
+        if (task.counter) Complete(*task.counter);
+    }
+
+    auto Complete(JobCounter& counter) -> void {
+        auto continuations = std::vector<Job> {};
+        {
+            // The lock is held across the decrement so that Wait cannot return,
+            // and the counter cannot be destroyed, while it is still in use here.
+            auto lock = std::scoped_lock {counter.mutex_};
+            if (counter.pending_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                continuations.swap(counter.continuations_);
+            }
+        }
+        for (auto& job : continuations) {
+            Push({std::move(job), nullptr});
+        }
+    }
+
+    auto RunMainThreadTasks() -> bool {
+        auto tasks = std::vector<Task> {};
+        {
+            auto lock = std::scoped_lock {main_mutex};
+            tasks.swap(main_tasks);
+        }
+        for (auto& task : tasks) Execute(task);
+        return !tasks.empty();
+    }
+
+    auto WorkerLoop(size_t index) -> void {
+        current_system = this;
+        current_worker = index;
+#ifdef VGLX_TRACING
+        Tracer::SetThreadName(std::format("Worker {}", index));
+#endif
+
+        while (true) {
+            if (TryRunOne(index)) continue;
+
+            auto lock = std::unique_lock {sleep_mutex};
+            wake.wait(lock, [this] {
+                return stopping || queued.load(std::memory_order_acquire) > 0;
+            });
+            if (stopping && queued.load(std::memory_order_acquire) == 0) return;
+        }
+    }
+};
+
+thread_local JobSystem::Impl* JobSystem::Impl::current_system {nullptr};
+thread_local size_t JobSystem::Impl::current_worker {kNotAWorker};
+
+JobSystem::JobSystem(unsigned worker_count)
+  : impl_(std::make_unique<Impl>(worker_count)) {}
+
+auto JobSystem::DefaultWorkerCount() -> unsigned {
+    return std::max(1u, std::thread::hardware_concurrency()) - 1;
+}
+
+auto JobSystem::Schedule(Job job, JobCounter* counter) -> void {
+    impl_->Push({std::move(job), counter});
+}
+
+auto JobSystem::ScheduleAfter(JobCounter& dependency, Job job, JobCounter* counter) -> void {
+    // The job is tracked by its own counter from the moment it is deferred,
+    // not only once its dependency resolves.
+    if (counter) counter->pending_.fetch_add(1, std::memory_order_relaxed);
+
+    auto wrapped = [this, job = std::move(job), counter] {
+        job();
+        if (counter) impl_->Complete(*counter);
+    };
+
+    {
+        auto lock = std::scoped_lock {dependency.mutex_};
+        if (!dependency.Done()) {
+            dependency.continuations_.emplace_back(std::move(wrapped));
+            return;
+        }
+    }
+
+    impl_->Push({std::move(wrapped), nullptr});
+}
+
+auto JobSystem::ScheduleOnMainThread(Job job, JobCounter* counter) -> void {
+    if (counter) counter->pending_.fetch_add(1, std::memory_order_relaxed);
+    auto lock = std::scoped_lock {impl_->main_mutex};
+    impl_->main_tasks.emplace_back(std::move(job), counter);
+}
+
+auto JobSystem::RunMainThreadJobs() -> void {
+    impl_->RunMainThreadTasks();
+}
+
+auto JobSystem::Wait(const JobCounter& counter) -> void {
+    const auto index = impl_->WorkerIndex();
+    const auto on_main_thread = std::this_thread::get_id() == impl_->main_thread;
+
+    while (!counter.Done()) {
+        if (impl_->TryRunOne(index)) continue;
+        if (on_main_thread && impl_->RunMainThreadTasks()) continue;
+        std::this_thread::yield();
+    }
+
+    // Synchronize with the job that completed the counter, it may still be
+    // releasing the counter's lock.
+    auto lock = std::scoped_lock {counter.mutex_};
+}
+
+auto JobSystem::RunParallelFor(
+    size_t count,
+    void* callable,
+    void (*invoke)(void* callable, size_t begin, size_t end),
+    size_t grain_size
+) -> void {
+    if (count == 0) return;
+
+    // Aim for a few chunks per thread so that claiming chunks dynamically can
+    // even out uneven work.
+    const auto threads = impl_->workers.size() + 1;
+    const auto chunk = std::max(std::max<size_t>(grain_size, 1), (count + threads * 4 - 1) / (threads * 4));
+    if (impl_->workers.empty() || chunk >= count) {
+        invoke(callable, 0, count);
+        return;
+    }
+
+    auto range = ParallelRange {callable, invoke, count, chunk};
+    auto counter = JobCounter {};
+    const auto helpers = std::min(impl_->workers.size(), (count - 1) / chunk);
+    for (auto i = size_t {0}; i < helpers; ++i) {
+        Schedule([&range] { range.Run(); }, &counter);
+    }
+
+    range.Run();
+    Wait(counter);
+}
+
+auto JobSystem::WorkerCount() const -> unsigned {
+    return static_cast<unsigned>(impl_->workers.size());
+}
+
+JobSystem::~JobSystem() = default;
+
+}
\ No newline at end of file
@@ -0,0 +1,175 @@
+/*
+===========================================================================
+  VGLX https://vglx.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#include "vglx/core/object_pool.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <mutex>
+#include <new>
+#include <vector>
+
+namespace vglx {
+
+namespace {
+
+constexpr auto kGranularity = size_t {16};
+constexpr auto kClassCount = ObjectPool::kMaxBlockSize / kGranularity;
+constexpr auto kSlabSize = size_t {64 * 1024};
+
+// Blocks moved between a thread and the shared lists at a time. A thread
+// keeps up to twice as many before returning a batch.
+constexpr auto kBatchSize = size_t {64};
+
+struct FreeBlock {
+    FreeBlock* next;
+};
+
+struct FreeList {
+    FreeBlock* head {nullptr};
+    size_t count {0};
+
+    auto Push(void* ptr) {
+        auto block = static_cast<FreeBlock*>(ptr);
+        block->next = head;
+        head = block;
+        ++count;
+    }
+
+    auto Pop() -> void* {
+        auto block = head;
+        head = block->next;
+        --count;
+        return block;
+    }
+
+    // Moves up to `n` blocks from the front of this list to `other`.
+    auto MoveTo(FreeList& other, size_t n) {
+        for (auto i = size_t {0}; i < n && head; ++i) {
+            other.Push(Pop());
+        }
+    }
+};
+
+// Lists shared by all threads and the slabs backing every block. It is
+// never destroyed, so blocks can still be returned while threads and
+// static objects are torn down.
+struct SharedPool {
+    std::mutex mutex;
+    std::array<FreeList, kClassCount> lists;
+    std::vector<std::byte*> slabs;
+    std::atomic<size_t> reserved {0};
+
+    // Carves a new slab into blocks of `block_size` and adds them to `list`.
+    // Must be called with the mutex held.
+    auto Grow(FreeList& list, size_t block_size) {
+        const auto size = std::max(kSlabSize, block_size * kBatchSize);
+        auto slab = static_cast<std::byte*>(::operator new(size));
+        slabs.emplace_back(slab);
+        reserved.fetch_add(size, std::memory_order_relaxed);
+        for (auto offset = size_t {0}; offset + block_size <= size; offset += block_size) {
+            list.Push(slab + offset);
+        }
+    }
+};
+
+auto shared_pool() -> SharedPool& {
+    static auto pool = new SharedPool {};
+    return *pool;
+}
+
+// Per-thread lists, returned to the shared pool when the thread exits.
+struct ThreadCache {
+    std::array<FreeList, kClassCount> lists;
+
+    ~ThreadCache();
+};
+
+thread_local constinit auto thread_cache_destroyed = false;
+
+thread_local auto thread_cache = ThreadCache {};
+
+ThreadCache::~ThreadCache() {
+    auto& pool = shared_pool();
+    auto lock = std::lock_guard {pool.mutex};
+    for (auto i = size_t {0}; i < kClassCount; ++i) {
+        lists[i].MoveTo(pool.lists[i], lists[i].count);
+    }
+    thread_cache_destroyed = true;
+}
+
+auto size_class(size_t size) {
+    return (std::max(size, size_t {1}) + kGranularity - 1) / kGranularity - 1;
+}
+
+auto is_pooled(size_t size, size_t alignment) {
+    return size <= ObjectPool::kMaxBlockSize && alignment <= kGranularity;
+}
+
+}
+
+auto ObjectPool::Allocate(size_t size, size_t alignment) -> void* {
+    if (!is_pooled(size, alignment)) {
+        return alignment > __STDCPP_DEFAULT_NEW_ALIGNMENT__
+            ? ::operator new(size, std::align_val_t {alignment})
+            : ::operator new(size);
+    }
+
+    const auto index = size_class(size);
+    if (thread_cache_destroyed) {
+        auto& pool = shared_pool();
+        auto lock = std::lock_guard {pool.mutex};
+        auto& list = pool.lists[index];
+        if (!list.head) pool.Grow(list, (index + 1) * kGranularity);
+        return list.Pop();
+    }
+
+    auto& list = thread_cache.lists[index];
+    if (!list.head) {
+        auto& pool = shared_pool();
+        auto lock = std::lock_guard {pool.mutex};
+        auto& shared = pool.lists[index];
+        if (!shared.head) pool.Grow(shared, (index + 1) * kGranularity);
+        shared.MoveTo(list, kBatchSize);
+    }
+    return list.Pop();
+}
+
+auto ObjectPool::Deallocate(void* ptr, size_t size, size_t alignment) -> void {
+    if (!ptr) return;
+    if (!is_pooled(size, alignment)) {
+        if (alignment > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+            ::operator delete(ptr, std::align_val_t {alignment});
+        } else {
+            ::operator delete(ptr);
+        }
+        return;
+    }
+
+    const auto index = size_class(size);
+    if (thread_cache_destroyed) {
+        auto& pool = shared_pool();
+        auto lock = std::lock_guard {pool.mutex};
+        pool.lists[index].Push(ptr);
+        return;
+    }
+
+    auto& list = thread_cache.lists[index];
+    list.Push(ptr);
+    if (list.count > 2 * kBatchSize) {
+        auto& pool = shared_pool();
+        auto lock = std::lock_guard {pool.mutex};
+        list.MoveTo(pool.lists[index], kBatchSize);
+    }
+}
+
+auto ObjectPool::ReservedBytes() -> size_t {
+    return shared_pool().reserved.load(std::memory_order_relaxed);
+}
+
+}
\ No newline at end of file
@@ -0,0 +1,277 @@
+/*
+===========================================================================
+  VGLX https://vglx.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#include "core/occlusion_buffer.hpp"
+
+#include "vglx/math/vector4.hpp"
+#include "vglx/utilities/tracer.hpp"
+
+#include <algorithm>
+#include <limits>
+
+namespace vglx {
+
+namespace {
+
+constexpr auto kTilePixels = OcclusionBuffer::kTileSize * OcclusionBuffer::kTileSize;
+
+struct ScreenPoint {
+    float x;
+    float y;
+    float z;
+};
+
+// Projects a clip space point into buffer pixels and [0, 1] depth. Points
+// in front of the near plane have no valid projection.
+auto to_screen(const Vector4& p, ScreenPoint& out) {
+    if (p.w <= 0.0f || p.z < -p.w) return false;
+    const auto inv_w = 1.0f / p.w;
+    out.x = (p.x * inv_w * 0.5f + 0.5f) * OcclusionBuffer::kWidth;
+    out.y = (p.y * inv_w * 0.5f + 0.5f) * OcclusionBuffer::kHeight;
+    out.z = p.z * inv_w * 0.5f + 0.5f;
+    return true;
+}
+
+auto tile_offset(int tile_x, int tile_y) {
+    return (tile_y * OcclusionBuffer::kTilesX + tile_x) * kTilePixels;
+}
+
+auto level_width(int level) {
+    return std::max(OcclusionBuffer::kTilesX >> level, 1);
+}
+
+auto level_height(int level) {
+    return std::max(OcclusionBuffer::kTilesY >> level, 1);
+}
+
+}
+
+OcclusionBuffer::OcclusionBuffer() {
+    depth_.fill(1.0f);
+    for (auto level = 0; level < kLevels; ++level) {
+        pyramid_[level].assign(level_width(level) * level_height(level), 1.0f);
+    }
+}
+
+auto OcclusionBuffer::Rasterize(
+    std::span<Mesh* const> occluders,
+    const Matrix4& view_projection,
+    JobSystem* jobs
+) -> void {
+    VGLX_TRACE_ZONE("OcclusionBuffer::Rasterize");
+    view_projection_ = view_projection;
+    triangles_.clear();
+    for (auto mesh : occluders) {
+        AddTriangles(mesh, view_projection);
+    }
+
+    // Each row of tiles only writes its own pixels and pyramid entries.
+    const auto rasterize = [this](size_t begin, size_t end) {
+        for (auto tile_y = begin; tile_y < end; ++tile_y) {
+            RasterizeTileRow(static_cast<int>(tile_y));
+        }
+    };
+    if (jobs && !triangles_.empty()) {
+        jobs->ParallelFor(kTilesY, rasterize, 1);
+    } else {
+        rasterize(0, kTilesY);
+    }
+
+    BuildPyramid();
+}
+
+auto OcclusionBuffer::AddTriangles(Mesh* mesh, const Matrix4& view_projection) -> void {
+    const auto& geometry = mesh->occluder_proxy ? mesh->occluder_proxy : mesh->GetGeometry();
+    if (!geometry || geometry->Disposed()) return;
+    if (geometry->primitive != GeometryPrimitiveType::Triangles) return;
+    if (!geometry->HasAttribute(VertexAttributeType::Position)) return;
+
+    const auto mvp = view_projection * mesh->GetRenderTransform();
+    const auto& vertices = geometry->VertexData();
+    const auto& indices = geometry->IndexData();
+    const auto stride = geometry->Stride();
+    const auto count = indices.empty() ? geometry->VertexCount() : indices.size();
+
+    const auto project = [&](size_t i, ScreenPoint& out) {
+        const auto offset = (indices.empty() ? i : indices[i]) * stride;
+        return to_screen(mvp * Vector4 {
+            vertices[offset],
+            vertices[offset + 1],
+            vertices[offset + 2],
+            1.0f
+        }, out);
+    };
+
+    for (auto i = size_t {0}; i + 2 < count; i += 3) {
+        // Triangles crossing the near plane are skipped rather than clipped,
+        // which can only make the buffer occlude less.
+        auto v = std::array<ScreenPoint, 3> {};
+        if (!project(i, v[0]) || !project(i + 1, v[1]) || !project(i + 2, v[2])) {
+            continue;
+        }
+
+        // Back faces of a closed occluder are behind its front faces.
+        const auto area = (v[1].x - v[0].x) * (v[2].y - v[0].y) - (v[2].x - v[0].x) * (v[1].y - v[0].y);
+        if (area <= 0.0f) continue;
+
+        const auto min_x = std::min({v[0].x, v[1].x, v[2].x});
+        const auto max_x = std::max({v[0].x, v[1].x, v[2].x});
+        const auto min_y = std::min({v[0].y, v[1].y, v[2].y});
+        const auto max_y = std::max({v[0].y, v[1].y, v[2].y});
+        if (max_x < 0.0f || max_y < 0.0f || min_x >= kWidth || min_y >= kHeight) continue;
+
+        auto t = Triangle {
+            .min_x = static_cast<int>(std::max(min_x, 0.0f)),
+            .max_x = static_cast<int>(std::min(max_x, kWidth - 1.0f)),
+            .min_y = static_cast<int>(std::max(min_y, 0.0f)),
+            .max_y = static_cast<int>(std::min(max_y, kHeight - 1.0f))
+        };
+
+        // The edge opposite each vertex, scaled so the three sum to one.
+        const auto inv_area = 1.0f / area;
+        for (auto k = 0; k < 3; ++k) {
+            const auto& a = v[(k + 1) % 3];
+            const auto& b = v[(k + 2) % 3];
+            t.edge_a[k] = (a.y - b.y) * inv_area;
+            t.edge_b[k] = (b.x - a.x) * inv_area;
+            t.edge_c[k] = ((b.y - a.y) * a.x - (b.x - a.x) * a.y) * inv_area;
+        }
+        t.depth_a = v[0].z * t.edge_a[0] + v[1].z * t.edge_a[1] + v[2].z * t.edge_a[2];
+        t.depth_b = v[0].z * t.edge_b[0] + v[1].z * t.edge_b[1] + v[2].z * t.edge_b[2];
+        t.depth_c = v[0].z * t.edge_c[0] + v[1].z * t.edge_c[1] + v[2].z * t.edge_c[2];
+        triangles_.emplace_back(t);
+    }
+}
+
+auto OcclusionBuffer::RasterizeTileRow(int tile_y) -> void {
+    const auto row_begin = tile_y * kTileSize;
+    const auto row_end = row_begin + kTileSize - 1;
+    const auto tiles = depth_.data() + tile_offset(0, tile_y);
+    std::fill_n(tiles, kTilesX * kTilePixels, 1.0f);
+
+    for (const auto& t : triangles_) {
+        if (t.max_y < row_begin || t.min_y > row_end) continue;
+
+        for (auto y = std::max(t.min_y, row_begin); y <= std::min(t.max_y, row_end); ++y) {
+            const auto py = static_cast<float>(y) + 0.5f;
+            for (auto tile_x = t.min_x / kTileSize; tile_x <= t.max_x / kTileSize; ++tile_x) {
+                // A full row of a tile at a time, so the loop has a fixed
+                // width and no branches.
+                const auto row = tiles + tile_x * kTilePixels + (y - row_begin) * kTileSize;
+                const auto x0 = static_cast<float>(tile_x * kTileSize) + 0.5f;
+                for (auto i = 0; i < kTileSize; ++i) {
+                    const auto px = x0 + static_cast<float>(i);
+                    const auto b0 = t.edge_a[0] * px + t.edge_b[0] * py + t.edge_c[0];
+                    const auto b1 = t.edge_a[1] * px + t.edge_b[1] * py + t.edge_c[1];
+                    const auto b2 = t.edge_a[2] * px + t.edge_b[2] * py + t.edge_c[2];
+                    const auto z = t.depth_a * px + t.depth_b * py + t.depth_c;
+                    const auto inside = b0 >= 0.0f && b1 >= 0.0f && b2 >= 0.0f;
+                    row[i] = inside && z < row[i] ? z : row[i];
+                }
+            }
+        }
+    }
+
+    for (auto tile_x = 0; tile_x < kTilesX; ++tile_x) {
+        const auto tile = tiles + tile_x * kTilePixels;
+        pyramid_[0][tile_y * kTilesX + tile_x] = *std::max_element(tile, tile + kTilePixels);
+    }
+}
+
+auto OcclusionBuffer::BuildPyramid() -> void {
+    for (auto level = 1; level < kLevels; ++level) {
+        const auto& source = pyramid_[level - 1];
+        const auto source_width = level_width(level - 1);
+        auto& target = pyramid_[level];
+        const auto width = level_width(level);
+        for (auto y = 0; y < level_height(level); ++y) {
+            for (auto x = 0; x < width; ++x) {
+                const auto i = 2 * y * source_width + 2 * x;
+                target[y * width + x] = std::max({
+                    source[i], source[i + 1],
+                    source[i + source_width], source[i + source_width + 1]
+                });
+            }
+        }
+    }
+}
+
+auto OcclusionBuffer::IsOccluded(const Box3& box) const -> bool {
+    if (box.IsEmpty()) return false;
+
+    auto min_x = std::numeric_limits<float>::max();
+    auto min_y = std::numeric_limits<float>::max();
+    auto max_x = std::numeric_limits<float>::lowest();
+    auto max_y = std::numeric_limits<float>::lowest();
+    auto min_z = std::numeric_limits<float>::max();
+    for (auto corner = 0; corner < 8; ++corner) {
+        const auto point = Vector4 {
+            corner & 1 ? box.max.x : box.min.x,
+            corner & 2 ? box.max.y : box.min.y,
+            corner & 4 ? box.max.z : box.min.z,
+            1.0f
+        };
+        // Boxes reaching the camera are never hidden.
+        auto p = ScreenPoint {};
+        if (!to_screen(view_projection_ * point, p)) return false;
+        min_x = std::min(min_x, p.x);
+        max_x = std::max(max_x, p.x);
+        min_y = std::min(min_y, p.y);
+        max_y = std::max(max_y, p.y);
+        min_z = std::min(min_z, p.z);
+    }
+    if (max_x < 0.0f || max_y < 0.0f || min_x >= kWidth || min_y >= kHeight) {
+        return false;
+    }
+
+    const auto tile = [](float value, int size) {
+        return static_cast<int>(std::clamp(value, 0.0f, size - 1.0f)) / kTileSize;
+    };
+    const auto x0 = tile(min_x, kWidth);
+    const auto x1 = tile(max_x, kWidth);
+    const auto y0 = tile(min_y, kHeight);
+    const auto y1 = tile(max_y, kHeight);
+
+    // The finest level at which the box covers at most 2x2 entries.
+    auto level = 0;
+    while (level < kLevels - 1 && ((x1 >> level) - (x0 >> level) > 1 || (y1 >> level) - (y0 >> level) > 1)) {
+        ++level;
+    }
+
+    const auto& depths = pyramid_[level];
+    const auto width = level_width(level);
+    auto max_depth = 0.0f;
+    for (auto y = y0 >> level; y <= std::min(y1 >> level, level_height(level) - 1); ++y) {
+        for (auto x = x0 >> level; x <= std::min(x1 >> level, width - 1); ++x) {
+            max_depth = std::max(max_depth, depths[y * width + x]);
+        }
+    }
+    return min_z > max_depth;
+}
+
+auto OcclusionBuffer::Depth(int x, int y) const -> float {
+    const auto tile = tile_offset(x / kTileSize, y / kTileSize);
+    return depth_[tile + (y % kTileSize) * kTileSize + x % kTileSize];
+}
+
+auto OcclusionBuffer::DebugImage() -> std::span<const uint8_t> {
+    debug_image_.resize(kWidth * kHeight);
+    const auto nearest = *std::ranges::min_element(depth_);
+    const auto range = std::max(1.0f - nearest, 1e-6f);
+    for (auto y = 0; y < kHeight; ++y) {
+        for (auto x = 0; x < kWidth; ++x) {
+            const auto depth = Depth(x, y);
+            // Empty pixels are black, occluders fade from white to gray.
+            debug_image_[y * kWidth + x] = depth >= 1.0f
+                ? uint8_t {0}
+                : static_cast<uint8_t>(64.0f + 191.0f * (1.0f - depth) / range);
+        }
+    }
+    return debug_image_;
+}
+
+}
\ No newline at end of file
@@ -0,0 +1,95 @@
+/*
+===========================================================================
+  VGLX https://vglx.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#pragma once
+
+#include "vglx/core/job_system.hpp"
+#include "vglx/math/box3.hpp"
+#include "vglx/math/matrix4.hpp"
+#include "vglx/nodes/mesh.hpp"
+
+#include <array>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace vglx {
+
+// Low-resolution depth buffer rasterized on the CPU from occluder meshes,
+// used to skip renderables hidden behind them. Depth is stored in 8x8 pixel
+// tiles so that rasterization and reduction run over fixed-width rows the
+// compiler vectorizes, and each row of tiles can be rasterized by its own
+// job. A pyramid of the farthest depth per tile answers box queries
+// conservatively: a box is occluded only if it is behind every occluder
+// pixel it could cover.
+class OcclusionBuffer {
+public:
+    static constexpr auto kWidth = 256;
+    static constexpr auto kHeight = 128;
+    static constexpr auto kTileSize = 8;
+    static constexpr auto kTilesX = kWidth / kTileSize;
+    static constexpr auto kTilesY = kHeight / kTileSize;
+    static constexpr auto kLevels = 5;
+
+    OcclusionBuffer();
+
+    // Clears the buffer and rasterizes the occluders, as seen through
+    // `view_projection`. Rows of tiles are spread across `jobs` if set.
+    auto Rasterize(
+        std::span<Mesh* const> occluders,
+        const Matrix4& view_projection,
+        JobSystem* jobs = nullptr
+    ) -> void;
+
+    // Returns true if a world space box is hidden behind the occluders.
+    [[nodiscard]] auto IsOccluded(const Box3& box) const -> bool;
+
+    // Depth in [0, 1] at a pixel, where row 0 is the bottom of the view.
+    [[nodiscard]] auto Depth(int x, int y) const -> float;
+
+    // Grayscale image of the buffer, bottom row first, with near depths
+    // bright and empty pixels black.
+    [[nodiscard]] auto DebugImage() -> std::span<const uint8_t>;
+
+    [[nodiscard]] auto TriangleCount() const { return triangles_.size(); }
+
+private:
+    // Screen space triangle. The edge functions are positive inside and the
+    // depth plane gives the depth at any pixel, both as a * x + b * y + c.
+    struct Triangle {
+        std::array<float, 3> edge_a {};
+        std::array<float, 3> edge_b {};
+        std::array<float, 3> edge_c {};
+        float depth_a {};
+        float depth_b {};
+        float depth_c {};
+        int min_x {};
+        int max_x {};
+        int min_y {};
+        int max_y {};
+    };
+
+    std::array<float, kWidth * kHeight> depth_;
+
+    // Farthest depth of each tile at level 0, halved in both directions at
+    // every following level.
+    std::array<std::vector<float>, kLevels> pyramid_;
+
+    std::vector<Triangle> triangles_;
+
+    std::vector<uint8_t> debug_image_;
+
+    Matrix4 view_projection_ {1.0f};
+
+    auto AddTriangles(Mesh* mesh, const Matrix4& view_projection) -> void;
+
+    auto RasterizeTileRow(int tile_y) -> void;
+
+    auto BuildPyramid() -> void;
+};
+
+}
\ No newline at end of file
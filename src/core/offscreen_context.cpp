@@ -0,0 +1,131 @@
+/*
+===========================================================================
+  VGLX https://vglx.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#include "vglx/core/offscreen_context.hpp"
+
+#include "utilities/logger.hpp"
+
+#include <glad/glad.h>
+
+#ifdef VGLX_USE_EGL
+#define EGL_NO_X11
+#define MESA_EGL_NO_X11_HEADERS
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+#endif
+
+#include <format>
+
+namespace vglx {
+
+#ifdef VGLX_USE_EGL
+
+class OffscreenContext::Impl {
+public:
+    auto Initialize() -> std::expected<void, std::string> {
+        const auto get_platform_display = reinterpret_cast<PFNEGLGETPLATFORMDISPLAYEXTPROC>(
+            eglGetProcAddress("eglGetPlatformDisplayEXT")
+        );
+        if (get_platform_display == nullptr) {
+            return std::unexpected("EGL_EXT_platform_base is not supported");
+        }
+
+        display_ = get_platform_display(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, nullptr);
+        if (display_ == EGL_NO_DISPLAY) {
+            return std::unexpected("Failed to get a surfaceless EGL display");
+        }
+
+        auto major = EGLint {0};
+        auto minor = EGLint {0};
+        if (!eglInitialize(display_, &major, &minor)) {
+            display_ = EGL_NO_DISPLAY;
+            return std::unexpected(std::format("Failed to initialize EGL (0x{:x})", eglGetError()));
+        }
+
+        if (!eglBindAPI(EGL_OPENGL_API)) {
+            return std::unexpected("EGL does not support the desktop OpenGL API");
+        }
+
+        const EGLint context_attributes[] = {
+            EGL_CONTEXT_MAJOR_VERSION, 4,
+            EGL_CONTEXT_MINOR_VERSION, 1,
+            EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
+            EGL_NONE
+        };
+
+        // Surfaceless contexts never draw to an EGL surface, so no config is
+        // needed when the driver allows it.
+        context_ = eglCreateContext(display_, EGL_NO_CONFIG_KHR, EGL_NO_CONTEXT, context_attributes);
+        if (context_ == EGL_NO_CONTEXT) {
+            return std::unexpected(std::format("Failed to create an EGL context (0x{:x})", eglGetError()));
+        }
+
+        if (!eglMakeCurrent(display_, EGL_NO_SURFACE, EGL_NO_SURFACE, context_)) {
+            return std::unexpected(std::format("Failed to make the EGL context current (0x{:x})", eglGetError()));
+        }
+
+        if (!gladLoadGLLoader(reinterpret_cast<GLADloadproc>(eglGetProcAddress))) {
+            return std::unexpected("Failed to initialize GLAD OpenGL loader");
+        }
+
+        VGLX_LOG(
+            LogLevel::Info,
+            "Offscreen context: {} | {}",
+            reinterpret_cast<const char*>(glGetString(GL_RENDERER)),
+            reinterpret_cast<const char*>(glGetString(GL_VERSION))
+        );
+
+        return {};
+    }
+
+    ~Impl() {
+        if (display_ == EGL_NO_DISPLAY) return;
+        eglMakeCurrent(display_, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+        if (context_ != EGL_NO_CONTEXT) {
+            eglDestroyContext(display_, context_);
+        }
+        eglTerminate(display_);
+    }
+
+private:
+    EGLDisplay display_ {EGL_NO_DISPLAY};
+
+    EGLContext context_ {EGL_NO_CONTEXT};
+};
+
+#else
+
+class OffscreenContext::Impl {
+public:
+    auto Initialize() -> std::expected<void, std::string> {
+        return std::unexpected("Offscreen contexts require a build with VGLX_ENABLE_EGL");
+    }
+};
+
+#endif
+
+OffscreenContext::OffscreenContext() : impl_(std::make_unique<Impl>()) {}
+
+OffscreenContext::OffscreenContext(OffscreenContext&&) noexcept = default;
+
+auto OffscreenContext::operator=(OffscreenContext&&) noexcept -> OffscreenContext& = default;
+
+auto OffscreenContext::Initialize() -> std::expected<void, std::string> {
+    return impl_->Initialize();
+}
+
+auto OffscreenContext::IsSupported() -> bool {
+#ifdef VGLX_USE_EGL
+    return true;
+#else
+    return false;
+#endif
+}
+
+OffscreenContext::~OffscreenContext() = default;
+
+}
\ No newline at end of file
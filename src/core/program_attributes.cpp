@@ -85,6 +85,28 @@ ProgramAttributes::ProgramAttributes(
     key |= (tangent ? 1 : 0) << 25; // 1 bit
     key |= (specular_map ? 1 : 0) << 26; // 1 bit
     key |= (texture_map ? 1 : 0) << 27; // 1 bit
+    // Bit 28 marks depth-only variants, see DepthOnly.
+}
+
+auto ProgramAttributes::DepthOnly() const -> ProgramAttributes {
+    auto attrs = *this;
+    attrs.vertex_shader = {};
+    attrs.fragment_shader = {};
+    attrs.num_lights = 0;
+    attrs.color = false;
+    attrs.flat_shaded = false;
+    attrs.fog = false;
+    attrs.tangent = false;
+    attrs.two_sided = false;
+    attrs.vertex_color = false;
+    attrs.albedo_map = false;
+    attrs.alpha_map = false;
+    attrs.normal_map = false;
+    attrs.specular_map = false;
+    attrs.texture_map = false;
+    attrs.depth_only = true;
+    attrs.key = (instancing ? 1 : 0) << 23 | 1 << 28;
+    return attrs;
 }
 
 }
\ No newline at end of file
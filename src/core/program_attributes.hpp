@@ -47,11 +47,18 @@ struct ProgramAttributes {
     bool specular_map {false};
     bool texture_map {false};
 
+    // Position-only program of the depth pre-pass.
+    bool depth_only {false};
+
     ProgramAttributes(
         Renderable* renderable,
         const LightsCounter& lights,
         const Scene* scene
     );
+
+    // Depth-only variant of the program. Only instancing changes how
+    // positions are computed, so all materials share one of two variants.
+    [[nodiscard]] auto DepthOnly() const -> ProgramAttributes;
 };
 
 }
\ No newline at end of file
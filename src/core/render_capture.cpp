@@ -0,0 +1,541 @@
+/*
+===========================================================================
+  VGLX https://vglx.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#include "vglx/core/render_capture.hpp"
+
+#include "core/render_capture_file.hpp"
+#include "renderer/gl/gl_device.hpp"
+#include "renderer/gl/gl_framebuffer.hpp"
+
+#include <glad/glad.h>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <optional>
+#include <string_view>
+#include <unordered_map>
+
+namespace vglx {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+using Command = RenderCommandType;
+
+auto elapsed_ms(Clock::time_point start, Clock::time_point end) {
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+auto key(uint32_t a, uint32_t b) -> uint64_t {
+    return (static_cast<uint64_t>(a) << 32) | b;
+}
+
+auto as_string(std::span<const std::byte> payload) -> std::string {
+    return {reinterpret_cast<const char*>(payload.data()), payload.size()};
+}
+
+auto hash(std::span<const std::byte> payload) -> size_t {
+    return std::hash<std::string_view> {}({
+        reinterpret_cast<const char*>(payload.data()),
+        payload.size()
+    });
+}
+
+// Graphics state as seen by the analysis. Anything the stream has not set
+// yet is unknown, so the first bind or upload of each kind never counts as
+// redundant.
+struct TrackedState {
+    std::optional<uint32_t> vao;
+    std::optional<uint32_t> program;
+    std::optional<uint32_t> unit;
+    std::unordered_map<uint32_t, uint32_t> buffers;
+    std::unordered_map<uint32_t, uint32_t> element_buffers;
+    std::unordered_map<uint64_t, uint32_t> indexed_buffers;
+    std::unordered_map<uint32_t, uint32_t> textures;
+    std::unordered_map<uint64_t, std::array<uint32_t, 4>> fixed_function;
+    std::unordered_map<uint32_t, std::unordered_map<uint32_t, std::vector<std::byte>>> uniforms;
+    std::unordered_map<uint32_t, size_t> buffer_contents;
+    std::unordered_map<uint32_t, size_t> texture_contents;
+
+    // The element array binding is part of the bound vertex array.
+    auto BufferBinding(uint32_t target) -> uint32_t& {
+        return target == GL_ELEMENT_ARRAY_BUFFER
+            ? element_buffers[vao.value_or(0)]
+            : buffers[target];
+    }
+};
+
+template <typename T>
+auto replace(std::optional<T>& current, T value) {
+    const auto same = current == value;
+    current = value;
+    return same;
+}
+
+template <typename Map, typename Key, typename Value>
+auto replace(Map& map, const Key& key, const Value& value) {
+    const auto [it, inserted] = map.try_emplace(key, value);
+    if (inserted) return false;
+    const auto same = it->second == value;
+    it->second = value;
+    return same;
+}
+
+// Returns the payload size if uploading it to the given store repeats the
+// current contents, or zero otherwise.
+auto replace_contents(
+    std::unordered_map<uint32_t, size_t>& contents,
+    uint32_t id,
+    std::span<const std::byte> payload,
+    size_t expected_size
+) -> size_t {
+    if (payload.size() != expected_size || payload.empty()) {
+        contents.erase(id);
+        return 0;
+    }
+    return replace(contents, id, hash(payload)) ? payload.size() : 0;
+}
+
+auto find_redundancy(
+    TrackedState& state,
+    const RenderCommand& command,
+    std::span<const std::byte> payload
+) -> std::optional<std::pair<Redundancy, size_t>> {
+    const auto& args = command.args;
+    const auto bind = [](bool same) -> std::optional<std::pair<Redundancy, size_t>> {
+        if (!same) return std::nullopt;
+        return std::pair {Redundancy::Bind, size_t {0}};
+    };
+    const auto fixed_function = [&](uint32_t id) -> std::optional<std::pair<Redundancy, size_t>> {
+        if (!replace(state.fixed_function, key(static_cast<uint32_t>(command.type), id), args)) {
+            return std::nullopt;
+        }
+        return std::pair {Redundancy::State, size_t {0}};
+    };
+    const auto upload = [](size_t bytes) -> std::optional<std::pair<Redundancy, size_t>> {
+        if (bytes == 0) return std::nullopt;
+        return std::pair {Redundancy::Upload, bytes};
+    };
+
+    switch (command.type) {
+        case Command::BindVertexArray:
+            return bind(replace(state.vao, args[0]));
+        case Command::UseProgram:
+            return bind(replace(state.program, args[0]));
+        case Command::ActiveTexture:
+            return bind(replace(state.unit, args[0]));
+        case Command::BindBuffer: {
+            auto& bound = state.BufferBinding(args[0]);
+            const auto same = bound == args[1] && bound != 0;
+            bound = args[1];
+            return bind(same);
+        }
+        case Command::BindBufferBase:
+            return bind(replace(state.indexed_buffers, key(args[0], args[1]), args[2]));
+        case Command::BindTexture:
+            return bind(replace(state.textures, state.unit.value_or(0), args[0]));
+        case Command::Enable:
+        case Command::Disable: {
+            // Enable and Disable share one slot per capability.
+            const auto enabled = command.type == Command::Enable;
+            const auto slot = key(static_cast<uint32_t>(Command::Enable), args[0]);
+            const auto value = std::array<uint32_t, 4> {enabled, 0, 0, 0};
+            if (!replace(state.fixed_function, slot, value)) return std::nullopt;
+            return std::pair {Redundancy::State, size_t {0}};
+        }
+        case Command::PolygonMode:
+            return fixed_function(args[0]);
+        case Command::Viewport:
+        case Command::DepthMask:
+        case Command::DepthFunc:
+        case Command::ColorMask:
+        case Command::PolygonOffset:
+        case Command::BlendFunc:
+        case Command::ClearColor:
+        case Command::FrontFace:
+            return fixed_function(0);
+        case Command::SetUniform: {
+            auto& values = state.uniforms[state.program.value_or(0)];
+            const auto value = std::vector<std::byte> {payload.begin(), payload.end()};
+            return upload(replace(values, args[0], value) ? payload.size() : 0);
+        }
+        case Command::BufferData:
+        case Command::BufferSubData: {
+            const auto buffer = state.BufferBinding(args[0]);
+            return upload(replace_contents(state.buffer_contents, buffer, payload, args[1]));
+        }
+        case Command::TexImage2D: {
+            const auto texture = state.textures[state.unit.value_or(0)];
+            const auto size = static_cast<size_t>(args[0]) * args[1] * 4;
+            return upload(replace_contents(state.texture_contents, texture, payload, size));
+        }
+        case Command::CreateBuffers:
+        case Command::DeleteBuffers: {
+            for (auto i = size_t {0}; i + sizeof(uint32_t) <= payload.size(); i += sizeof(uint32_t)) {
+                auto buffer = uint32_t {0};
+                std::memcpy(&buffer, payload.data() + i, sizeof(buffer));
+                state.buffer_contents.erase(buffer);
+            }
+            return std::nullopt;
+        }
+        case Command::CreateTexture:
+        case Command::DeleteTexture:
+            state.texture_contents.erase(args[0]);
+            return std::nullopt;
+        case Command::CreateProgram:
+        case Command::DeleteProgram:
+            state.uniforms.erase(args[0]);
+            return std::nullopt;
+        default:
+            return std::nullopt;
+    }
+}
+
+// Maps the resource names and uniform locations of a capture to the ones
+// handed out by the replaying context.
+class Replayer {
+public:
+    explicit Replayer(GLDevice& device)
+      : device_(device), query_target_(device.OcclusionQueryTarget()) {}
+
+    [[nodiscard]] auto Execute(
+        const RenderCommand& command,
+        std::span<const std::byte> payload
+    ) -> std::expected<void, std::string>;
+
+    auto Release() -> void;
+
+private:
+    GLDevice& device_;
+
+    std::unordered_map<uint32_t, GLuint> vaos_;
+    std::unordered_map<uint32_t, GLuint> buffers_;
+    std::unordered_map<uint32_t, GLuint> textures_;
+    std::unordered_map<uint32_t, GLuint> programs_;
+    std::unordered_map<uint32_t, GLuint> queries_;
+    std::unordered_map<uint64_t, GLint> locations_;
+
+    std::vector<std::byte> scratch_;
+
+    uint32_t program_ {0};
+
+    // The capturing driver may support a query target this one does not.
+    GLenum query_target_;
+
+    static auto Lookup(const std::unordered_map<uint32_t, GLuint>& names, uint32_t id) -> GLuint {
+        const auto it = names.find(id);
+        return it == names.end() ? 0 : it->second;
+    }
+
+    auto Ids(std::span<const std::byte> payload) -> std::vector<uint32_t>;
+
+    auto Data(std::span<const std::byte> payload, size_t size) -> const void*;
+};
+
+auto Replayer::Ids(std::span<const std::byte> payload) -> std::vector<uint32_t> {
+    auto ids = std::vector<uint32_t>(payload.size() / sizeof(uint32_t));
+    std::memcpy(ids.data(), payload.data(), ids.size() * sizeof(uint32_t));
+    return ids;
+}
+
+// Streams recorded without contents replay with zeroed data of the same size.
+auto Replayer::Data(std::span<const std::byte> payload, size_t size) -> const void* {
+    if (payload.size() == size) return payload.data();
+    scratch_.assign(size, std::byte {0});
+    return scratch_.data();
+}
+
+auto Replayer::Execute(
+    const RenderCommand& command,
+    std::span<const std::byte> payload
+) -> std::expected<void, std::string> {
+    const auto& args = command.args;
+    const auto as_float = [&](size_t i) { return std::bit_cast<float>(args[i]); };
+
+    switch (command.type) {
+        case Command::CreateVertexArray:
+            vaos_[args[0]] = device_.CreateVertexArray();
+            break;
+        case Command::BindVertexArray:
+            device_.BindVertexArray(Lookup(vaos_, args[0]));
+            break;
+        case Command::CreateBuffers: {
+            const auto ids = Ids(payload);
+            auto names = std::vector<GLuint>(ids.size());
+            device_.CreateBuffers(names);
+            for (auto i = size_t {0}; i < ids.size(); ++i) buffers_[ids[i]] = names[i];
+            break;
+        }
+        case Command::DeleteBuffers: {
+            auto names = std::vector<GLuint> {};
+            for (const auto id : Ids(payload)) {
+                names.emplace_back(Lookup(buffers_, id));
+                buffers_.erase(id);
+            }
+            device_.DeleteBuffers(names);
+            break;
+        }
+        case Command::BindBuffer:
+            device_.BindBuffer(args[0], Lookup(buffers_, args[1]));
+            break;
+        case Command::BindBufferBase:
+            device_.BindBufferBase(args[0], args[1], Lookup(buffers_, args[2]));
+            break;
+        case Command::BufferData:
+            device_.BufferData(args[0], args[1], payload.empty() ? nullptr : payload.data(), args[2]);
+            break;
+        case Command::BufferSubData:
+            device_.BufferSubData(args[0], args[1], Data(payload, args[1]));
+            break;
+        case Command::VertexAttribPointer:
+            device_.VertexAttribPointer(args[0], args[1], args[2], args[3]);
+            break;
+        case Command::EnableVertexAttribArray:
+            device_.EnableVertexAttribArray(args[0]);
+            break;
+        case Command::VertexAttribDivisor:
+            device_.VertexAttribDivisor(args[0], args[1]);
+            break;
+        case Command::CreateTexture:
+            textures_[args[0]] = device_.CreateTexture();
+            break;
+        case Command::DeleteTexture:
+            device_.DeleteTexture(Lookup(textures_, args[0]));
+            textures_.erase(args[0]);
+            break;
+        case Command::ActiveTexture:
+            device_.ActiveTexture(args[0]);
+            break;
+        case Command::BindTexture:
+            device_.BindTexture(Lookup(textures_, args[0]));
+            break;
+        case Command::TexImage2D:
+            device_.TexImage2D(args[0], args[1], args[2], payload.empty() ? nullptr : payload.data());
+            break;
+        case Command::CreateProgram: {
+            const auto program = device_.CreateProgram(decode_shaders(payload));
+            if (program == 0) {
+                return std::unexpected("Failed to build captured program " + std::to_string(args[0]));
+            }
+            programs_[args[0]] = program;
+            break;
+        }
+        case Command::DeleteProgram:
+            device_.DeleteProgram(Lookup(programs_, args[0]));
+            programs_.erase(args[0]);
+            break;
+        case Command::UniformLocation:
+            locations_[key(args[0], args[1])] = device_.UniformLocation(
+                Lookup(programs_, args[0]),
+                as_string(payload)
+            );
+            break;
+        case Command::UniformBlockBinding: {
+            const auto program = Lookup(programs_, args[0]);
+            const auto blocks = device_.ActiveUniformBlocks(program);
+            const auto it = std::ranges::find(blocks, as_string(payload));
+            const auto index = it == blocks.end() ? args[1] : std::distance(blocks.begin(), it);
+            device_.UniformBlockBinding(program, static_cast<GLuint>(index), args[2]);
+            break;
+        }
+        case Command::UseProgram:
+            program_ = args[0];
+            device_.UseProgram(Lookup(programs_, args[0]));
+            break;
+        case Command::SetUniform: {
+            const auto type = static_cast<UniformType>(args[1]);
+            const auto it = locations_.find(key(program_, args[0]));
+            const auto location = it == locations_.end() ? static_cast<GLint>(args[0]) : it->second;
+            device_.SetUniform(location, type, Data(payload, uniform_size(type)));
+            break;
+        }
+        case Command::Enable:
+            device_.Enable(args[0]);
+            break;
+        case Command::Disable:
+            device_.Disable(args[0]);
+            break;
+        case Command::Viewport:
+            device_.Viewport(args[0], args[1], args[2], args[3]);
+            break;
+        case Command::DepthMask:
+            device_.DepthMask(args[0] != 0);
+            break;
+        case Command::DepthFunc:
+            device_.DepthFunc(args[0]);
+            break;
+        case Command::PolygonOffset:
+            device_.PolygonOffset(as_float(0), as_float(1));
+            break;
+        case Command::BlendFunc:
+            device_.BlendFunc(args[0], args[1]);
+            break;
+        case Command::ClearColor:
+            device_.ClearColor(as_float(0), as_float(1), as_float(2), as_float(3));
+            break;
+        case Command::FrontFace:
+            device_.FrontFace(args[0]);
+            break;
+        case Command::PolygonMode:
+            device_.PolygonMode(args[0], args[1]);
+            break;
+        case Command::Clear:
+            device_.Clear(args[0]);
+            break;
+        case Command::Draw:
+            args[2] == 1
+                ? device_.Draw(args[0], args[1], args[3] != 0)
+                : device_.DrawInstanced(args[0], args[1], args[3] != 0, args[2]);
+            break;
+        case Command::ColorMask:
+            device_.ColorMask(args[0] != 0);
+            break;
+        case Command::CreateQuery:
+            queries_[args[0]] = device_.CreateQuery();
+            break;
+        case Command::DeleteQuery:
+            device_.DeleteQuery(Lookup(queries_, args[0]));
+            queries_.erase(args[0]);
+            break;
+        case Command::BeginQuery:
+            device_.BeginQuery(query_target_, Lookup(queries_, args[1]));
+            break;
+        case Command::EndQuery:
+            device_.EndQuery(query_target_);
+            break;
+        case Command::BeginConditionalRender:
+            device_.BeginConditionalRender(Lookup(queries_, args[0]), args[1]);
+            break;
+        case Command::EndConditionalRender:
+            device_.EndConditionalRender();
+            break;
+        default:
+            break;
+    }
+    return {};
+}
+
+auto Replayer::Release() -> void {
+    auto buffers = std::vector<GLuint> {};
+    for (const auto& [id, name] : buffers_) buffers.emplace_back(name);
+    device_.DeleteBuffers(buffers);
+    for (const auto& [id, name] : textures_) device_.DeleteTexture(name);
+    for (const auto& [id, name] : programs_) device_.DeleteProgram(name);
+    for (const auto& [id, name] : queries_) device_.DeleteQuery(name);
+    for (const auto& [id, name] : vaos_) glDeleteVertexArrays(1, &name);
+    buffers_.clear();
+    textures_.clear();
+    programs_.clear();
+    queries_.clear();
+    vaos_.clear();
+}
+
+}
+
+auto FindRedundantCommands(
+    std::span<const RenderCommandStream> frames
+) -> std::vector<RedundantCommand> {
+    auto state = TrackedState {};
+    auto redundant = std::vector<RedundantCommand> {};
+    for (auto frame = size_t {0}; frame < frames.size(); ++frame) {
+        const auto commands = frames[frame].Commands();
+        for (auto index = size_t {0}; index < commands.size(); ++index) {
+            const auto& command = commands[index];
+            const auto found = find_redundancy(state, command, frames[frame].Payload(command));
+            if (!found) continue;
+            redundant.emplace_back(RedundantCommand {
+                .kind = found->first,
+                .frame = frame,
+                .index = index,
+                .type = command.type,
+                .bytes = found->second
+            });
+        }
+    }
+    return redundant;
+}
+
+auto RenderCapture::Load(const std::filesystem::path& path) -> std::expected<RenderCapture, std::string> {
+    auto file = std::ifstream {path, std::ios::binary};
+    if (!file) {
+        return std::unexpected("Unable to open file '" + path.string() + "'");
+    }
+
+    auto frames = read_capture_frames(file);
+    if (!frames) {
+        return std::unexpected(frames.error() + " '" + path.string() + "'");
+    }
+
+    auto capture = RenderCapture {};
+    capture.frames_ = std::move(frames.value());
+    return capture;
+}
+
+auto RenderCapture::Replay() const -> std::expected<ReplayReport, std::string> {
+    if (glCreateProgram == nullptr) {
+        return std::unexpected("Replay requires a current OpenGL context");
+    }
+
+    // Size the target to cover every viewport in the capture.
+    auto width = 0;
+    auto height = 0;
+    for (const auto& frame : frames_) {
+        for (const auto& command : frame.Commands()) {
+            if (command.type != Command::Viewport) continue;
+            width = std::max(width, static_cast<int>(command.args[0] + command.args[2]));
+            height = std::max(height, static_cast<int>(command.args[1] + command.args[3]));
+        }
+    }
+    if (width == 0 || height == 0) {
+        return std::unexpected("Capture does not set a viewport");
+    }
+
+    auto device = GLDevice {};
+    auto framebuffer = GLFramebuffer {width, height};
+    framebuffer.Bind();
+
+    auto replayer = Replayer {device};
+    auto report = ReplayReport {};
+    auto timings = std::array<ReplayCommandTiming, static_cast<size_t>(Command::Count)> {};
+    for (auto i = size_t {0}; i < timings.size(); ++i) {
+        timings[i].type = static_cast<Command>(i);
+    }
+
+    for (const auto& frame : frames_) {
+        const auto frame_start = Clock::now();
+        auto last = frame_start;
+        for (const auto& command : frame.Commands()) {
+            if (auto result = replayer.Execute(command, frame.Payload(command)); !result) {
+                replayer.Release();
+                return std::unexpected(result.error());
+            }
+            const auto now = Clock::now();
+            auto& timing = timings[static_cast<size_t>(command.type)];
+            ++timing.count;
+            timing.cpu_ms += elapsed_ms(last, now);
+            last = now;
+        }
+        device.Finish();
+        report.frames.emplace_back(ReplayFrameTiming {
+            .commands = frame.Size(),
+            .cpu_ms = elapsed_ms(frame_start, last),
+            .total_ms = elapsed_ms(frame_start, Clock::now())
+        });
+    }
+    replayer.Release();
+
+    for (const auto& timing : timings) {
+        if (timing.count > 0) report.commands.emplace_back(timing);
+    }
+    return report;
+}
+
+}
\ No newline at end of file
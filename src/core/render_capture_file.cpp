@@ -0,0 +1,140 @@
+/*
+===========================================================================
+  VGLX https://vglx.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#include "core/render_capture_file.hpp"
+
+#include "utilities/file.hpp"
+
+#include <cstring>
+
+namespace vglx {
+
+namespace {
+
+template <typename T>
+auto write_binary(std::ostream& out, const T& value) {
+    out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template <typename T>
+auto append_binary(std::vector<std::byte>& out, const T& value) {
+    const auto bytes = std::as_bytes(std::span {&value, 1});
+    out.insert(out.end(), bytes.begin(), bytes.end());
+}
+
+}
+
+auto write_capture_header(std::ostream& out) -> void {
+    auto header = CaptureHeader {.magic = {}, .version = kCaptureVersion};
+    std::memcpy(header.magic, kCaptureMagic, sizeof(header.magic));
+    write_binary(out, header);
+}
+
+auto write_capture_frame(std::ostream& out, const RenderCommandStream& stream) -> void {
+    const auto commands = stream.Commands();
+    auto payload_size = uint32_t {0};
+    for (const auto& command : commands) payload_size += command.payload_size;
+
+    write_binary(out, CaptureFrameHeader {
+        .command_count = static_cast<uint32_t>(commands.size()),
+        .payload_size = payload_size
+    });
+
+    for (const auto& command : commands) {
+        write_binary(out, CaptureCommandRecord {
+            .type = static_cast<uint32_t>(command.type),
+            .payload_size = command.payload_size,
+            .args = command.args
+        });
+    }
+
+    for (const auto& command : commands) {
+        const auto payload = stream.Payload(command);
+        out.write(reinterpret_cast<const char*>(payload.data()), payload.size());
+    }
+}
+
+auto read_capture_frames(std::istream& in) -> std::expected<std::vector<RenderCommandStream>, std::string> {
+    auto header = CaptureHeader {};
+    read_binary(in, header);
+    if (!in || std::memcmp(header.magic, kCaptureMagic, sizeof(header.magic)) != 0) {
+        return std::unexpected("Invalid capture file");
+    }
+
+    if (header.version != kCaptureVersion) {
+        return std::unexpected("Unsupported capture version " + std::to_string(header.version));
+    }
+
+    auto frames = std::vector<RenderCommandStream> {};
+    auto records = std::vector<CaptureCommandRecord> {};
+    auto payload = std::vector<std::byte> {};
+    while (in.peek() != std::istream::traits_type::eof()) {
+        auto frame_header = CaptureFrameHeader {};
+        read_binary(in, frame_header);
+
+        records.resize(frame_header.command_count);
+        read_binary(in, records, records.size() * sizeof(CaptureCommandRecord));
+        payload.resize(frame_header.payload_size);
+        read_binary(in, payload, payload.size());
+        if (!in) {
+            return std::unexpected("Truncated capture file at frame " + std::to_string(frames.size()));
+        }
+
+        auto& stream = frames.emplace_back();
+        auto offset = size_t {0};
+        for (const auto& record : records) {
+            if (
+                record.type >= static_cast<uint32_t>(RenderCommandType::Count) ||
+                offset + record.payload_size > payload.size()
+            ) {
+                return std::unexpected("Corrupt command in capture frame " + std::to_string(frames.size() - 1));
+            }
+
+            stream.Append(RenderCommand {
+                .type = static_cast<RenderCommandType>(record.type),
+                .payload_size = record.payload_size,
+                .payload_offset = 0,
+                .args = record.args
+            }, std::span {payload}.subspan(offset, record.payload_size));
+            offset += record.payload_size;
+        }
+    }
+    return frames;
+}
+
+auto encode_shaders(const std::vector<ShaderInfo>& shaders) -> std::vector<std::byte> {
+    auto out = std::vector<std::byte> {};
+    for (const auto& shader : shaders) {
+        append_binary(out, static_cast<uint32_t>(shader.type));
+        append_binary(out, static_cast<uint32_t>(shader.source.size()));
+        const auto source = std::as_bytes(std::span {shader.source});
+        out.insert(out.end(), source.begin(), source.end());
+    }
+    return out;
+}
+
+auto decode_shaders(std::span<const std::byte> payload) -> std::vector<ShaderInfo> {
+    auto shaders = std::vector<ShaderInfo> {};
+    auto offset = size_t {0};
+    while (offset + 2 * sizeof(uint32_t) <= payload.size()) {
+        auto type = uint32_t {0};
+        auto length = uint32_t {0};
+        std::memcpy(&type, payload.data() + offset, sizeof(type));
+        std::memcpy(&length, payload.data() + offset + sizeof(type), sizeof(length));
+        offset += 2 * sizeof(uint32_t);
+        if (offset + length > payload.size()) break;
+
+        shaders.emplace_back(ShaderInfo {
+            .type = static_cast<ShaderType>(type),
+            .source = std::pmr::string {reinterpret_cast<const char*>(payload.data() + offset), length}
+        });
+        offset += length;
+    }
+    return shaders;
+}
+
+}
\ No newline at end of file
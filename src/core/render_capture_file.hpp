@@ -0,0 +1,59 @@
+/*
+===========================================================================
+  VGLX https://vglx.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#pragma once
+
+#include "vglx/core/render_commands.hpp"
+
+#include "core/shader_library.hpp"
+
+#include <array>
+#include <cstdint>
+#include <expected>
+#include <istream>
+#include <ostream>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace vglx {
+
+// A capture file is a header followed by one record per frame: a frame
+// header, the frame's commands and the frame's payload bytes. Values are
+// stored in the byte order of the machine that wrote the file.
+constexpr auto kCaptureMagic = "VCAP";
+constexpr auto kCaptureVersion = uint32_t {1};
+
+struct CaptureHeader {
+    char magic[4];
+    uint32_t version;
+};
+
+struct CaptureFrameHeader {
+    uint32_t command_count;
+    uint32_t payload_size;
+};
+
+struct CaptureCommandRecord {
+    uint32_t type;
+    uint32_t payload_size;
+    std::array<uint32_t, 4> args;
+};
+
+auto write_capture_header(std::ostream& out) -> void;
+
+auto write_capture_frame(std::ostream& out, const RenderCommandStream& stream) -> void;
+
+auto read_capture_frames(std::istream& in) -> std::expected<std::vector<RenderCommandStream>, std::string>;
+
+// Shader sources are stored in the CreateProgram payload as a sequence of
+// shader type, source length and source bytes.
+auto encode_shaders(const std::vector<ShaderInfo>& shaders) -> std::vector<std::byte>;
+
+auto decode_shaders(std::span<const std::byte> payload) -> std::vector<ShaderInfo>;
+
+}
\ No newline at end of file
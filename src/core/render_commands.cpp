@@ -0,0 +1,130 @@
+/*
+===========================================================================
+  VGLX https://vglx.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#include "vglx/core/render_commands.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <format>
+#include <iterator>
+
+namespace vglx {
+
+namespace {
+
+constexpr auto kArgCounts = std::array<uint8_t, static_cast<size_t>(RenderCommandType::Count)> {
+    1, 1, 2, 1, 2, 3, 3, 2, 4, 1, 2, 1, 1, 1, 1, 3,
+    1, 1, 2, 1, 3, 2, 1, 1, 4, 1, 2, 2, 4, 1, 2, 1, 4,
+    1, 1, 1, 2, 1, 2, 0, 1
+};
+
+}
+
+auto GetName(RenderCommandType type) -> std::string_view {
+    using enum RenderCommandType;
+    switch (type) {
+        case CreateVertexArray: return "CreateVertexArray";
+        case BindVertexArray: return "BindVertexArray";
+        case CreateBuffers: return "CreateBuffers";
+        case DeleteBuffers: return "DeleteBuffers";
+        case BindBuffer: return "BindBuffer";
+        case BindBufferBase: return "BindBufferBase";
+        case BufferData: return "BufferData";
+        case BufferSubData: return "BufferSubData";
+        case VertexAttribPointer: return "VertexAttribPointer";
+        case EnableVertexAttribArray: return "EnableVertexAttribArray";
+        case VertexAttribDivisor: return "VertexAttribDivisor";
+        case CreateTexture: return "CreateTexture";
+        case DeleteTexture: return "DeleteTexture";
+        case ActiveTexture: return "ActiveTexture";
+        case BindTexture: return "BindTexture";
+        case TexImage2D: return "TexImage2D";
+        case CreateProgram: return "CreateProgram";
+        case DeleteProgram: return "DeleteProgram";
+        case UniformLocation: return "UniformLocation";
+        case UseProgram: return "UseProgram";
+        case UniformBlockBinding: return "UniformBlockBinding";
+        case SetUniform: return "SetUniform";
+        case Enable: return "Enable";
+        case Disable: return "Disable";
+        case Viewport: return "Viewport";
+        case DepthMask: return "DepthMask";
+        case PolygonOffset: return "PolygonOffset";
+        case BlendFunc: return "BlendFunc";
+        case ClearColor: return "ClearColor";
+        case FrontFace: return "FrontFace";
+        case PolygonMode: return "PolygonMode";
+        case Clear: return "Clear";
+        case Draw: return "Draw";
+        case ColorMask: return "ColorMask";
+        case CreateQuery: return "CreateQuery";
+        case DeleteQuery: return "DeleteQuery";
+        case BeginQuery: return "BeginQuery";
+        case EndQuery: return "EndQuery";
+        case BeginConditionalRender: return "BeginConditionalRender";
+        case EndConditionalRender: return "EndConditionalRender";
+        case DepthFunc: return "DepthFunc";
+        default: return "Unknown";
+    }
+}
+
+auto RenderCommandStream::Count(RenderCommandType type) const -> size_t {
+    return std::ranges::count(commands_, type, &RenderCommand::type);
+}
+
+auto RenderCommandStream::Describe() const -> std::string {
+    auto out = std::string {};
+    for (const auto& command : commands_) {
+        out += GetName(command.type);
+        const auto count = kArgCounts[static_cast<size_t>(command.type)];
+        for (auto i = 0; i < count; ++i) {
+            std::format_to(std::back_inserter(out), " {}", command.args[i]);
+        }
+
+        const auto payload = Payload(command);
+        for (auto i = size_t {0}; i + sizeof(uint32_t) <= payload.size(); i += sizeof(uint32_t)) {
+            auto word = uint32_t {0};
+            std::memcpy(&word, payload.data() + i, sizeof(word));
+            std::format_to(std::back_inserter(out), "{}{:08x}", i == 0 ? " [" : " ", word);
+        }
+        if (!payload.empty()) out += ']';
+        out += '\n';
+    }
+    return out;
+}
+
+auto RenderCommandStream::Clear() -> void {
+    commands_.clear();
+    payload_.clear();
+}
+
+auto RenderCommandStream::Record(
+    RenderCommandType type,
+    std::initializer_list<uint32_t> args,
+    std::span<const std::byte> payload
+) -> void {
+    auto& command = commands_.emplace_back(RenderCommand {
+        .type = type,
+        .payload_size = static_cast<uint32_t>(payload.size()),
+        .payload_offset = static_cast<uint32_t>(payload_.size()),
+        .args = {}
+    });
+    std::ranges::copy_n(args.begin(), std::min(args.size(), command.args.size()), command.args.begin());
+    payload_.insert(payload_.end(), payload.begin(), payload.end());
+}
+
+auto RenderCommandStream::Append(
+    const RenderCommand& command,
+    std::span<const std::byte> payload
+) -> void {
+    auto& appended = commands_.emplace_back(command);
+    appended.payload_size = static_cast<uint32_t>(payload.size());
+    appended.payload_offset = static_cast<uint32_t>(payload_.size());
+    payload_.insert(payload_.end(), payload.begin(), payload.end());
+}
+
+}
\ No newline at end of file
@@ -7,64 +7,265 @@
 
 #include "core/render_lists.hpp"
 
-#include <ranges>
-#include <limits>
+#include "vglx/utilities/tracer.hpp"
+
+#include <algorithm>
+#include <span>
 
 namespace vglx {
 
-// Compare function for sorting meshes based on their z position.
+namespace {
+
+// Subtrees per thread that partitioning aims for.
+constexpr auto kSubtreesPerThread = size_t {16};
 
+// Levels below the scene that partitioning may split.
+constexpr auto kMaxSplitDepth = 4;
+
+}
 
 auto RenderLists::ProcessScene(Scene* scene, Camera* camera) -> void {
+    VGLX_TRACE_ZONE("ProcessScene");
+    Collect(scene, camera);
+    Sort(camera);
+}
+
+auto RenderLists::Collect(Scene* scene, Camera* camera) -> void {
     Reset();
 
     const auto frustum = camera->GetFrustum();
+    if (jobs_ && jobs_->WorkerCount() > 0 && last_node_count_ >= kParallelThreshold) {
+        CollectParallel(scene, frustum);
+    } else {
+        for (const auto& child : scene->Children()) {
+            ProcessNode(child.get(), frustum, lists_);
+        }
+    }
+    last_node_count_ = lists_.nodes;
+}
+
+auto RenderLists::CollectParallel(Scene* scene, const Frustum& frustum) -> void {
+    // Subtrees are split into their root and their children until there are
+    // enough of them for stealing to balance the work. Splitting keeps the
+    // traversal order, so merging the chunks in order reproduces the serial
+    // lists for any number of threads. A renderable that is not drawn hides
+    // its descendants, so it stays whole to be rejected with them.
+    const auto target = (jobs_->WorkerCount() + 1) * kSubtreesPerThread;
+    subtrees_.clear();
     for (const auto& child : scene->Children()) {
-        ProcessNode(child.get(), frustum);
+        subtrees_.emplace_back(child.get(), true);
+    }
+    for (auto depth = 0; depth < kMaxSplitDepth && subtrees_.size() < target; ++depth) {
+        auto split = false;
+        expanded_.clear();
+        for (auto subtree : subtrees_) {
+            const auto& children = subtree.node->Children();
+            if (subtree.recursive && !children.empty() && subtree.node->IsRenderable() &&
+                subtree.visibility == Visibility::Unknown) {
+                subtree.visibility = IsVisible(static_cast<Renderable*>(subtree.node), frustum)
+                    ? Visibility::Visible
+                    : Visibility::Hidden;
+            }
+            if (!subtree.recursive || children.empty() || subtree.visibility == Visibility::Hidden) {
+                expanded_.emplace_back(subtree);
+                continue;
+            }
+            expanded_.emplace_back(subtree.node, false, subtree.visibility);
+            for (const auto& child : children) {
+                expanded_.emplace_back(child.get(), true);
+            }
+            split = true;
+        }
+        subtrees_.swap(expanded_);
+        if (!split) break;
     }
 
-    const auto c = camera->GetWorldPosition();
-    const auto f = camera->Forward();
-    const auto compare = [&](auto* renderable) {
-        return Dot(renderable->GetWorldPosition() - c, f);
-    };
+    const auto chunk_size = std::max(subtrees_.size() / target, size_t {1});
+    const auto chunk_count = (subtrees_.size() + chunk_size - 1) / chunk_size;
+    if (buckets_.size() < chunk_count) {
+        buckets_.resize(chunk_count);
+    }
+
+    jobs_->ParallelFor(chunk_count, [&](size_t begin, size_t end) {
+        for (auto chunk = begin; chunk < end; ++chunk) {
+            auto& bucket = buckets_[chunk];
+            bucket.Clear();
+            const auto last = std::min((chunk + 1) * chunk_size, subtrees_.size());
+            for (auto i = chunk * chunk_size; i < last; ++i) {
+                const auto& subtree = subtrees_[i];
+                ProcessNode(subtree.node, frustum, bucket, subtree.recursive, subtree.visibility);
+            }
+        }
+    }, 1);
+
+    const auto buckets = std::span {buckets_}.first(chunk_count);
+    auto opaque = size_t {0};
+    auto transparent = size_t {0};
+    auto lights = size_t {0};
+    auto occluders = size_t {0};
+    for (const auto& bucket : buckets) {
+        opaque += bucket.opaque.size();
+        transparent += bucket.transparent.size();
+        lights += bucket.lights.size();
+        occluders += bucket.occluders.size();
+    }
+    lists_.opaque.reserve(opaque);
+    lists_.transparent.reserve(transparent);
+    lists_.lights.reserve(lights);
+    lists_.occluders.reserve(occluders);
+    for (const auto& bucket : buckets) {
+        lists_.opaque.insert(lists_.opaque.end(), bucket.opaque.begin(), bucket.opaque.end());
+        lists_.transparent.insert(lists_.transparent.end(), bucket.transparent.begin(), bucket.transparent.end());
+        lists_.lights.insert(lists_.lights.end(), bucket.lights.begin(), bucket.lights.end());
+        lists_.occluders.insert(lists_.occluders.end(), bucket.occluders.begin(), bucket.occluders.end());
+        lists_.nodes += bucket.nodes;
+    }
+}
 
+auto RenderLists::Sort(Camera* camera) -> void {
     // Sort opaque renderables front-to-back to optimize depth buffer writes.
-    std::ranges::stable_sort(opaque_, std::ranges::less {}, compare);
+    SortByDepth(lists_.opaque, camera, false);
 
     // Sort transparent renderables back-to-front to ensure correct blending.
-    std::ranges::stable_sort(transparent_, std::ranges::greater {}, compare);
+    SortByDepth(lists_.transparent, camera, true);
+}
+
+auto RenderLists::RemoveOccluded(const OcclusionBuffer& buffer) -> size_t {
+    const auto occluded = [&buffer](Renderable* renderable) {
+        // Sprites turn to face the camera, so their bounds are not tested.
+        if (!Renderable::IsMeshType(renderable)) return false;
+        if (static_cast<Mesh*>(renderable)->occluder) return false;
+        auto box = renderable->BoundingBox();
+        box.ApplyTransform(renderable->GetRenderTransform());
+        return buffer.IsOccluded(box);
+    };
+
+    const auto count = lists_.opaque.size() + lists_.transparent.size();
+    std::erase_if(lists_.opaque, occluded);
+    std::erase_if(lists_.transparent, occluded);
+    return count - lists_.opaque.size() - lists_.transparent.size();
+}
+
+auto RenderLists::RemoveHidden(const VisibilityHistory& history) -> size_t {
+    const auto hidden = [&](Renderable* renderable) {
+        if (!UsesOcclusionQuery(renderable) || !history.IsHidden(renderable->Id())) {
+            return false;
+        }
+        hidden_.emplace_back(renderable);
+        return true;
+    };
+
+    const auto count = hidden_.size();
+    std::erase_if(lists_.opaque, hidden);
+    std::erase_if(lists_.transparent, hidden);
+    return hidden_.size() - count;
+}
+
+auto RenderLists::UsesOcclusionQuery(Renderable* renderable) -> bool {
+    return renderable->GetNodeType() == Node::Type::Mesh &&
+           static_cast<Mesh*>(renderable)->occlusion_query;
+}
+
+auto RenderLists::SortByDepth(
+    std::pmr::vector<Renderable*>& renderables,
+    Camera* camera,
+    bool back_to_front
+) -> void {
+    // Renderables are drawn, and the view built, from the render transforms
+    // of this frame, which are already up to date.
+    const auto translation = [](const Node* node) {
+        const auto& column = node->CachedRenderTransform()[3];
+        return Vector3 {column.x, column.y, column.z};
+    };
+    const auto& view = camera->CachedRenderTransform();
+    const auto c = translation(camera);
+    const auto f = Vector3 {-view[2].x, -view[2].y, -view[2].z};
+
+    // std::stable_sort allocates a temporary buffer on every call, so depths
+    // are computed once into reused keys, and ties keep collection order.
+    sort_keys_.clear();
+    for (auto i = size_t {0}; i < renderables.size(); ++i) {
+        const auto depth = Dot(translation(renderables[i]) - c, f);
+        sort_keys_.emplace_back(back_to_front ? -depth : depth, static_cast<uint32_t>(i));
+    }
+    std::ranges::sort(sort_keys_, [](const SortKey& a, const SortKey& b) {
+        return a.depth != b.depth ? a.depth < b.depth : a.index < b.index;
+    });
+
+    sorted_.clear();
+    for (const auto& key : sort_keys_) {
+        sorted_.emplace_back(renderables[key.index]);
+    }
+    renderables.swap(sorted_);
 }
 
-auto RenderLists::ProcessNode(Node* node, const Frustum& frustum) -> void {
+auto RenderLists::ProcessNode(
+    Node* node,
+    const Frustum& frustum,
+    Lists& lists,
+    bool recursive,
+    Visibility visibility
+) -> void {
     const auto type = node->GetNodeType();
+    ++lists.nodes;
 
     if (node->IsRenderable()) {
         auto renderable = static_cast<Renderable*>(node);
-        auto material = renderable->GetMaterial();
+        const auto visible = visibility == Visibility::Unknown
+            ? IsVisible(renderable, frustum)
+            : visibility == Visibility::Visible;
+        if (!visible) return;
 
-        if (!material->visible) return;
-        if (!Renderable::CanRender(renderable)) return;
-        if (!Renderable::InFrustum(renderable, frustum)) return;
+        if (type == Node::Type::Mesh && static_cast<Mesh*>(renderable)->occluder) {
+            lists.occluders.emplace_back(static_cast<Mesh*>(renderable));
+        }
 
         renderable->GetMaterial()->transparent
-            ? transparent_.emplace_back(renderable)
-            : opaque_.emplace_back(renderable);
+            ? lists.transparent.emplace_back(renderable)
+            : lists.opaque.emplace_back(renderable);
     }
 
     if (type == Node::Type::Light) {
-        lights_.emplace_back(static_cast<Light*>(node));
+        lists.lights.emplace_back(static_cast<Light*>(node));
     }
 
+    if (!recursive) return;
     for (const auto& child : node->Children()) {
-        ProcessNode(child.get(), frustum);
+        ProcessNode(child.get(), frustum, lists);
     }
 }
 
+auto RenderLists::IsVisible(Renderable* renderable, const Frustum& frustum) -> bool {
+    return renderable->GetMaterial()->visible &&
+           Renderable::CanRender(renderable) &&
+           Renderable::InFrustum(renderable, frustum);
+}
+
+auto RenderLists::Lists::Clear() -> void {
+    opaque.clear();
+    transparent.clear();
+    lights.clear();
+    occluders.clear();
+    nodes = 0;
+}
+
 auto RenderLists::Reset() -> void {
-    opaque_.clear();
-    transparent_.clear();
-    lights_.clear();
+    if (!arena_) {
+        lists_.Clear();
+        hidden_.clear();
+        return;
+    }
+
+    // The previous lists point into an earlier frame of the arena.
+    const auto memory = arena_->Resource();
+    rebind_vector(lists_.opaque, memory);
+    rebind_vector(lists_.transparent, memory);
+    rebind_vector(lists_.lights, memory);
+    rebind_vector(lists_.occluders, memory);
+    rebind_vector(hidden_, memory);
+    lists_.nodes = 0;
+    rebind_vector(sort_keys_, memory);
+    rebind_vector(sorted_, memory);
 }
 
 }
\ No newline at end of file
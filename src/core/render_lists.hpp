@@ -8,13 +8,21 @@
 #pragma once
 
 #include "vglx/cameras/camera.hpp"
+#include "vglx/core/job_system.hpp"
 #include "vglx/lights/light.hpp"
 #include "vglx/math/frustum.hpp"
+#include "vglx/nodes/mesh.hpp"
 #include "vglx/nodes/node.hpp"
 #include "vglx/nodes/renderable.hpp"
 #include "vglx/nodes/scene.hpp"
 
+#include "core/frame_arena.hpp"
+#include "core/occlusion_buffer.hpp"
+#include "core/visibility_history.hpp"
+
+#include <cstdint>
 #include <memory>
+#include <memory_resource>
 #include <span>
 #include <vector>
 
@@ -22,28 +30,133 @@ namespace vglx {
 
 class RenderLists {
 public:
+    // Scenes with at least this many nodes in the previous frame are culled
+    // in parallel when a job system is set.
+    static constexpr auto kParallelThreshold = size_t {4096};
+
+    RenderLists() = default;
+
+    // Lists are rebuilt in the arena's current frame on every collection,
+    // so the owner must begin the arena's frame before calling Collect.
+    explicit RenderLists(FrameArena* arena) : arena_(arena) {}
+
+    // Large scenes are split into subtrees that are culled on the job
+    // system's workers. The lists are identical to serial collection.
+    auto SetJobSystem(JobSystem* jobs) -> void { jobs_ = jobs; }
+
     auto ProcessScene(Scene* scene, Camera* camera) -> void;
 
+    auto Collect(Scene* scene, Camera* camera) -> void;
+
+    auto Sort(Camera* camera) -> void;
+
+    // Removes renderables hidden behind the occluders rasterized into
+    // `buffer` and returns how many were removed.
+    auto RemoveOccluded(const OcclusionBuffer& buffer) -> size_t;
+
+    // Moves renderables that occlusion queries last found hidden to Hidden()
+    // and returns how many were moved.
+    auto RemoveHidden(const VisibilityHistory& history) -> size_t;
+
+    // Whether the renderable is tested with occlusion queries. Sprites and
+    // instanced meshes draw outside the bounds of their geometry.
+    [[nodiscard]] static auto UsesOcclusionQuery(Renderable* renderable) -> bool;
+
     [[nodiscard]] auto Opaque() const -> std::span<Renderable* const> {
-        return opaque_;
+        return lists_.opaque;
     }
 
     [[nodiscard]] auto Transparent() const -> std::span<Renderable* const> {
-        return transparent_;
+        return lists_.transparent;
     }
 
     [[nodiscard]] auto Lights() const -> std::span<Light* const> {
-        return lights_;
+        return lists_.lights;
+    }
+
+    // Visible meshes marked as occluders.
+    [[nodiscard]] auto Occluders() const -> std::span<Mesh* const> {
+        return lists_.occluders;
+    }
+
+    // Renderables in the view frustum removed by RemoveHidden.
+    [[nodiscard]] auto Hidden() const -> std::span<Renderable* const> {
+        return hidden_;
     }
 
 private:
-    std::vector<Renderable*> opaque_;
+    struct Lists {
+        std::pmr::vector<Renderable*> opaque;
+        std::pmr::vector<Renderable*> transparent;
+        std::pmr::vector<Light*> lights;
+        std::pmr::vector<Mesh*> occluders;
+        size_t nodes {0};
+
+        auto Clear() -> void;
+    };
+
+    // Whether a renderable is drawn, if already known.
+    enum class Visibility : uint8_t {
+        Unknown,
+        Visible,
+        Hidden
+    };
+
+    // A node, with or without its descendants, in scene traversal order.
+    // Renderables tested while partitioning keep the result so that their
+    // chunk does not test them again.
+    struct Subtree {
+        Node* node;
+        bool recursive;
+        Visibility visibility {Visibility::Unknown};
+    };
+
+    FrameArena* arena_ {nullptr};
+
+    JobSystem* jobs_ {nullptr};
+
+    Lists lists_;
+
+    std::pmr::vector<Renderable*> hidden_;
+
+    // Output of each parallel chunk, merged in chunk order. They live on
+    // the heap rather than in the arena, which is not thread-safe, and keep
+    // their capacity between frames.
+    std::vector<Lists> buckets_;
+
+    std::vector<Subtree> subtrees_;
+
+    std::vector<Subtree> expanded_;
+
+    size_t last_node_count_ {0};
+
+    // Depth keys and the reordered list. Without an arena they are kept
+    // between frames so that sorting does not allocate once they reach the
+    // scene's size.
+    struct SortKey {
+        float depth;
+        uint32_t index;
+    };
+
+    std::pmr::vector<SortKey> sort_keys_;
+
+    std::pmr::vector<Renderable*> sorted_;
+
+    auto CollectParallel(Scene* scene, const Frustum& frustum) -> void;
 
-    std::vector<Renderable*> transparent_;
+    auto ProcessNode(
+        Node* node,
+        const Frustum& frustum,
+        Lists& lists,
+        bool recursive = true,
+        Visibility visibility = Visibility::Unknown
+    ) -> void;
 
-    std::vector<Light*> lights_;
+    // Whether a renderable is drawn. A rejected renderable hides its whole
+    // subtree.
+    [[nodiscard]] static auto IsVisible(Renderable* renderable, const Frustum& frustum) -> bool;
 
-    auto ProcessNode(Node* node, const Frustum& frustum) -> void;
+    auto SortByDepth(std::pmr::vector<Renderable*>& renderables, Camera* camera, bool back_to_front) -> void;
 
     auto Reset() -> void;
 };
@@ -26,6 +26,14 @@ auto Renderer::Render(Scene* scene, Camera* camera) -> void {
     impl_->Render(scene, camera);
 }
 
+auto Renderer::Extract(Scene* scene, Camera* camera) -> void {
+    impl_->Extract(scene, camera);
+}
+
+auto Renderer::Submit() -> void {
+    impl_->Submit();
+}
+
 auto Renderer::SetViewport(int x, int y, int width, int height) -> void {
     impl_->SetViewport(x, y, width, height);
 }
@@ -34,10 +42,46 @@ auto Renderer::SetClearColor(const Color& color) -> void {
     impl_->SetClearColor(color);
 }
 
+auto Renderer::SetJobSystem(std::shared_ptr<JobSystem> jobs) -> void {
+    impl_->SetJobSystem(std::move(jobs));
+}
+
 auto Renderer::RenderedObjectsPerFrame() const -> size_t {
     return impl_->RenderedObjectsPerFrame();
 }
 
+auto Renderer::GetFrameProfile() const -> const FrameProfile& {
+    return impl_->GetFrameProfile();
+}
+
+auto Renderer::GetGpuMaterialTimings() const -> const std::vector<GpuMaterialTiming>& {
+    return impl_->GetGpuMaterialTimings();
+}
+
+auto Renderer::BeginGpuPass(GpuPass pass) -> void {
+    impl_->BeginGpuPass(pass);
+}
+
+auto Renderer::EndGpuPass(GpuPass pass) -> void {
+    impl_->EndGpuPass(pass);
+}
+
+auto Renderer::GetCommandStream() const -> const RenderCommandStream* {
+    return impl_->GetCommandStream();
+}
+
+auto Renderer::ReadPixels(ReadbackCallback callback) -> void {
+    impl_->ReadPixels(std::move(callback));
+}
+
+auto Renderer::ReadPixels(const std::filesystem::path& path) -> void {
+    impl_->ReadPixels(path);
+}
+
+auto Renderer::FlushReadbacks() -> void {
+    impl_->FlushReadbacks();
+}
+
 Renderer::~Renderer() = default;
 
 }
\ No newline at end of file
@@ -14,6 +14,8 @@
 
 #include "utilities/logger.hpp"
 
+#include "shaders/headers/depth_frag.h"
+#include "shaders/headers/depth_vert.h"
 #include "shaders/headers/phong_material_frag.h"
 #include "shaders/headers/phong_material_vert.h"
 #include "shaders/headers/sprite_material_frag.h"
@@ -27,52 +29,68 @@
 #include "shaders/snippets/headers/vert_global_params_glsl.h"
 #include "shaders/snippets/headers/vert_main_varyings_glsl.h"
 
-#include <unordered_map>
+#include <array>
+#include <format>
+#include <iterator>
+#include <utility>
 
 namespace vglx {
 
-auto ShaderLibrary::GetShaderSource(const ProgramAttributes& attrs) const -> std::vector<ShaderInfo> {
+auto ShaderLibrary::GetShaderSource(
+    const ProgramAttributes& attrs,
+    std::pmr::memory_resource* memory
+) const -> std::vector<ShaderInfo> {
+    if (attrs.depth_only) {
+        return {{
+            ShaderType::kVertexShader,
+            ProcessShader(attrs, _SHADER_depth_vert, memory)
+        }, {
+            ShaderType::kFragmentShader,
+            ProcessShader(attrs, _SHADER_depth_frag, memory)
+        }};
+    }
+
     if (attrs.type == Material::Type::PhongMaterial) {
         return {{
             ShaderType::kVertexShader,
-            ProcessShader(attrs, _SHADER_phong_material_vert)
+            ProcessShader(attrs, _SHADER_phong_material_vert, memory)
         }, {
             ShaderType::kFragmentShader,
-            ProcessShader(attrs, _SHADER_phong_material_frag)
+            ProcessShader(attrs, _SHADER_phong_material_frag, memory)
         }};
     }
 
     if (attrs.type == Material::Type::ShaderMaterial) {
         return {{
             ShaderType::kVertexShader,
-            ProcessShader(attrs, attrs.vertex_shader)
+            ProcessShader(attrs, attrs.vertex_shader, memory)
         }, {
             ShaderType::kFragmentShader,
-            ProcessShader(attrs, attrs.fragment_shader)
+            ProcessShader(attrs, attrs.fragment_shader, memory)
         }};
     }
 
     if (attrs.type == Material::Type::SpriteMaterial) {
         return {{
             ShaderType::kVertexShader,
-            ProcessShader(attrs, _SHADER_sprite_material_vert)
+            ProcessShader(attrs, _SHADER_sprite_material_vert, memory)
         }, {
             ShaderType::kFragmentShader,
-            ProcessShader(attrs, _SHADER_sprite_material_frag)
+            ProcessShader(attrs, _SHADER_sprite_material_frag, memory)
         }};
     }
 
     if (attrs.type == Material::Type::UnlitMaterial) {
         return {{
             ShaderType::kVertexShader,
-            ProcessShader(attrs, _SHADER_unlit_material_vert)
+            ProcessShader(attrs, _SHADER_unlit_material_vert, memory)
         }, {
             ShaderType::kFragmentShader,
-            ProcessShader(attrs, _SHADER_unlit_material_frag)
+            ProcessShader(attrs, _SHADER_unlit_material_frag, memory)
         }};
     }
 
-    Logger::Log(
+    VGLX_LOG(
         LogLevel::Error,
         "Shader source not found for unknown material {}_material",
         Material::TypeToString(attrs.type)
@@ -83,9 +101,10 @@ auto ShaderLibrary::GetShaderSource(const ProgramAttributes& attrs) const -> std
 
 auto ShaderLibrary::ProcessShader(
     const ProgramAttributes& attrs,
-    std::string_view source
-) const -> std::string {
-    auto output = std::string {source};
+    std::string_view source,
+    std::pmr::memory_resource* memory
+) const -> std::pmr::string {
+    auto output = std::pmr::string {source, memory};
     InjectAttributes(attrs, output);
     ResolveIncludes(output);
     return output;
@@ -93,9 +112,9 @@ auto ShaderLibrary::ProcessShader(
 
 auto ShaderLibrary::InjectAttributes(
     const ProgramAttributes& attrs,
-    std::string& source
+    std::pmr::string& source
 ) const -> void {
-    auto features = std::string {};
+    auto features = std::pmr::string {source.get_allocator()};
 
     if (attrs.color) features += "#define USE_COLOR\n";
     if (attrs.flat_shaded) features += "#define USE_FLAT_SHADED\n";
@@ -111,12 +130,12 @@ auto ShaderLibrary::InjectAttributes(
     if (attrs.texture_map) features += "#define USE_TEXTURE_MAP\n";
 
     const auto lights = attrs.num_lights;
-    features += "#define NUM_LIGHTS " + std::to_string(lights) + '\n';
+    std::format_to(std::back_inserter(features), "#define NUM_LIGHTS {}\n", lights);
 
     const auto token = std::string_view {"#pragma inject_attributes"};
     const auto pos = source.find(token);
-    if (pos == std::string::npos) {
-        Logger::Log(
+    if (pos == std::pmr::string::npos) {
+        VGLX_LOG(
             LogLevel::Error,
             "The '#pragma inject_attributes' token is missing in program {}",
             Material::TypeToString(attrs.type)
@@ -127,20 +146,19 @@ auto ShaderLibrary::InjectAttributes(
     source.replace(pos, token.size(), features);
 }
 
-auto ShaderLibrary::ResolveIncludes(std::string& source) const -> void {
-    static const std::unordered_map<std::string, std::string> include_map = {
-        {"snippets/frag_global_fog.glsl", _SNIPPET_frag_global_fog},
-        {"snippets/frag_global_params.glsl", _SNIPPET_frag_global_params},
-        {"snippets/frag_main_normal.glsl", _SNIPPET_frag_main_normal},
-        {"snippets/utilities.glsl", _SNIPPET_utilities},
-        {"snippets/vert_global_params.glsl", _SNIPPET_vert_global_params},
-        {"snippets/vert_main_varyings.glsl", _SNIPPET_vert_main_varyings}
-    };
-
-    for (const auto& [include, content] : include_map) {
-        auto token = std::string {"#include \"" + include + "\""};
+auto ShaderLibrary::ResolveIncludes(std::pmr::string& source) const -> void {
+    static const auto include_map = std::array<std::pair<std::string_view, std::string_view>, 6> {{
+        {"#include \"snippets/frag_global_fog.glsl\"", _SNIPPET_frag_global_fog},
+        {"#include \"snippets/frag_global_params.glsl\"", _SNIPPET_frag_global_params},
+        {"#include \"snippets/frag_main_normal.glsl\"", _SNIPPET_frag_main_normal},
+        {"#include \"snippets/utilities.glsl\"", _SNIPPET_utilities},
+        {"#include \"snippets/vert_global_params.glsl\"", _SNIPPET_vert_global_params},
+        {"#include \"snippets/vert_main_varyings.glsl\"", _SNIPPET_vert_main_varyings}
+    }};
+
+    for (const auto& [token, content] : include_map) {
         auto pos = source.find(token);
-        if (pos != std::string::npos) {
+        if (pos != std::pmr::string::npos) {
             source.replace(pos, token.size(), content);
         }
     }
@@ -9,6 +9,8 @@
 
 #include "core/program_attributes.hpp"
 
+#include <memory_resource>
+#include <string>
 #include <string_view>
 #include <vector>
 
@@ -21,19 +23,28 @@ enum class ShaderType {
 
 struct ShaderInfo {
     ShaderType type;
-    std::string source;
+    std::pmr::string source;
 };
 
 class ShaderLibrary {
 public:
-    auto GetShaderSource(const ProgramAttributes& attrs) const -> std::vector<ShaderInfo>;
+    // Sources and the strings used to build them are allocated from
+    // `memory`, which only needs to outlive program creation.
+    auto GetShaderSource(
+        const ProgramAttributes& attrs,
+        std::pmr::memory_resource* memory = std::pmr::get_default_resource()
+    ) const -> std::vector<ShaderInfo>;
 
 private:
-    auto ProcessShader(const ProgramAttributes& attrs, std::string_view source) const -> std::string;
+    auto ProcessShader(
+        const ProgramAttributes& attrs,
+        std::string_view source,
+        std::pmr::memory_resource* memory
+    ) const -> std::pmr::string;
 
-    auto InjectAttributes(const ProgramAttributes& attrs, std::string& source) const -> void;
+    auto InjectAttributes(const ProgramAttributes& attrs, std::pmr::string& source) const -> void;
 
-    auto ResolveIncludes(std::string& source) const -> void;
+    auto ResolveIncludes(std::pmr::string& source) const -> void;
 };
 
 }
\ No newline at end of file
@@ -0,0 +1,46 @@
+/*
+===========================================================================
+  VGLX https://vglx.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#include "core/visibility_history.hpp"
+
+namespace vglx {
+
+auto VisibilityHistory::BeginFrame() -> void {
+    ++frame_;
+    std::erase_if(entries_, [this](const auto& entry) {
+        const auto& [object, state] = entry;
+        return !state.pending && frame_ - state.last_query > kExpiry;
+    });
+}
+
+auto VisibilityHistory::IsHidden(uint64_t object) const -> bool {
+    const auto it = entries_.find(object);
+    return it != entries_.end() && !it->second.visible;
+}
+
+auto VisibilityHistory::NeedsQuery(uint64_t object) const -> bool {
+    const auto it = entries_.find(object);
+    if (it == entries_.end()) return true;
+    const auto& entry = it->second;
+    if (entry.pending) return false;
+    return !entry.visible || (frame_ + object) % kVisibleInterval == 0;
+}
+
+auto VisibilityHistory::QueryIssued(uint64_t object) -> void {
+    auto& entry = entries_[object];
+    entry.last_query = frame_;
+    entry.pending = true;
+}
+
+auto VisibilityHistory::Resolve(uint64_t object, bool visible) -> void {
+    const auto it = entries_.find(object);
+    if (it == entries_.end()) return;
+    it->second.visible = visible;
+    it->second.pending = false;
+}
+
+}
\ No newline at end of file
@@ -0,0 +1,56 @@
+/*
+===========================================================================
+  VGLX https://vglx.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <unordered_map>
+
+namespace vglx {
+
+// Visibility of objects tested with occlusion queries, carried across
+// frames in the style of CHC++. Results arrive a frame or more after their
+// query, so each object keeps its last known state until then. Objects
+// start out visible. Visible objects are queried again every few frames,
+// staggered by ID so the queries spread over frames, and hidden objects in
+// every frame until a query finds them visible.
+class VisibilityHistory {
+public:
+    // Frames between queries of an object that is visible.
+    static constexpr auto kVisibleInterval = uint32_t {8};
+
+    // Objects without a query for this many frames, for example because
+    // they left the view, are forgotten and start out visible again.
+    static constexpr auto kExpiry = uint32_t {120};
+
+    auto BeginFrame() -> void;
+
+    [[nodiscard]] auto IsHidden(uint64_t object) const -> bool;
+
+    // Whether a query should be issued for the object in this frame. Only
+    // one query per object is in flight at a time.
+    [[nodiscard]] auto NeedsQuery(uint64_t object) const -> bool;
+
+    auto QueryIssued(uint64_t object) -> void;
+
+    auto Resolve(uint64_t object, bool visible) -> void;
+
+    [[nodiscard]] auto Size() const { return entries_.size(); }
+
+private:
+    struct Entry {
+        uint32_t last_query {0};
+        bool visible {true};
+        bool pending {false};
+    };
+
+    std::unordered_map<uint64_t, Entry> entries_;
+
+    uint32_t frame_ {0};
+};
+
+}
\ No newline at end of file
@@ -10,7 +10,7 @@
 #include "vglx/events/keyboard_event.hpp"
 #include "vglx/events/mouse_event.hpp"
 
-#include "events/event_dispatcher.hpp"
+#include "events/event_channel.hpp"
 #include "utilities/logger.hpp"
 
 #include <memory>
@@ -52,6 +52,7 @@ auto Window::Impl::Initialize() -> std::expected<void, std::string> {
     glfwWindowHint(GLFW_DEPTH_BITS, 24);
     glfwWindowHint(GLFW_STENCIL_BITS, 8);
     glfwWindowHint(GLFW_SAMPLES, params_.antialiasing);
+    glfwWindowHint(GLFW_VISIBLE, params_.visible ? GLFW_TRUE : GLFW_FALSE);
 
     #ifdef __APPLE__
         glfwWindowHint(GLFW_COCOA_RETINA_FRAMEBUFFER, GLFW_TRUE);
@@ -149,10 +150,10 @@ auto Window::Impl::LogContextInfo() const -> void {
         return reinterpret_cast<const char*>(glGetString(name));
     };
 
-    Logger::Log(LogLevel::Info, "Vendor: {}", getString(GL_VENDOR));
-    Logger::Log(LogLevel::Info, "Renderer: {}", getString(GL_RENDERER));
-    Logger::Log(LogLevel::Info, "Version: {}", getString(GL_VERSION));
-    Logger::Log(LogLevel::Info, "GLSL Version: {}", getString(GL_SHADING_LANGUAGE_VERSION));
+    VGLX_LOG(LogLevel::Info, "Vendor: {}", getString(GL_VENDOR));
+    VGLX_LOG(LogLevel::Info, "Renderer: {}", getString(GL_RENDERER));
+    VGLX_LOG(LogLevel::Info, "Version: {}", getString(GL_VERSION));
+    VGLX_LOG(LogLevel::Info, "GLSL Version: {}", getString(GL_SHADING_LANGUAGE_VERSION));
 }
 
 Window::Impl::~Impl() {
@@ -179,32 +180,32 @@ auto glfw_key_callback(GLFWwindow*, int key, int scancode, int action, int mods)
     if (imgui_wants_input()) return;
 #endif
 
-    auto event = std::make_unique<KeyboardEvent>();
-    event->type = KeyboardEvent::Type::Pressed;
-    event->key = glfw_keyboard_map(key);
+    auto event = KeyboardEvent {};
+    event.type = KeyboardEvent::Type::Pressed;
+    event.key = glfw_keyboard_map(key);
 
     if (action == GLFW_PRESS) {
-        EventDispatcher::Get().Dispatch("keyboard_event", std::move(event));
+        EventChannel<KeyboardEvent>::Get().Dispatch(event);
     }
 
     if (action == GLFW_RELEASE) {
-        event->type = KeyboardEvent::Type::Released;
-        EventDispatcher::Get().Dispatch("keyboard_event", std::move(event));
+        event.type = KeyboardEvent::Type::Released;
+        EventChannel<KeyboardEvent>::Get().Dispatch(event);
     }
 }
 
 auto glfw_cursor_pos_callback(GLFWwindow* window, double x, double y) -> void {
-    auto event = std::make_unique<MouseEvent>();
+    auto event = MouseEvent {};
     auto instance = static_cast<Window::Impl*>(glfwGetWindowUserPointer(window));
     instance->mouse_pos_x = x;
     instance->mouse_pos_y = y;
 
-    event->type = MouseEvent::Type::Moved;
-    event->button = MouseButton::None;
-    event->position = {static_cast<float>(x), static_cast<float>(y)};
-    event->scroll = {0.0f, 0.0f};
+    event.type = MouseEvent::Type::Moved;
+    event.button = MouseButton::None;
+    event.position = {static_cast<float>(x), static_cast<float>(y)};
+    event.scroll = {0.0f, 0.0f};
 
-    EventDispatcher::Get().Dispatch("mouse_event", std::move(event));
+    EventChannel<MouseEvent>::Get().Dispatch(event);
 }
 
 auto glfw_mouse_button_callback(GLFWwindow* window, int button, int action, int) -> void {
@@ -212,24 +213,24 @@ auto glfw_mouse_button_callback(GLFWwindow* window, int button, int action, int)
     if (imgui_wants_input()) return;
 #endif
 
-    auto event = std::make_unique<MouseEvent>();
+    auto event = MouseEvent {};
     auto instance = static_cast<Window::Impl*>(glfwGetWindowUserPointer(window));
 
-    event->type = MouseEvent::Type::ButtonPressed;
-    event->button = glfw_mouse_button_map(button);
-    event->position = {
+    event.type = MouseEvent::Type::ButtonPressed;
+    event.button = glfw_mouse_button_map(button);
+    event.position = {
         static_cast<float>(instance->mouse_pos_x),
         static_cast<float>(instance->mouse_pos_y)
     };
-    event->scroll = {0.0f, 0.0f};
+    event.scroll = {0.0f, 0.0f};
 
     if (action == GLFW_PRESS) {
-        EventDispatcher::Get().Dispatch("mouse_event", std::move(event));
+        EventChannel<MouseEvent>::Get().Dispatch(event);
     }
 
     if (action == GLFW_RELEASE) {
-        event->type = MouseEvent::Type::ButtonReleased;
-        EventDispatcher::Get().Dispatch("mouse_event", std::move(event));
+        event.type = MouseEvent::Type::ButtonReleased;
+        EventChannel<MouseEvent>::Get().Dispatch(event);
     }
 }
 
@@ -239,17 +240,17 @@ auto glfw_scroll_callback(GLFWwindow* window, double x, double y) -> void {
 #endif
 
     auto instance = static_cast<Window::Impl*>(glfwGetWindowUserPointer(window));
-    auto event = std::make_unique<MouseEvent>();
+    auto event = MouseEvent {};
 
-    event->type = MouseEvent::Type::Scrolled;
-    event->button = MouseButton::None;
-    event->position = {
+    event.type = MouseEvent::Type::Scrolled;
+    event.button = MouseButton::None;
+    event.position = {
         static_cast<float>(instance->mouse_pos_x),
         static_cast<float>(instance->mouse_pos_y)
     };
-    event->scroll = {static_cast<float>(x), static_cast<float>(y)};
+    event.scroll = {static_cast<float>(x), static_cast<float>(y)};
 
-    EventDispatcher::Get().Dispatch("mouse_event", std::move(event));
+    EventChannel<MouseEvent>::Get().Dispatch(event);
 }
 
 auto glfw_mouse_button_map(int button) -> MouseButton {
@@ -257,7 +258,7 @@ auto glfw_mouse_button_map(int button) -> MouseButton {
         case GLFW_MOUSE_BUTTON_LEFT: return MouseButton::Left;
         case GLFW_MOUSE_BUTTON_RIGHT: return MouseButton::Right;
         case GLFW_MOUSE_BUTTON_MIDDLE: return MouseButton::Middle;
-        default: Logger::Log(LogLevel::Error, "Unrecognized GLFW mouse button key {}", button);
+        default: VGLX_LOG(LogLevel::Error, "Unrecognized GLFW mouse button key {}", button);
     }
     return MouseButton::None;
 }
@@ -396,7 +397,7 @@ auto glfw_keyboard_map(int key) -> vglx::Key {
         case GLFW_KEY_RIGHT_ALT: return vglx::Key::RightAlt;
         case GLFW_KEY_RIGHT_SUPER: return vglx::Key::RightSuper;
         case GLFW_KEY_MENU: return vglx::Key::Menu;
-        default: Logger::Log(LogLevel::Error, "Unrecognized GLFW key {}", key);
+        default: VGLX_LOG(LogLevel::Error, "Unrecognized GLFW key {}", key);
     }
     return vglx::Key::None;
 }
@@ -0,0 +1,122 @@
+/*
+===========================================================================
+  VGLX https://vglx.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#pragma once
+
+#include "vglx/events/event.hpp"
+
+#include "utilities/logger.hpp"
+
+#include <algorithm>
+#include <concepts>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+namespace vglx {
+
+using ListenerId = uint32_t;
+
+// Typed counterpart of EventDispatcher. Each event type gets its own channel
+// at compile time, events are passed by reference from the caller's stack, and
+// listeners removed mid-dispatch are compacted once the dispatch unwinds.
+template <typename E>
+requires std::derived_from<E, Event>
+class EventChannel {
+public:
+    using Listener = std::function<void(E&)>;
+
+    EventChannel(const EventChannel&) = delete;
+    EventChannel& operator=(const EventChannel&) = delete;
+
+    static auto Get() -> EventChannel& {
+        static auto instance = EventChannel {};
+        return instance;
+    }
+
+    [[nodiscard]] auto Subscribe(Listener listener) -> ListenerId {
+        const auto id = ++next_id_;
+        auto& target = dispatch_depth_ > 0 ? pending_ : listeners_;
+        target.emplace_back(id, std::move(listener));
+        return id;
+    }
+
+    auto Unsubscribe(ListenerId id) -> void {
+        if (id == kInvalidId) return;
+
+        if (std::erase_if(pending_, [id](const auto& e) { return e.id == id; })) {
+            return;
+        }
+
+        for (auto& entry : listeners_) {
+            if (entry.id != id) continue;
+            if (dispatch_depth_ > 0) {
+                // The callback may be executing right now, defer destruction.
+                entry.id = kInvalidId;
+                has_expired_ = true;
+            } else {
+                std::erase_if(listeners_, [id](const auto& e) { return e.id == id; });
+            }
+            return;
+        }
+
+        VGLX_LOG(LogLevel::Warning, "Attempting to remove an event listener that doesn't exist '{}'", id);
+    }
+
+    auto Dispatch(E& event) -> void {
+        ++dispatch_depth_;
+
+        const auto count = listeners_.size();
+        for (auto i = size_t {0}; i < count; ++i) {
+            auto& entry = listeners_[i];
+            if (entry.id != kInvalidId) entry.callback(event);
+        }
+
+        if (--dispatch_depth_ == 0) Flush();
+    }
+
+    [[nodiscard]] auto ListenerCount() const {
+        return listeners_.size() + pending_.size();
+    }
+
+private:
+    static constexpr auto kInvalidId = ListenerId {0};
+
+    struct Entry {
+        ListenerId id;
+        Listener callback;
+    };
+
+    std::vector<Entry> listeners_;
+
+    std::vector<Entry> pending_;
+
+    ListenerId next_id_ {kInvalidId};
+
+    unsigned dispatch_depth_ {0};
+
+    bool has_expired_ {false};
+
+    EventChannel() = default;
+    ~EventChannel() = default;
+
+    auto Flush() -> void {
+        if (has_expired_) {
+            std::erase_if(listeners_, [](const auto& e) { return e.id == kInvalidId; });
+            has_expired_ = false;
+        }
+
+        if (!pending_.empty()) {
+            std::ranges::move(pending_, std::back_inserter(listeners_));
+            pending_.clear();
+        }
+    }
+};
+
+}
\ No newline at end of file
@@ -50,7 +50,7 @@ public:
         }
 
         if (removed_callbacks == 0) {
-            Logger::Log(LogLevel::Warning, "Attempting to remove an event listener that doesn't exist '{}'", name);
+            VGLX_LOG(LogLevel::Warning, "Attempting to remove an event listener that doesn't exist '{}'", name);
         }
     }
 
@@ -67,7 +67,7 @@ public:
                 (*callback)(event.get());
                 iter++;
             } else {
-                Logger::Log(LogLevel::Warning, "Removed expired event listener '{}'", name);
+                VGLX_LOG(LogLevel::Warning, "Removed expired event listener '{}'", name);
                 iter = callbacks.erase(iter); // update iter to the next valid position
             }
         }
@@ -12,7 +12,9 @@
 #include "utilities/logger.hpp"
 
 #include <algorithm>
+#include <atomic>
 #include <cassert>
+#include <mutex>
 #include <numeric>
 
 namespace vglx {
@@ -29,7 +31,7 @@ auto Geometry::SetAttribute(const GeometryAttribute &attribute) -> void {
 
     auto idx = std::to_underlying(attribute.type);
     if (HasAttribute(attribute.type)) {
-        Logger::Log(LogLevel::Warning, "Vertex attribute {} already exists", idx);
+        VGLX_LOG(LogLevel::Warning, "Vertex attribute {} already exists", idx);
         return;
     }
 
@@ -56,19 +58,32 @@ auto Geometry::Stride() const -> size_t {
 }
 
 auto Geometry::BoundingBox() -> Box3 {
-    if (!bounding_box_.has_value()) CreateBoundingBox();
+    if (!std::atomic_ref {bounds_ready_}.load(std::memory_order_acquire)) CreateBounds();
     return bounding_box_.value();
 }
 
 auto Geometry::BoundingSphere() -> Sphere {
-    if (!bounding_sphere_.has_value()) CreateBoundingSphere();
+    if (!std::atomic_ref {bounds_ready_}.load(std::memory_order_acquire)) CreateBounds();
     return bounding_sphere_.value();
 }
 
+auto Geometry::CreateBounds() -> void {
+    // Culling threads can ask for the bounds of a shared geometry at the
+    // same time, so the first computation is serialized.
+    static auto mutex = std::mutex {};
+    auto lock = std::lock_guard {mutex};
+    if (bounds_ready_) return;
+
+    CreateBoundingBox();
+    if (!bounding_box_) return;
+    CreateBoundingSphere();
+    std::atomic_ref {bounds_ready_}.store(true, std::memory_order_release);
+}
+
 auto Geometry::CreateBoundingBox() -> void {
     using enum VertexAttributeType;
     if (VertexCount() == 0 || !HasAttribute(Position)) {
-        Logger::Log(LogLevel::Error, "Failed to create a bounding box");
+        VGLX_LOG(LogLevel::Error, "Failed to create a bounding box");
         return;
     }
 
@@ -86,11 +101,11 @@ auto Geometry::CreateBoundingBox() -> void {
 auto Geometry::CreateBoundingSphere() -> void {
     using enum VertexAttributeType;
     if (VertexCount() == 0 || !HasAttribute(Position)) {
-        Logger::Log(LogLevel::Error, "Failed to create a bounding sphere");
+        VGLX_LOG(LogLevel::Error, "Failed to create a bounding sphere");
         return;
     }
 
-    auto center = BoundingBox().Center();
+    auto center = bounding_box_->Center();
     auto stride = Stride();
     auto max_distance_squared = 0.0f;
     for (auto i = 0; i < vertex_data_.size(); i += stride) {
@@ -20,14 +20,14 @@ WireframeGeometry::WireframeGeometry(const Geometry* geometry) :
     Geometry(geometry->VertexData(), {})
 {
     if (geometry->primitive != GeometryPrimitiveType::Triangles) {
-        Logger::Log(
+        VGLX_LOG(
             LogLevel::Error,
             "Failed to initialize wireframe geometry with non-triangulated source"
         );
     }
 
     if (geometry->IndexCount() == 0) {
-        Logger::Log(
+        VGLX_LOG(
             LogLevel::Error,
             "Failed to initialize wireframe geometry with non-indexed source"
         );
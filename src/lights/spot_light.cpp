@@ -104,12 +104,16 @@ auto SpotLight::SetDebugMode(bool is_debug_mode) -> void {
         ? impl_->CreateDebugMesh(this)
         : impl_->RemoveDebugMesh(this);
         debug_mode_enabled_ = is_debug_mode;
+        // Only the debug mesh follows the light every frame.
+        SetUpdateEnabled(is_debug_mode);
     }
 }
 
 auto SpotLight::OnUpdate(float delta) -> void {
     if (debug_mode_enabled_) {
         impl_->UpdateDebugMesh(this);
+    } else {
+        Node::OnUpdate(delta);
     }
 }
 
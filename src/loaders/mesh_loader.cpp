@@ -14,6 +14,7 @@
 #include "vglx/nodes/mesh.hpp"
 #include "vglx/nodes/node.hpp"
 #include "vglx/textures/texture_2d.hpp"
+#include "vglx/utilities/tracer.hpp"
 
 #include "utilities/logger.hpp"
 #include "utilities/file.hpp"
@@ -45,6 +46,7 @@ auto configure_geometry_attributes(const MeshRecord& h, const std::shared_ptr<Ge
 }
 
 auto load_materials(const fs::path& path, std::ifstream& file, const MeshHeader& mesh_header) {
+    VGLX_TRACE_ZONE("MeshLoader::LoadMaterials");
     const auto texture_loader = TextureLoader::Create();
     auto textures = std::unordered_map<std::string, std::shared_ptr<Texture2D>> {};
     auto materials = std::vector<std::shared_ptr<Material>> {};
@@ -76,7 +78,7 @@ auto load_materials(const fs::path& path, std::ifstream& file, const MeshHeader&
                     texture = result.value();
                     textures.emplace(filename, texture);
                 } else {
-                    Logger::Log(LogLevel::Error, "{}", result.error());
+                    VGLX_LOG(LogLevel::Error, "{}", result.error());
                 }
             }
 
@@ -97,7 +99,7 @@ auto load_materials(const fs::path& path, std::ifstream& file, const MeshHeader&
                     material->specular_map = texture;
                 break;
                 default:
-                    Logger::Log(
+                    VGLX_LOG(
                         LogLevel::Error,
                         "Unsupported texture type {}",
                         texture_record.type
@@ -112,6 +114,7 @@ auto load_materials(const fs::path& path, std::ifstream& file, const MeshHeader&
 
 auto load_mesh(const fs::path& path, std::ifstream& file, const MeshHeader& mesh_header) -> LoaderResult<Node> {
     auto materials = load_materials(path, file, mesh_header);
+    VGLX_TRACE_ZONE("MeshLoader::LoadGeometry");
     auto root = Node::Create();
 
     for (uint32_t i = 0; i < mesh_header.mesh_count; ++i) {
@@ -147,6 +150,8 @@ auto load_mesh(const fs::path& path, std::ifstream& file, const MeshHeader& mesh
 } // unnamed namespace
 
 auto MeshLoader::LoadImpl(const fs::path& path) const -> LoaderResult<Node> {
+    VGLX_TRACE_ZONE("MeshLoader::Load");
+
     auto file = std::ifstream {path, std::ios::binary};
     auto path_s = path.string();
     if (!file) {
@@ -7,6 +7,7 @@
 
 #include "vglx/asset_format.hpp"
 #include "vglx/loaders/texture_loader.hpp"
+#include "vglx/utilities/tracer.hpp"
 
 #include "utilities/file.hpp"
 
@@ -18,6 +19,8 @@ namespace vglx {
 namespace {
 
 auto load_texture(const fs::path& path, std::ifstream& file, const TextureHeader& h) {
+    VGLX_TRACE_ZONE("TextureLoader::ReadPixels");
+
     auto data = std::vector<uint8_t>(h.pixel_data_size);
     read_binary(file, data, h.pixel_data_size);
 
@@ -34,6 +37,8 @@ auto load_texture(const fs::path& path, std::ifstream& file, const TextureHeader
 }
 
 auto TextureLoader::LoadImpl(const fs::path& path) const -> LoaderResult<Texture2D> {
+    VGLX_TRACE_ZONE("TextureLoader::Load");
+
     auto file = std::ifstream {path, std::ios::binary};
     auto path_s = path.string();
     if (!file) {
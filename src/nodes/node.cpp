@@ -8,32 +8,101 @@
 #include "vglx/nodes/node.hpp"
 
 #include "vglx/cameras/camera.hpp"
+#include "vglx/core/object_pool.hpp"
+#include "vglx/nodes/scene.hpp"
 
-#include "events/event_dispatcher.hpp"
+#include "events/event_channel.hpp"
 #include "utilities/logger.hpp"
 
-#include <queue>
+#include <atomic>
+#include <cstdint>
 #include <ranges>
+#include <vector>
 
 namespace vglx {
 
+namespace {
+
+struct SceneEventBatch {
+    std::vector<SceneEvent> events;
+    unsigned depth {0};
+};
+
+thread_local auto scene_event_batch = SceneEventBatch {};
+
+auto dispatch_scene_event(SceneEvent::Type type, const std::shared_ptr<Node>& node) {
+    if (scene_event_batch.depth > 0) {
+        scene_event_batch.events.emplace_back(type, node);
+        return;
+    }
+
+    auto event = SceneEvent {type, node};
+    EventChannel<SceneEvent>::Get().Dispatch(event);
+}
+
+}
+
 struct Node::Impl {
+    // Allocated with the node, from the same pool.
+    static auto operator new(size_t size) -> void* {
+        return ObjectPool::Allocate(size);
+    }
+
+    static auto operator delete(void* ptr, size_t size) -> void {
+        ObjectPool::Deallocate(ptr, size);
+    }
+
     std::vector<std::shared_ptr<Node>> children;
 
     Node* parent {nullptr};
 
+    Scene* scene {nullptr};
+
     Matrix4 world_transform {1.0f};
 
+    Matrix4 render_transform {1.0f};
+
+    Transform3 previous_transform;
+
+    unsigned depth {0};
+
     bool world_transform_touched {false};
 
+    bool history_valid {false};
+
+    bool interpolated {false};
+
     bool attached {false};
+
+    enum class UpdateMode : uint8_t { Automatic, Enabled, Disabled };
+
+    UpdateMode update_mode {UpdateMode::Automatic};
+
+    bool update_pruned {false};
+
+    // Index in the owning scene's update list, cached here so that
+    // registration does not need a lookup table.
+    size_t update_slot {kNoUpdateSlot};
+
+    uint32_t batch_added_stamp {0};
+
+    uint32_t batch_dispatched_stamp {0};
+
+    auto SetDepth(unsigned value) -> void {
+        depth = value;
+        for (const auto& child : children) {
+            child->impl_->SetDepth(value + 1);
+        }
+    }
 };
 
-Node::Node() : impl_(std::make_unique<Impl>()) {};
+Node::Node() : impl_(std::make_unique<Impl>()) {
+    static_assert(alignof(Impl) <= alignof(std::max_align_t));
+};
 
 auto Node::Add(const std::shared_ptr<Node>& node) -> void {
     if (node == nullptr) {
-        Logger::Log(LogLevel::Error, "Attempting to add invalid node");
+        VGLX_LOG(LogLevel::Error, "Attempting to add invalid node");
         return;
     }
 
@@ -41,82 +110,130 @@ auto Node::Add(const std::shared_ptr<Node>& node) -> void {
         node->impl_->parent->Remove(node);
     }
     node->impl_->parent = this;
+    node->impl_->SetDepth(impl_->depth + 1);
     impl_->children.emplace_back(node);
 
-    EventDispatcher::Get().Dispatch(
-        "node_added",
-        std::make_unique<SceneEvent>(SceneEvent::Type::NodeAdded, node)
-    );
+    dispatch_scene_event(SceneEvent::Type::NodeAdded, node);
 }
 
 auto Node::Remove(const std::shared_ptr<Node>& node) -> void {
     if (node == nullptr) {
-        Logger::Log(LogLevel::Error, "Attempting to remove invalid node");
+        VGLX_LOG(LogLevel::Error, "Attempting to remove invalid node");
         return;
     }
 
     auto it = std::ranges::find(impl_->children, node);
     if (it != impl_->children.end()) {
-        EventDispatcher::Get().Dispatch(
-            "node_removed",
-            std::make_unique<SceneEvent>(SceneEvent::Type::NodeRemoved, node)
-        );
+        dispatch_scene_event(SceneEvent::Type::NodeRemoved, node);
         impl_->children.erase(it);
+        if (impl_->scene != nullptr) impl_->scene->RetainDuringUpdate(node);
         node->impl_->parent = nullptr;
-        node->impl_->attached = false;
+        node->impl_->SetDepth(0);
+        node->DetachRecursive();
         node->transform.touched = true;
     } else {
-        Logger::Log(LogLevel::Warning, "Attempting to remove node that is not in scene {}", *node);
+        VGLX_LOG(LogLevel::Warning, "Attempting to remove node that is not in scene {}", *node);
     }
 }
 
 auto Node::RemoveAllChildren() -> void {
     for (const auto& node : impl_->children) {
-        EventDispatcher::Get().Dispatch(
-            "node_removed",
-            std::make_unique<SceneEvent>(SceneEvent::Type::NodeRemoved, node)
-        );
+        dispatch_scene_event(SceneEvent::Type::NodeRemoved, node);
+        if (impl_->scene != nullptr) impl_->scene->RetainDuringUpdate(node);
         node->impl_->parent = nullptr;
-        node->impl_->attached = false;
+        node->impl_->SetDepth(0);
+        node->DetachRecursive();
         node->transform.touched = true;
     }
     impl_->children.clear();
 }
 
+auto Node::BeginBatch() -> void {
+    ++scene_event_batch.depth;
+}
+
+auto Node::CommitBatch() -> void {
+    auto& batch = scene_event_batch;
+    if (batch.depth == 0) {
+        VGLX_LOG(LogLevel::Warning, "Attempting to commit a batch that was never started");
+        return;
+    }
+
+    if (--batch.depth > 0) return;
+
+    // Dispatching may open new batches or record new changes, so the pending
+    // events are taken out before anything is dispatched.
+    auto events = std::move(batch.events);
+    batch.events.clear();
+
+    // Nodes are stamped with a per-commit value instead of being collected in
+    // a set, which keeps the resolution pass free of hashing and allocations.
+    static auto commit_counter = std::atomic<uint32_t> {0};
+    const auto stamp = ++commit_counter;
+
+    for (const auto& event : events) {
+        if (event.type == SceneEvent::Type::NodeAdded) {
+            event.node->impl_->batch_added_stamp = stamp;
+        }
+    }
+
+    const auto has_added_ancestor = [stamp](const Node* node) {
+        for (auto p = node->impl_->parent; p != nullptr; p = p->impl_->parent) {
+            if (p->impl_->batch_added_stamp == stamp) return true;
+        }
+        return false;
+    };
+
+    auto& channel = EventChannel<SceneEvent>::Get();
+    for (auto& event : events) {
+        if (event.type == SceneEvent::Type::NodeRemoved) {
+            channel.Dispatch(event);
+        }
+    }
+
+    for (auto& event : events) {
+        if (event.type != SceneEvent::Type::NodeAdded) continue;
+        const auto node = event.node.get();
+        if (node->impl_->batch_dispatched_stamp == stamp) continue;
+        if (node->impl_->parent == nullptr) continue;
+        if (has_added_ancestor(node)) continue;
+        node->impl_->batch_dispatched_stamp = stamp;
+        channel.Dispatch(event);
+    }
+}
+
 auto Node::Children() const -> const std::vector<std::shared_ptr<Node>>& {
     return impl_->children;
 }
 
 auto Node::IsChild(const Node* node) const -> bool {
     if (node == nullptr) {
-        Logger::Log(LogLevel::Error, "Attempting to check child relationship of invalid node");
+        VGLX_LOG(LogLevel::Error, "Attempting to check child relationship of invalid node");
         return false;
     }
 
-    auto to_process = std::queue<std::shared_ptr<Node>>();
-    for (const auto& child : impl_->children) {
-        to_process.push(child);
-    }
-
-    while (!to_process.empty()) {
-        auto len = to_process.size();
-        for (auto i = 0; i < len; ++i) {
-            const auto current = to_process.front();
-            to_process.pop();
-            if (current.get() == node) return true;
-            for (const auto& child : current->impl_->children) {
-                to_process.push(child);
-            }
-        }
+    if (node->impl_->depth <= impl_->depth) return false;
+
+    auto current = node;
+    while (current->impl_->depth > impl_->depth + 1) {
+        current = current->impl_->parent;
     }
 
-    return false;
+    return current->impl_->parent == this;
 }
 
 auto Node::Parent() const -> const Node* {
     return impl_->parent;
 }
 
+auto Node::Depth() const -> unsigned {
+    return impl_->depth;
+}
+
+auto Node::GetScene() const -> Scene* {
+    return impl_->scene;
+}
+
 auto Node::UpdateTransformHierarchy() -> void {
     if (transform_auto_update && ShouldUpdateWorldTransform()) {
         impl_->world_transform = impl_->parent == nullptr
@@ -165,23 +282,132 @@ auto Node::GetWorldTransform() -> Matrix4 {
     return impl_->world_transform;
 }
 
-Node::~Node() = default;
+auto Node::StoreTransformHistory() -> void {
+    impl_->previous_transform = transform;
+    impl_->history_valid = true;
+
+    for (const auto& child : impl_->children) {
+        child->StoreTransformHistory();
+    }
+}
+
+auto Node::InterpolateTransformHierarchy(float alpha) -> void {
+    InterpolateRecursive(
+        impl_->parent != nullptr ? impl_->parent->GetRenderTransform() : Matrix4 {1.0f},
+        alpha
+    );
+}
+
+auto Node::GetRenderTransform() -> Matrix4 {
+    return impl_->interpolated ? impl_->render_transform : GetWorldTransform();
+}
+
+auto Node::CachedRenderTransform() const -> const Matrix4& {
+    return impl_->interpolated ? impl_->render_transform : impl_->world_transform;
+}
+
+auto Node::IsInterpolated() const -> bool {
+    return impl_->interpolated;
+}
+
+auto Node::SetUpdateEnabled(bool enabled) -> void {
+    using enum Impl::UpdateMode;
+    impl_->update_mode = enabled ? Enabled : Disabled;
+    impl_->update_pruned = false;
+    if (!impl_->attached || impl_->scene == nullptr) return;
+    enabled ? impl_->scene->RegisterUpdate(this) : impl_->scene->UnregisterUpdate(this);
+}
+
+auto Node::IsUpdateEnabled() const -> bool {
+    using enum Impl::UpdateMode;
+    switch (impl_->update_mode) {
+        case Enabled: return true;
+        case Disabled: return false;
+        case Automatic: return !impl_->update_pruned;
+    }
+    return false;
+}
+
+auto Node::OnUpdate([[maybe_unused]] float delta) -> void {
+    // Only reached by types that do not override OnUpdate, unless an
+    // override calls it, in which case the type enables updates explicitly.
+    if (impl_->update_mode == Impl::UpdateMode::Automatic) {
+        impl_->update_pruned = true;
+    }
+}
+
+Node::~Node() {
+    for (const auto& child : impl_->children) {
+        child->impl_->parent = nullptr;
+        child->impl_->SetDepth(0);
+        child->DetachRecursive();
+    }
+}
 
 auto Node::LookAt(const Vector3& target) -> void {
     transform.LookAt(GetWorldPosition(), target, up);
 }
 
-auto Node::AttachRecursive(SharedContextPointer context) -> void {
+auto Node::SetOwningScene(Scene* scene) -> void {
+    impl_->scene = scene;
+}
+
+auto Node::UpdateSlot() -> size_t& {
+    return impl_->update_slot;
+}
+
+auto Node::AttachRecursive(Scene* scene, SharedContextPointer context) -> void {
     if (impl_->attached) return;
 
+    impl_->scene = scene;
     OnAttached(context);
     impl_->attached = true;
+    if (IsUpdateEnabled()) scene->RegisterUpdate(this);
 
     for (const auto& child : impl_->children) {
         if (child != nullptr) {
-            child->AttachRecursive(context);
+            child->AttachRecursive(scene, context);
         }
     }
 }
 
+auto Node::DetachRecursive() -> void {
+    if (impl_->scene != nullptr) impl_->scene->UnregisterUpdate(this);
+    impl_->scene = nullptr;
+    impl_->attached = false;
+    impl_->history_valid = false;
+    impl_->interpolated = false;
+
+    for (const auto& child : impl_->children) {
+        child->DetachRecursive();
+    }
+}
+
+auto Node::DispatchUpdate(float delta) -> bool {
+    OnUpdate(delta);
+    return IsUpdateEnabled();
+}
+
+auto Node::InterpolateRecursive(const Matrix4& parent_transform, float alpha) -> void {
+    if (transform_auto_update) {
+        // Work on a copy so the lazily built matrix of the simulated transform
+        // stays dirty for the next world transform update.
+        const auto& previous = impl_->previous_transform;
+        const auto moved = impl_->history_valid && (
+            previous.position != transform.position ||
+            previous.scale != transform.scale ||
+            previous.rotation != transform.rotation
+        );
+        auto local = moved ? Lerp(previous, transform, alpha) : transform;
+        impl_->render_transform = parent_transform * local.Get();
+    } else {
+        impl_->render_transform = impl_->world_transform;
+    }
+    impl_->interpolated = true;
+
+    for (const auto& child : impl_->children) {
+        child->InterpolateRecursive(impl_->render_transform, alpha);
+    }
+}
+
 }
\ No newline at end of file
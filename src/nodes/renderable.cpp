@@ -22,53 +22,67 @@ auto Renderable::BoundingSphere() -> Sphere {
 }
 
 auto Renderable::CanRender(Renderable* r) -> bool {
-    const auto level = LogLevel::Error;
-    const auto geometry = r->GetGeometry();
-    const auto material = r->GetMaterial();
-    const auto mat_type = material->GetType();
-    const auto node_type = r->GetNodeType();
+    constexpr auto level = LogLevel::Error;
+    constexpr auto kLogInterval = std::chrono::seconds(1);
+    const auto geometry = r->GetGeometry().get();
+    const auto material = r->GetMaterial().get();
+    if (geometry && material && !geometry->Disposed() &&
+        geometry->Id() == r->validated_geometry_ &&
+        material->Id() == r->validated_material_) {
+        return true;
+    }
+    r->validated_geometry_ = 0;
+    r->validated_material_ = 0;
 
     if (geometry == nullptr) {
-        Logger::Log(level, "Skipped rendering a node with invalid geometry {}", *r);
+        VGLX_LOG_EVERY(kLogInterval, level, "Skipped rendering a node with invalid geometry {}", *r);
         return false;
     }
 
     if (geometry->Disposed()) {
-        Logger::Log(level, "Skipped rendering a node with disposed geometry {}", *r);
+        VGLX_LOG_EVERY(kLogInterval, level, "Skipped rendering a node with disposed geometry {}", *r);
         return false;
     }
 
     if (geometry->VertexData().empty()) {
-        Logger::Log(level, "Skipped node with no geometry data {}", *r);
+        VGLX_LOG_EVERY(kLogInterval, level, "Skipped node with no geometry data {}", *r);
         return false;
     }
 
     if (!geometry->HasAttribute(VertexAttributeType::Position)) {
-        Logger::Log(level, "Skipped node with no vertex positions {}", *r);
+        VGLX_LOG_EVERY(kLogInterval, level, "Skipped node with no vertex positions {}", *r);
         return false;
     }
 
     if (material == nullptr) {
-        Logger::Log(level, "Skipped node with invalid material {}", *r);
+        VGLX_LOG_EVERY(kLogInterval, level, "Skipped node with invalid material {}", *r);
         return false;
     }
 
+    const auto mat_type = material->GetType();
+    const auto node_type = r->GetNodeType();
+
     if (node_type == Node::Type::Sprite && mat_type != Material::Type::SpriteMaterial) {
-        Logger::Log(level, "Skipped sprite with non-sprite material {}", *r);
+        VGLX_LOG_EVERY(kLogInterval, level, "Skipped sprite with non-sprite material {}", *r);
         return false;
     }
 
     if (mat_type == Material::Type::SpriteMaterial && node_type != Node::Type::Sprite) {
-        Logger::Log(level, "Skipped non-sprite node with sprite material {}", *r);
+        VGLX_LOG_EVERY(kLogInterval, level, "Skipped non-sprite node with sprite material {}", *r);
         return false;
     }
 
+    r->validated_geometry_ = geometry->Id();
+    r->validated_material_ = material->Id();
     return true;
 }
 
 auto Renderable::InFrustum(Renderable* r, const Frustum& frustum) -> bool {
     auto bounding_sphere = r->BoundingSphere();
-    bounding_sphere.ApplyTransform(r->GetWorldTransform());
+    // Culling runs on worker threads after the hierarchy was updated, so it
+    // must not touch the transforms of other nodes. It tests the pose that is
+    // drawn, which trails the simulated one when interpolating.
+    bounding_sphere.ApplyTransform(r->CachedRenderTransform());
     return frustum.IntersectsWithSphere(bounding_sphere);
 }
 
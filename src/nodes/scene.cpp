@@ -7,21 +7,21 @@
 
 #include "vglx/nodes/scene.hpp"
 
-#include "events/event_dispatcher.hpp"
+#include "vglx/core/job_system.hpp"
+
+#include "events/event_channel.hpp"
 #include "utilities/logger.hpp"
 
+#include <cstdint>
+#include <vector>
+
 namespace vglx {
 
 namespace {
 
-auto handle_node_updates(std::weak_ptr<Node> node, float delta) -> void {
-    if (const auto n = node.lock()) {
-        n->OnUpdate(delta);
-        for (const auto& child : n->Children()) {
-            handle_node_updates(child, delta);
-        }
-    }
-}
+// Thread-safe updates are only spread across workers once each job gets
+// enough nodes to amortize the cost of scheduling it.
+constexpr auto kMinUpdatesPerJob = size_t {64};
 
 auto handle_input_event(std::weak_ptr<Node> node, Event* event) -> void {
     using enum Event::Type;
@@ -44,55 +44,146 @@ auto handle_input_event(std::weak_ptr<Node> node, Event* event) -> void {
 }
 
 struct Scene::Impl {
-    std::shared_ptr<EventListener> event_listener;
+    ListenerId scene_listener {0};
+    ListenerId keyboard_listener {0};
+    ListenerId mouse_listener {0};
     SharedContextPointer context {nullptr};
+
+    std::vector<Node*> updates;
+    std::vector<Node*> parallel_updates;
+    std::vector<uint8_t> parallel_results;
+    std::vector<std::shared_ptr<Node>> retained;
+    bool updating {false};
+    bool updates_expired {false};
+
+    auto CompactUpdates() -> void {
+        std::erase(updates, nullptr);
+        for (auto i = size_t {0}; i < updates.size(); ++i) {
+            updates[i]->UpdateSlot() = i;
+        }
+        updates_expired = false;
+    }
 };
 
 Scene::Scene() : impl_(std::make_unique<Impl>()) {
-    using enum Event::Type;
-
-    impl_->event_listener = std::make_shared<EventListener>([&](Event* event) {
-        auto type = event->GetType();
+    // A scene owns its own hierarchy, which lets nodes resolve scene
+    // membership through their parent without walking up to the root.
+    SetOwningScene(this);
+
+    impl_->scene_listener = EventChannel<SceneEvent>::Get().Subscribe(
+        [this](SceneEvent& event) {
+            if (event.type != SceneEvent::Type::NodeAdded) return;
+            const auto parent = event.node->Parent();
+            if (parent != nullptr && parent->GetScene() == this) {
+                event.node->AttachRecursive(this, impl_->context);
+            }
+        }
+    );
 
-        if (type == Keyboard || type == Mouse) {
-            if (type == Keyboard) OnKeyboardEvent(static_cast<KeyboardEvent*>(event));
-            if (type == Mouse) OnMouseEvent(static_cast<MouseEvent*>(event));
+    impl_->keyboard_listener = EventChannel<KeyboardEvent>::Get().Subscribe(
+        [this](KeyboardEvent& event) {
+            OnKeyboardEvent(&event);
             for (const auto& child : Children()) {
-                handle_input_event(child, event);
+                handle_input_event(child, &event);
             }
         }
+    );
 
-        if (type == Event::Type::Scene) {
-            auto e = static_cast<SceneEvent*>(event);
-            if (e->type == SceneEvent::Type::NodeAdded && IsChild(e->node.get())) {
-                e->node->AttachRecursive(impl_->context);
+    impl_->mouse_listener = EventChannel<MouseEvent>::Get().Subscribe(
+        [this](MouseEvent& event) {
+            OnMouseEvent(&event);
+            for (const auto& child : Children()) {
+                handle_input_event(child, &event);
             }
         }
-    });
-
-    EventDispatcher::Get().AddEventListener("node_added", impl_->event_listener);
-    EventDispatcher::Get().AddEventListener("node_removed", impl_->event_listener);
-    EventDispatcher::Get().AddEventListener("keyboard_event", impl_->event_listener);
-    EventDispatcher::Get().AddEventListener("mouse_event", impl_->event_listener);
+    );
 }
 
 auto Scene::Advance(float delta) -> void {
     OnUpdate(delta);
-     for (const auto& child : Children()) {
-        handle_node_updates(child, delta);
+
+    impl_->updating = true;
+    impl_->parallel_updates.clear();
+
+    // Nodes attached while updating are appended and picked up next frame.
+    const auto count = impl_->updates.size();
+    for (auto i = size_t {0}; i < count; ++i) {
+        const auto node = impl_->updates[i];
+        if (node == nullptr) continue;
+        if (node->update_thread_safe) {
+            impl_->parallel_updates.emplace_back(node);
+        } else if (!node->DispatchUpdate(delta)) {
+            UnregisterUpdate(node);
+        }
     }
+
+    // Serial updates may have detached or disabled thread-safe nodes, or
+    // unregistered and registered them again at the end of the list.
+    std::erase_if(impl_->parallel_updates, [count](Node* node) {
+        return node->UpdateSlot() >= count;
+    });
+
+    const auto& batch = impl_->parallel_updates;
+    auto& results = impl_->parallel_results;
+    results.assign(batch.size(), 1);
+
+    const auto update_range = [&](size_t begin, size_t end) {
+        for (auto i = begin; i < end; ++i) {
+            results[i] = batch[i]->DispatchUpdate(delta);
+        }
+    };
+
+    const auto jobs = impl_->context ? impl_->context->jobs.get() : nullptr;
+    if (jobs != nullptr && !batch.empty()) {
+        jobs->ParallelFor(batch.size(), update_range, kMinUpdatesPerJob);
+    } else {
+        update_range(0, batch.size());
+    }
+
+    for (auto i = size_t {0}; i < batch.size(); ++i) {
+        if (!results[i]) UnregisterUpdate(batch[i]);
+    }
+
+    impl_->updating = false;
+    impl_->retained.clear();
+    if (impl_->updates_expired) impl_->CompactUpdates();
 }
 
 auto Scene::SetContext(SharedContextPointer context) -> void {
     impl_->context = context;
-    this->AttachRecursive(context);
+    this->AttachRecursive(this, context);
+}
+
+auto Scene::RegisterUpdate(Node* node) -> void {
+    auto& slot = node->UpdateSlot();
+    if (node == this || slot != kNoUpdateSlot) return;
+    slot = impl_->updates.size();
+    impl_->updates.emplace_back(node);
+}
+
+auto Scene::UnregisterUpdate(Node* node) -> void {
+    auto& slot = node->UpdateSlot();
+    if (slot == kNoUpdateSlot) return;
+
+    // Removal only clears the slot so that an update pass in progress can
+    // keep iterating by index; the list is compacted once the pass ends.
+    impl_->updates[slot] = nullptr;
+    slot = kNoUpdateSlot;
+    impl_->updates_expired = true;
+}
+
+auto Scene::RetainDuringUpdate(const std::shared_ptr<Node>& node) -> void {
+    // A node may remove itself from its parent inside OnUpdate, keep it alive
+    // until the update pass that is calling into it has finished.
+    if (impl_->updating) impl_->retained.emplace_back(node);
 }
 
 Scene::~Scene() {
-    EventDispatcher::Get().RemoveEventListener("node_added", impl_->event_listener);
-    EventDispatcher::Get().RemoveEventListener("node_removed", impl_->event_listener);
-    EventDispatcher::Get().RemoveEventListener("keyboard_event", impl_->event_listener);
-    EventDispatcher::Get().RemoveEventListener("mouse_event", impl_->event_listener);
+    DetachRecursive();
+
+    EventChannel<SceneEvent>::Get().Unsubscribe(impl_->scene_listener);
+    EventChannel<KeyboardEvent>::Get().Unsubscribe(impl_->keyboard_listener);
+    EventChannel<MouseEvent>::Get().Unsubscribe(impl_->mouse_listener);
 }
 
 }
\ No newline at end of file
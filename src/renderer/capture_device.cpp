@@ -0,0 +1,355 @@
+/*
+===========================================================================
+  VGLX https://vglx.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#include "renderer/capture_device.hpp"
+
+#include "core/render_capture_file.hpp"
+#include "utilities/logger.hpp"
+
+#include <bit>
+#include <string_view>
+#include <utility>
+
+namespace vglx {
+
+namespace {
+
+using Command = RenderCommandType;
+
+auto float_bits(float value) {
+    return std::bit_cast<uint32_t>(value);
+}
+
+auto bytes(const void* data, size_t size) -> std::span<const std::byte> {
+    if (data == nullptr) return {};
+    return {static_cast<const std::byte*>(data), size};
+}
+
+}
+
+CaptureDevice::CaptureDevice(std::unique_ptr<RenderDevice> device, std::filesystem::path path)
+  : device_(std::move(device)),
+    path_(std::move(path)) {}
+
+auto CaptureDevice::Open() -> std::expected<void, std::string> {
+    file_.open(path_, std::ios::binary | std::ios::trunc);
+    if (!file_) {
+        return std::unexpected("Unable to open capture file '" + path_.string() + "'");
+    }
+    write_capture_header(file_);
+    return {};
+}
+
+auto CaptureDevice::BeginFrame() -> void {
+    if (frame_started_) Flush();
+    frame_started_ = true;
+    device_->BeginFrame();
+}
+
+auto CaptureDevice::Flush() -> void {
+    if (file_.is_open()) {
+        write_capture_frame(file_, stream_);
+        if (!file_) {
+            VGLX_LOG(LogLevel::Error, "Failed to write capture file '{}'", path_.string());
+            file_.close();
+        }
+    }
+    stream_.Clear();
+}
+
+auto CaptureDevice::CreateVertexArray() -> GLuint {
+    const auto vao = device_->CreateVertexArray();
+    stream_.Record(Command::CreateVertexArray, {vao});
+    return vao;
+}
+
+auto CaptureDevice::BindVertexArray(GLuint vao) -> void {
+    device_->BindVertexArray(vao);
+    stream_.Record(Command::BindVertexArray, {vao});
+}
+
+auto CaptureDevice::CreateBuffers(std::span<GLuint> buffers) -> void {
+    device_->CreateBuffers(buffers);
+    stream_.Record(
+        Command::CreateBuffers,
+        {static_cast<uint32_t>(buffers.size()), buffers.empty() ? 0 : buffers.front()},
+        std::as_bytes(buffers)
+    );
+}
+
+auto CaptureDevice::DeleteBuffers(std::span<const GLuint> buffers) -> void {
+    device_->DeleteBuffers(buffers);
+    stream_.Record(
+        Command::DeleteBuffers,
+        {static_cast<uint32_t>(buffers.size())},
+        std::as_bytes(buffers)
+    );
+}
+
+auto CaptureDevice::BindBuffer(GLenum target, GLuint buffer) -> void {
+    device_->BindBuffer(target, buffer);
+    stream_.Record(Command::BindBuffer, {target, buffer});
+}
+
+auto CaptureDevice::BindBufferBase(GLenum target, GLuint index, GLuint buffer) -> void {
+    device_->BindBufferBase(target, index, buffer);
+    stream_.Record(Command::BindBufferBase, {target, index, buffer});
+}
+
+auto CaptureDevice::BufferData(GLenum target, size_t size, const void* data, GLenum usage) -> void {
+    device_->BufferData(target, size, data, usage);
+    stream_.Record(
+        Command::BufferData,
+        {target, static_cast<uint32_t>(size), usage},
+        bytes(data, size)
+    );
+}
+
+auto CaptureDevice::BufferSubData(GLenum target, size_t size, const void* data) -> bool {
+    const auto result = device_->BufferSubData(target, size, data);
+    stream_.Record(
+        Command::BufferSubData,
+        {target, static_cast<uint32_t>(size)},
+        bytes(data, size)
+    );
+    return result;
+}
+
+auto CaptureDevice::VertexAttribPointer(GLuint index, GLint size, GLsizei stride, size_t offset) -> void {
+    device_->VertexAttribPointer(index, size, stride, offset);
+    stream_.Record(Command::VertexAttribPointer, {
+        index,
+        static_cast<uint32_t>(size),
+        static_cast<uint32_t>(stride),
+        static_cast<uint32_t>(offset)
+    });
+}
+
+auto CaptureDevice::EnableVertexAttribArray(GLuint index) -> void {
+    device_->EnableVertexAttribArray(index);
+    stream_.Record(Command::EnableVertexAttribArray, {index});
+}
+
+auto CaptureDevice::VertexAttribDivisor(GLuint index, GLuint divisor) -> void {
+    device_->VertexAttribDivisor(index, divisor);
+    stream_.Record(Command::VertexAttribDivisor, {index, divisor});
+}
+
+auto CaptureDevice::CreateTexture() -> GLuint {
+    const auto texture = device_->CreateTexture();
+    stream_.Record(Command::CreateTexture, {texture});
+    return texture;
+}
+
+auto CaptureDevice::DeleteTexture(GLuint texture) -> void {
+    device_->DeleteTexture(texture);
+    stream_.Record(Command::DeleteTexture, {texture});
+}
+
+auto CaptureDevice::ActiveTexture(GLuint unit) -> void {
+    device_->ActiveTexture(unit);
+    stream_.Record(Command::ActiveTexture, {unit});
+}
+
+auto CaptureDevice::BindTexture(GLuint texture) -> void {
+    device_->BindTexture(texture);
+    stream_.Record(Command::BindTexture, {texture});
+}
+
+auto CaptureDevice::TexImage2D(int width, int height, int alignment, const void* data) -> bool {
+    const auto result = device_->TexImage2D(width, height, alignment, data);
+    // RGBA8 rows are always a multiple of four bytes, so rows are never padded.
+    const auto size = static_cast<size_t>(width) * static_cast<size_t>(height) * 4;
+    stream_.Record(Command::TexImage2D, {
+        static_cast<uint32_t>(width),
+        static_cast<uint32_t>(height),
+        static_cast<uint32_t>(alignment)
+    }, bytes(data, size));
+    return result;
+}
+
+auto CaptureDevice::CreateProgram(const std::vector<ShaderInfo>& shaders) -> GLuint {
+    const auto program = device_->CreateProgram(shaders);
+    stream_.Record(Command::CreateProgram, {program}, encode_shaders(shaders));
+    return program;
+}
+
+auto CaptureDevice::DeleteProgram(GLuint program) -> void {
+    device_->DeleteProgram(program);
+    blocks_.erase(program);
+    stream_.Record(Command::DeleteProgram, {program});
+}
+
+auto CaptureDevice::ActiveUniforms(GLuint program) -> std::vector<ActiveUniform> {
+    return device_->ActiveUniforms(program);
+}
+
+auto CaptureDevice::ActiveUniformBlocks(GLuint program) -> std::vector<std::string> {
+    auto blocks = device_->ActiveUniformBlocks(program);
+    blocks_[program] = blocks;
+    return blocks;
+}
+
+auto CaptureDevice::UniformLocation(GLuint program, const std::string& name) -> GLint {
+    const auto location = device_->UniformLocation(program, name);
+    stream_.Record(
+        Command::UniformLocation,
+        {program, static_cast<uint32_t>(location)},
+        std::as_bytes(std::span {name})
+    );
+    return location;
+}
+
+auto CaptureDevice::UniformBlockBinding(GLuint program, GLuint index, GLuint binding) -> void {
+    device_->UniformBlockBinding(program, index, binding);
+    const auto& blocks = blocks_[program];
+    const auto name = index < blocks.size() ? std::string_view {blocks[index]} : std::string_view {};
+    stream_.Record(
+        Command::UniformBlockBinding,
+        {program, index, binding},
+        std::as_bytes(std::span {name})
+    );
+}
+
+auto CaptureDevice::UseProgram(GLuint program) -> void {
+    device_->UseProgram(program);
+    stream_.Record(Command::UseProgram, {program});
+}
+
+auto CaptureDevice::SetUniform(GLint location, UniformType type, const void* value) -> void {
+    device_->SetUniform(location, type, value);
+    stream_.Record(
+        Command::SetUniform,
+        {static_cast<uint32_t>(location), static_cast<uint32_t>(type)},
+        bytes(value, uniform_size(type))
+    );
+}
+
+auto CaptureDevice::Enable(GLenum capability) -> void {
+    device_->Enable(capability);
+    stream_.Record(Command::Enable, {capability});
+}
+
+auto CaptureDevice::Disable(GLenum capability) -> void {
+    device_->Disable(capability);
+    stream_.Record(Command::Disable, {capability});
+}
+
+auto CaptureDevice::Viewport(int x, int y, int width, int height) -> void {
+    device_->Viewport(x, y, width, height);
+    stream_.Record(Command::Viewport, {
+        static_cast<uint32_t>(x),
+        static_cast<uint32_t>(y),
+        static_cast<uint32_t>(width),
+        static_cast<uint32_t>(height)
+    });
+}
+
+auto CaptureDevice::DepthMask(bool enabled) -> void {
+    device_->DepthMask(enabled);
+    stream_.Record(Command::DepthMask, {enabled});
+}
+
+auto CaptureDevice::DepthFunc(GLenum func) -> void {
+    device_->DepthFunc(func);
+    stream_.Record(Command::DepthFunc, {func});
+}
+
+auto CaptureDevice::PolygonOffset(float factor, float units) -> void {
+    device_->PolygonOffset(factor, units);
+    stream_.Record(Command::PolygonOffset, {float_bits(factor), float_bits(units)});
+}
+
+auto CaptureDevice::BlendFunc(GLenum source, GLenum destination) -> void {
+    device_->BlendFunc(source, destination);
+    stream_.Record(Command::BlendFunc, {source, destination});
+}
+
+auto CaptureDevice::ClearColor(float r, float g, float b, float a) -> void {
+    device_->ClearColor(r, g, b, a);
+    stream_.Record(Command::ClearColor, {float_bits(r), float_bits(g), float_bits(b), float_bits(a)});
+}
+
+auto CaptureDevice::FrontFace(GLenum mode) -> void {
+    device_->FrontFace(mode);
+    stream_.Record(Command::FrontFace, {mode});
+}
+
+auto CaptureDevice::PolygonMode(GLenum face, GLenum mode) -> void {
+    device_->PolygonMode(face, mode);
+    stream_.Record(Command::PolygonMode, {face, mode});
+}
+
+auto CaptureDevice::ColorMask(bool enabled) -> void {
+    device_->ColorMask(enabled);
+    stream_.Record(Command::ColorMask, {enabled});
+}
+
+auto CaptureDevice::Clear(GLbitfield mask) -> void {
+    device_->Clear(mask);
+    stream_.Record(Command::Clear, {mask});
+}
+
+auto CaptureDevice::Draw(GLenum primitive, GLsizei count, bool indexed) -> void {
+    device_->Draw(primitive, count, indexed);
+    stream_.Record(Command::Draw, {primitive, static_cast<uint32_t>(count), 1, indexed});
+}
+
+auto CaptureDevice::DrawInstanced(GLenum primitive, GLsizei count, bool indexed, GLsizei instances) -> void {
+    device_->DrawInstanced(primitive, count, indexed, instances);
+    stream_.Record(Command::Draw, {
+        primitive,
+        static_cast<uint32_t>(count),
+        static_cast<uint32_t>(instances),
+        indexed
+    });
+}
+
+auto CaptureDevice::OcclusionQueryTarget() const -> GLenum {
+    return device_->OcclusionQueryTarget();
+}
+
+auto CaptureDevice::CreateQuery() -> GLuint {
+    const auto query = device_->CreateQuery();
+    stream_.Record(Command::CreateQuery, {query});
+    return query;
+}
+
+auto CaptureDevice::DeleteQuery(GLuint query) -> void {
+    device_->DeleteQuery(query);
+    stream_.Record(Command::DeleteQuery, {query});
+}
+
+auto CaptureDevice::BeginQuery(GLenum target, GLuint query) -> void {
+    device_->BeginQuery(target, query);
+    stream_.Record(Command::BeginQuery, {target, query});
+}
+
+auto CaptureDevice::EndQuery(GLenum target) -> void {
+    device_->EndQuery(target);
+    stream_.Record(Command::EndQuery, {target});
+}
+
+auto CaptureDevice::QueryResult(GLuint query, GLuint& result) -> bool {
+    return device_->QueryResult(query, result);
+}
+
+auto CaptureDevice::BeginConditionalRender(GLuint query, GLenum mode) -> void {
+    device_->BeginConditionalRender(query, mode);
+    stream_.Record(Command::BeginConditionalRender, {query, mode});
+}
+
+auto CaptureDevice::EndConditionalRender() -> void {
+    device_->EndConditionalRender();
+    stream_.Record(Command::EndConditionalRender);
+}
+
+CaptureDevice::~CaptureDevice() {
+    if (stream_.Size() > 0) Flush();
+}
+
+}
\ No newline at end of file
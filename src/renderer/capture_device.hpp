@@ -0,0 +1,119 @@
+/*
+===========================================================================
+  VGLX https://vglx.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#pragma once
+
+#include "vglx/core/render_commands.hpp"
+
+#include "renderer/render_device.hpp"
+
+#include <expected>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <unordered_map>
+
+namespace vglx {
+
+// Forwards every call to another device and records it, together with the
+// buffer, texture and shader data it uploads, into a RenderCommandStream.
+// The stream is appended to the capture file as one frame each time a new
+// frame begins; calls made before the first frame are written with it.
+// Resource names are the ones returned by the wrapped device, and the
+// replayer maps them to its own.
+class CaptureDevice : public RenderDevice {
+public:
+    CaptureDevice(std::unique_ptr<RenderDevice> device, std::filesystem::path path);
+
+    CaptureDevice(const CaptureDevice&) = delete;
+    CaptureDevice(CaptureDevice&&) = delete;
+    CaptureDevice& operator=(const CaptureDevice&) = delete;
+    CaptureDevice& operator=(CaptureDevice&&) = delete;
+
+    [[nodiscard]] auto Open() -> std::expected<void, std::string>;
+
+    auto BeginFrame() -> void override;
+
+    [[nodiscard]] auto CommandStream() const -> const RenderCommandStream* override {
+        return device_->CommandStream();
+    }
+
+    auto CreateVertexArray() -> GLuint override;
+    auto BindVertexArray(GLuint vao) -> void override;
+
+    auto CreateBuffers(std::span<GLuint> buffers) -> void override;
+    auto DeleteBuffers(std::span<const GLuint> buffers) -> void override;
+    auto BindBuffer(GLenum target, GLuint buffer) -> void override;
+    auto BindBufferBase(GLenum target, GLuint index, GLuint buffer) -> void override;
+    auto BufferData(GLenum target, size_t size, const void* data, GLenum usage) -> void override;
+    auto BufferSubData(GLenum target, size_t size, const void* data) -> bool override;
+
+    auto VertexAttribPointer(GLuint index, GLint size, GLsizei stride, size_t offset) -> void override;
+    auto EnableVertexAttribArray(GLuint index) -> void override;
+    auto VertexAttribDivisor(GLuint index, GLuint divisor) -> void override;
+
+    auto CreateTexture() -> GLuint override;
+    auto DeleteTexture(GLuint texture) -> void override;
+    auto ActiveTexture(GLuint unit) -> void override;
+    auto BindTexture(GLuint texture) -> void override;
+    auto TexImage2D(int width, int height, int alignment, const void* data) -> bool override;
+
+    auto CreateProgram(const std::vector<ShaderInfo>& shaders) -> GLuint override;
+    auto DeleteProgram(GLuint program) -> void override;
+    auto ActiveUniforms(GLuint program) -> std::vector<ActiveUniform> override;
+    auto ActiveUniformBlocks(GLuint program) -> std::vector<std::string> override;
+    auto UniformLocation(GLuint program, const std::string& name) -> GLint override;
+    auto UniformBlockBinding(GLuint program, GLuint index, GLuint binding) -> void override;
+    auto UseProgram(GLuint program) -> void override;
+    auto SetUniform(GLint location, UniformType type, const void* value) -> void override;
+
+    auto Enable(GLenum capability) -> void override;
+    auto Disable(GLenum capability) -> void override;
+    auto Viewport(int x, int y, int width, int height) -> void override;
+    auto DepthMask(bool enabled) -> void override;
+    auto DepthFunc(GLenum func) -> void override;
+    auto PolygonOffset(float factor, float units) -> void override;
+    auto BlendFunc(GLenum source, GLenum destination) -> void override;
+    auto ClearColor(float r, float g, float b, float a) -> void override;
+    auto FrontFace(GLenum mode) -> void override;
+    auto PolygonMode(GLenum face, GLenum mode) -> void override;
+    auto ColorMask(bool enabled) -> void override;
+
+    auto Clear(GLbitfield mask) -> void override;
+    auto Draw(GLenum primitive, GLsizei count, bool indexed) -> void override;
+    auto DrawInstanced(GLenum primitive, GLsizei count, bool indexed, GLsizei instances) -> void override;
+
+    [[nodiscard]] auto OcclusionQueryTarget() const -> GLenum override;
+    auto CreateQuery() -> GLuint override;
+    auto DeleteQuery(GLuint query) -> void override;
+    auto BeginQuery(GLenum target, GLuint query) -> void override;
+    auto EndQuery(GLenum target) -> void override;
+    auto QueryResult(GLuint query, GLuint& result) -> bool override;
+    auto BeginConditionalRender(GLuint query, GLenum mode) -> void override;
+    auto EndConditionalRender() -> void override;
+
+    ~CaptureDevice() override;
+
+private:
+    std::unique_ptr<RenderDevice> device_;
+
+    std::filesystem::path path_;
+
+    std::ofstream file_;
+
+    RenderCommandStream stream_;
+
+    // Block names by program, used to record blocks by name since indices
+    // are assigned by the driver.
+    std::unordered_map<GLuint, std::vector<std::string>> blocks_;
+
+    bool frame_started_ {false};
+
+    auto Flush() -> void;
+};
+
+}
\ No newline at end of file
@@ -26,38 +26,41 @@ constexpr uint8_t BUFF_IDX_INSTANCE_TRANSFORM = 3;
 
 }
 
-#define BUFFER_OFFSET(offset) ((void*)(offset * sizeof(GLfloat)))
-
-auto GLBuffers::Bind(const std::shared_ptr<Geometry>& geometry) -> void {
-    auto vao = geometry->renderer_id;
-    if (vao != 0 && vao == current_vao_) return;
-
-    if (vao == 0) {
+auto GLBuffers::Bind(const std::shared_ptr<Geometry>& geometry) -> GLuint {
+    if (geometry->renderer_id == 0) {
         GenerateBuffers(geometry.get());
-        vao = geometry->renderer_id;
         geometries_.emplace_back(geometry);
     }
 
-    glBindVertexArray(vao);
+    Bind(geometry->renderer_id);
+    return geometry->renderer_id;
+}
+
+auto GLBuffers::Bind(GLuint vao) -> void {
+    if (vao == current_vao_) return;
+
+    device_.BindVertexArray(vao);
     current_vao_ = vao;
+    ++profile_[ProfileCounter::VertexArraySwitches];
 }
 
 auto GLBuffers::GenerateBuffers(Geometry* geometry) -> void {
     auto& vao = geometry->renderer_id;
     auto buffers = std::array<GLuint, 4> {};
 
-    glGenVertexArrays(1, &vao);
-    glBindVertexArray(geometry->renderer_id);
-    glGenBuffers(buffers.size(), buffers.data());
+    vao = device_.CreateVertexArray();
+    device_.BindVertexArray(geometry->renderer_id);
+    device_.CreateBuffers(buffers);
 
     const auto& vertex = geometry->VertexData();
-    glBindBuffer(GL_ARRAY_BUFFER, buffers[BUFF_IDX_VBO]);
-    glBufferData(
+    device_.BindBuffer(GL_ARRAY_BUFFER, buffers[BUFF_IDX_VBO]);
+    device_.BufferData(
         GL_ARRAY_BUFFER,
         vertex.size() * sizeof(GLfloat),
         vertex.data(),
         GL_STATIC_DRAW
     );
+    profile_[ProfileCounter::UploadedBytes] += vertex.size() * sizeof(GLfloat);
 
     auto offset = 0;
     auto stride = 0;
@@ -69,27 +72,26 @@ auto GLBuffers::GenerateBuffers(Geometry* geometry) -> void {
     for (const auto& attr : geometry->Attributes()) {
         if (attr.type == VertexAttributeType::None) continue;
         auto loc = std::to_underlying(attr.type);
-        glVertexAttribPointer(
+        device_.VertexAttribPointer(
             loc,
             attr.item_size,
-            GL_FLOAT,
-            GL_FALSE,
             stride * sizeof(GLfloat),
-            BUFFER_OFFSET(offset)
+            offset * sizeof(GLfloat)
         );
-        glEnableVertexAttribArray(loc);
+        device_.EnableVertexAttribArray(loc);
         offset += attr.item_size;
     }
 
     if (geometry->IndexData().size()) {
         const auto& index = geometry->IndexData();
-        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, buffers[BUFF_IDX_EBO]);
-        glBufferData(
+        device_.BindBuffer(GL_ELEMENT_ARRAY_BUFFER, buffers[BUFF_IDX_EBO]);
+        device_.BufferData(
             GL_ELEMENT_ARRAY_BUFFER,
             index.size() * sizeof(GLuint),
             index.data(),
             GL_STATIC_DRAW
         );
+        profile_[ProfileCounter::UploadedBytes] += index.size() * sizeof(GLuint);
     }
 
     bindings_.try_emplace(vao, std::move(buffers));
@@ -97,8 +99,8 @@ auto GLBuffers::GenerateBuffers(Geometry* geometry) -> void {
     geometry->OnDispose([this](Disposable* target){
         const auto vao = static_cast<Geometry*>(target)->renderer_id;
         auto& buffers = this->bindings_[vao];
-        glDeleteBuffers(buffers.size(), buffers.data());
-        Logger::Log(LogLevel::Info, "Geometry buffer cleared {}", *static_cast<Geometry*>(target));
+        this->device_.DeleteBuffers(buffers);
+        VGLX_LOG(LogLevel::Info, "Geometry buffer cleared {}", *static_cast<Geometry*>(target));
         this->bindings_.erase(vao);
     });
 }
@@ -107,61 +109,54 @@ auto GLBuffers::BindInstancedMesh(InstancedMesh* mesh) -> void {
     if (mesh->impl_->transforms_buff_id == 0) {
         auto& buffers = bindings_[mesh->GetGeometry()->renderer_id];
         mesh->impl_->transforms_buff_id = buffers[BUFF_IDX_INSTANCE_TRANSFORM];
-        glBindBuffer(GL_ARRAY_BUFFER, mesh->impl_->transforms_buff_id);
+        device_.BindBuffer(GL_ARRAY_BUFFER, mesh->impl_->transforms_buff_id);
 
         for (auto i = 0; i < 4; ++i) {
             auto loc = std::to_underlying(VertexAttributeType::InstanceTransform) + i;
-            glEnableVertexAttribArray(loc);
-            glVertexAttribPointer(
+            device_.EnableVertexAttribArray(loc);
+            device_.VertexAttribPointer(
                 loc,
                 4,
-                GL_FLOAT,
-                GL_FALSE,
                 4 * sizeof(Vector4),
-                BUFFER_OFFSET(i * 4)
+                i * sizeof(Vector4)
             );
-            glVertexAttribDivisor(loc, 1);
+            device_.VertexAttribDivisor(loc, 1);
         }
     }
 
     if (mesh->impl_->transforms_touched) {
-        glBindBuffer(GL_ARRAY_BUFFER, mesh->impl_->transforms_buff_id);
-        glBufferData(
+        device_.BindBuffer(GL_ARRAY_BUFFER, mesh->impl_->transforms_buff_id);
+        device_.BufferData(
             GL_ARRAY_BUFFER,
             mesh->transforms_.size() * 4 * sizeof(Vector4),
             mesh->transforms_.data(),
             GL_DYNAMIC_DRAW
         );
+        profile_[ProfileCounter::UploadedBytes] += mesh->transforms_.size() * 4 * sizeof(Vector4);
         mesh->impl_->transforms_touched = false;
     }
 
     if (mesh->impl_->colors_buff_id == 0) {
         auto& buffers = bindings_[mesh->GetGeometry()->renderer_id];
         mesh->impl_->colors_buff_id = buffers[BUFF_IDX_INSTANCE_COLOR];
-        glBindBuffer(GL_ARRAY_BUFFER, mesh->impl_->colors_buff_id);
+        device_.BindBuffer(GL_ARRAY_BUFFER, mesh->impl_->colors_buff_id);
 
         const auto loc = std::to_underlying(VertexAttributeType::InstanceColor);
-        glEnableVertexAttribArray(loc);
-        glVertexAttribPointer(
-                loc,
-                3,
-                GL_FLOAT,
-                GL_FALSE,
-                3 * sizeof(GL_FLOAT),
-                BUFFER_OFFSET(0)
-        );
-        glVertexAttribDivisor(loc, 1);
+        device_.EnableVertexAttribArray(loc);
+        device_.VertexAttribPointer(loc, 3, 3 * sizeof(GL_FLOAT), 0);
+        device_.VertexAttribDivisor(loc, 1);
     }
 
     if (mesh->impl_->colors_touched) {
-        glBindBuffer(GL_ARRAY_BUFFER, mesh->impl_->colors_buff_id);
+        device_.BindBuffer(GL_ARRAY_BUFFER, mesh->impl_->colors_buff_id);
 
-        glBufferData(
+        device_.BufferData(
             GL_ARRAY_BUFFER,
             mesh->colors_.size() * sizeof(Color),
             mesh->colors_.data(),
             GL_DYNAMIC_DRAW
         );
+        profile_[ProfileCounter::UploadedBytes] += mesh->colors_.size() * sizeof(Color);
         mesh->impl_->colors_touched = false;
     }
 }
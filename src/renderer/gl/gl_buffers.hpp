@@ -9,6 +9,9 @@
 
 #include "vglx/geometries/geometry.hpp"
 #include "vglx/nodes/instanced_mesh.hpp"
+#include "vglx/utilities/frame_profile.hpp"
+
+#include "renderer/render_device.hpp"
 
 #include <array>
 #include <memory>
@@ -22,20 +25,29 @@ namespace vglx {
 
 class GLBuffers {
 public:
-    GLBuffers() = default;
+    GLBuffers(RenderDevice& device, FrameProfile& profile)
+      : device_(device), profile_(profile) {}
 
     GLBuffers(const GLBuffers&) = delete;
     GLBuffers(GLBuffers&&) = delete;
     GLBuffers& operator=(const GLBuffers&) = delete;
     GLBuffers& operator=(GLBuffers&&) = delete;
 
-    auto Bind(const std::shared_ptr<Geometry>& geometry) -> void;
+    // Uploads the geometry's buffers on first use, binds its vertex array
+    // and returns it.
+    auto Bind(const std::shared_ptr<Geometry>& geometry) -> GLuint;
+
+    auto Bind(GLuint vao) -> void;
 
     auto BindInstancedMesh(InstancedMesh* mesh) -> void;
 
     ~GLBuffers();
 
 private:
+    RenderDevice& device_;
+
+    FrameProfile& profile_;
+
     std::unordered_map<GLuint, std::array<GLuint, 4>> bindings_;
 
     std::vector<std::weak_ptr<Geometry>> geometries_;
@@ -13,10 +13,13 @@ namespace vglx {
 
 class GLCamera {
 public:
+    explicit GLCamera(RenderDevice& device)
+      : uniform_buffer_(device, "ub_Camera", sizeof(UniformCamera)) {}
+
     auto Update(const Matrix4& projection, const Matrix4& view) {
         camera_.projection = projection;
         camera_.view = view;
-        uniform_buffer_.UploadIfNeeded(&camera_, sizeof(camera_));
+        return uniform_buffer_.UploadIfNeeded(&camera_, sizeof(camera_));
     }
 
 private:
@@ -27,7 +30,7 @@ private:
 
     UniformCamera camera_;
 
-    GLUniformBuffer uniform_buffer_ {"ub_Camera", sizeof(UniformCamera)};
+    GLUniformBuffer uniform_buffer_;
 };
 
 }
\ No newline at end of file
@@ -0,0 +1,401 @@
+/*
+===========================================================================
+  VGLX https://vglx.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#include "renderer/gl/gl_device.hpp"
+
+#include "vglx/geometries/geometry.hpp"
+#include "vglx/utilities/tracer.hpp"
+#include "utilities/logger.hpp"
+
+#include <cstring>
+#include <unordered_map>
+#include <utility>
+
+namespace vglx {
+
+namespace {
+
+const auto VertexAttributesMap = std::unordered_map<std::string, VertexAttributeType> {
+    {"a_Position", VertexAttributeType::Position},
+    {"a_Normal", VertexAttributeType::Normal},
+    {"a_TexCoord", VertexAttributeType::UV},
+    {"a_Tangent", VertexAttributeType::Tangent},
+    {"a_Color", VertexAttributeType::Color},
+    {"a_InstanceColor", VertexAttributeType::InstanceColor},
+    {"a_InstanceTransform", VertexAttributeType::InstanceTransform},
+};
+
+auto get_shader_type(ShaderType type) -> GLenum {
+    switch(type) {
+        case ShaderType::kVertexShader:
+            return GL_VERTEX_SHADER;
+        case ShaderType::kFragmentShader:
+            return GL_FRAGMENT_SHADER;
+        default:
+            return -1;
+    }
+}
+
+auto check_shader_compile_status(GLuint shader_id) -> bool {
+    auto success = 0;
+    glGetShaderiv(shader_id, GL_COMPILE_STATUS, &success);
+    if (success == GL_FALSE) {
+        auto length = 0;
+        glGetShaderiv(shader_id, GL_INFO_LOG_LENGTH, &length);
+        auto buffer = std::string {"", static_cast<size_t>(length)};
+        glGetShaderInfoLog(shader_id, length, nullptr, buffer.data());
+        VGLX_LOG(LogLevel::Error, "Shader compilation error {}", buffer);
+    }
+    return success;
+}
+
+auto check_program_link_status(GLuint program) -> bool {
+    auto success = 0;
+    glGetProgramiv(program, GL_LINK_STATUS, &success);
+    if (success == GL_FALSE) {
+        auto length = 0;
+        glGetProgramiv(program, GL_INFO_LOG_LENGTH, &length);
+        auto buffer = std::string {"", static_cast<size_t>(length)};
+        glGetProgramInfoLog(program, length, nullptr, buffer.data());
+        VGLX_LOG(LogLevel::Error, "Shader program link error {}", buffer);
+    }
+    return success;
+}
+
+}
+
+auto GLDevice::CreateVertexArray() -> GLuint {
+    auto vao = GLuint {0};
+    glGenVertexArrays(1, &vao);
+    return vao;
+}
+
+auto GLDevice::BindVertexArray(GLuint vao) -> void {
+    glBindVertexArray(vao);
+}
+
+auto GLDevice::CreateBuffers(std::span<GLuint> buffers) -> void {
+    glGenBuffers(static_cast<GLsizei>(buffers.size()), buffers.data());
+}
+
+auto GLDevice::DeleteBuffers(std::span<const GLuint> buffers) -> void {
+    glDeleteBuffers(static_cast<GLsizei>(buffers.size()), buffers.data());
+}
+
+auto GLDevice::BindBuffer(GLenum target, GLuint buffer) -> void {
+    glBindBuffer(target, buffer);
+}
+
+auto GLDevice::BindBufferBase(GLenum target, GLuint index, GLuint buffer) -> void {
+    glBindBufferBase(target, index, buffer);
+}
+
+auto GLDevice::BufferData(GLenum target, size_t size, const void* data, GLenum usage) -> void {
+    glBufferData(target, static_cast<GLsizeiptr>(size), data, usage);
+}
+
+auto GLDevice::BufferSubData(GLenum target, size_t size, const void* data) -> bool {
+    auto mapped = glMapBufferRange(
+        target,
+        /* offset = */ 0,
+        static_cast<GLsizeiptr>(size),
+        GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT
+    );
+    if (!mapped) return false;
+
+    std::memcpy(mapped, data, size);
+    glUnmapBuffer(target);
+    return true;
+}
+
+auto GLDevice::VertexAttribPointer(GLuint index, GLint size, GLsizei stride, size_t offset) -> void {
+    glVertexAttribPointer(
+        index,
+        size,
+        GL_FLOAT,
+        GL_FALSE,
+        stride,
+        reinterpret_cast<const void*>(offset)
+    );
+}
+
+auto GLDevice::EnableVertexAttribArray(GLuint index) -> void {
+    glEnableVertexAttribArray(index);
+}
+
+auto GLDevice::VertexAttribDivisor(GLuint index, GLuint divisor) -> void {
+    glVertexAttribDivisor(index, divisor);
+}
+
+auto GLDevice::CreateTexture() -> GLuint {
+    auto texture = GLuint {0};
+    glGenTextures(1, &texture);
+    return texture;
+}
+
+auto GLDevice::DeleteTexture(GLuint texture) -> void {
+    glDeleteTextures(1, &texture);
+}
+
+auto GLDevice::ActiveTexture(GLuint unit) -> void {
+    glActiveTexture(GL_TEXTURE0 + unit);
+}
+
+auto GLDevice::BindTexture(GLuint texture) -> void {
+    glBindTexture(GL_TEXTURE_2D, texture);
+}
+
+auto GLDevice::TexImage2D(int width, int height, int alignment, const void* data) -> bool {
+    glPixelStorei(GL_UNPACK_ALIGNMENT, alignment);
+
+    glTexImage2D(
+        GL_TEXTURE_2D,
+        0,
+        GL_RGBA8, // Guaranteed by asset builder
+        width,
+        height,
+        0,
+        GL_RGBA,
+        GL_UNSIGNED_BYTE,
+        data
+    );
+
+    // Complete without mipmaps
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, 0);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, 0);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+
+    return glGetError() == GL_NO_ERROR;
+}
+
+auto GLDevice::CreateProgram(const std::vector<ShaderInfo>& shaders) -> GLuint {
+    VGLX_TRACE_ZONE("GLProgram::Build");
+    const auto program = glCreateProgram();
+
+    for (const auto& shader_info : shaders) {
+        VGLX_TRACE_ZONE("GLProgram::CompileShader");
+        auto shader_id = glCreateShader(get_shader_type(shader_info.type));
+        auto data = shader_info.source.data();
+
+        glShaderSource(shader_id, 1, &data, nullptr);
+        glCompileShader(shader_id);
+
+        if (!check_shader_compile_status(shader_id)) {
+            glDeleteShader(shader_id);
+            glDeleteProgram(program);
+            return 0;
+        }
+
+        glAttachShader(program, shader_id);
+        glDeleteShader(shader_id);
+    }
+
+    for (auto& [attr_name, attr_type] : VertexAttributesMap) {
+        glBindAttribLocation(
+            program,
+            static_cast<int>(attr_type),
+            attr_name.data()
+        );
+    }
+
+    VGLX_TRACE_ZONE("GLProgram::LinkProgram");
+    glLinkProgram(program);
+    if (!check_program_link_status(program)) {
+        glDeleteProgram(program);
+        return 0;
+    }
+
+    return program;
+}
+
+auto GLDevice::DeleteProgram(GLuint program) -> void {
+    glDeleteProgram(program);
+}
+
+auto GLDevice::ActiveUniforms(GLuint program) -> std::vector<ActiveUniform> {
+    auto n_active_uniforms = GLint {0};
+    glGetProgramiv(program, GL_ACTIVE_UNIFORMS, &n_active_uniforms);
+
+    auto max_name_length = GLsizei {0};
+    glGetProgramiv(program, GL_ACTIVE_UNIFORM_MAX_LENGTH, &max_name_length);
+    auto buffer = std::string {"", static_cast<size_t>(max_name_length)};
+
+    auto uniforms = std::vector<ActiveUniform> {};
+    for (auto i = 0; i < n_active_uniforms; ++i) {
+        auto length = GLsizei {};
+        auto size_unused = GLint {};
+        auto type = GLenum {};
+        glGetActiveUniform(
+            program, i,
+            max_name_length,
+            &length,
+            &size_unused,
+            &type,
+            buffer.data()
+        );
+        uniforms.emplace_back(ActiveUniform {std::string(buffer.data(), length), type});
+    }
+    return uniforms;
+}
+
+auto GLDevice::ActiveUniformBlocks(GLuint program) -> std::vector<std::string> {
+    auto n_active_blocks = GLint {0};
+    glGetProgramiv(program, GL_ACTIVE_UNIFORM_BLOCKS, &n_active_blocks);
+
+    GLint max_name_length = 0;
+    glGetProgramiv(program, GL_ACTIVE_UNIFORM_BLOCK_MAX_NAME_LENGTH, &max_name_length);
+    auto buffer = std::string {"", static_cast<size_t>(max_name_length)};
+
+    auto blocks = std::vector<std::string> {};
+    for (GLint i = 0; i < n_active_blocks; ++i) {
+        auto length = GLsizei {};
+        glGetActiveUniformBlockName(program, i, max_name_length, &length, buffer.data());
+        blocks.emplace_back(buffer.data(), length);
+    }
+    return blocks;
+}
+
+auto GLDevice::UniformLocation(GLuint program, const std::string& name) -> GLint {
+    return glGetUniformLocation(program, name.data());
+}
+
+auto GLDevice::UniformBlockBinding(GLuint program, GLuint index, GLuint binding) -> void {
+    glUniformBlockBinding(program, index, binding);
+}
+
+auto GLDevice::UseProgram(GLuint program) -> void {
+    glUseProgram(program);
+}
+
+auto GLDevice::SetUniform(GLint location, UniformType type, const void* value) -> void {
+    const auto f = static_cast<const GLfloat*>(value);
+    const auto i = static_cast<const GLint*>(value);
+    switch(type) {
+        case UniformType::Float: glUniform1f(location, *f); break;
+        case UniformType::Int: glUniform1i(location, *i); break;
+        case UniformType::Matrix3: glUniformMatrix3fv(location, 1, GL_FALSE, f); break;
+        case UniformType::Matrix4: glUniformMatrix4fv(location, 1, GL_FALSE, f); break;
+        case UniformType::Sampler2D: glUniform1i(location, *i); break;
+        case UniformType::Vector2: glUniform2fv(location, 1, f); break;
+        case UniformType::Vector3: glUniform3fv(location, 1, f); break;
+        case UniformType::Vector4: glUniform4fv(location, 1, f); break;
+        case UniformType::Unsupported: break;
+    }
+}
+
+auto GLDevice::Enable(GLenum capability) -> void {
+    glEnable(capability);
+}
+
+auto GLDevice::Disable(GLenum capability) -> void {
+    glDisable(capability);
+}
+
+auto GLDevice::Viewport(int x, int y, int width, int height) -> void {
+    glViewport(x, y, width, height);
+}
+
+auto GLDevice::DepthMask(bool enabled) -> void {
+    glDepthMask(enabled ? GL_TRUE : GL_FALSE);
+}
+
+auto GLDevice::DepthFunc(GLenum func) -> void {
+    glDepthFunc(func);
+}
+
+auto GLDevice::PolygonOffset(float factor, float units) -> void {
+    glPolygonOffset(factor, units);
+}
+
+auto GLDevice::BlendFunc(GLenum source, GLenum destination) -> void {
+    glBlendFunc(source, destination);
+}
+
+auto GLDevice::ClearColor(float r, float g, float b, float a) -> void {
+    glClearColor(r, g, b, a);
+}
+
+auto GLDevice::FrontFace(GLenum mode) -> void {
+    glFrontFace(mode);
+}
+
+auto GLDevice::PolygonMode(GLenum face, GLenum mode) -> void {
+    glPolygonMode(face, mode);
+}
+
+auto GLDevice::ColorMask(bool enabled) -> void {
+    const auto mask = enabled ? GL_TRUE : GL_FALSE;
+    glColorMask(mask, mask, mask, mask);
+}
+
+auto GLDevice::Clear(GLbitfield mask) -> void {
+    glClear(mask);
+}
+
+auto GLDevice::Draw(GLenum primitive, GLsizei count, bool indexed) -> void {
+    indexed
+        ? glDrawElements(primitive, count, GL_UNSIGNED_INT, nullptr)
+        : glDrawArrays(primitive, 0, count);
+}
+
+auto GLDevice::DrawInstanced(GLenum primitive, GLsizei count, bool indexed, GLsizei instances) -> void {
+    indexed
+        ? glDrawElementsInstanced(primitive, count, GL_UNSIGNED_INT, nullptr, instances)
+        : glDrawArraysInstanced(primitive, 0, count, instances);
+}
+
+auto GLDevice::CreateQuery() -> GLuint {
+    auto query = GLuint {0};
+    glGenQueries(1, &query);
+    return query;
+}
+
+auto GLDevice::OcclusionQueryTarget() const -> GLenum {
+    if (!GLAD_GL_VERSION_4_1) return GL_ANY_SAMPLES_PASSED;
+    auto major = GLint {0};
+    auto minor = GLint {0};
+    glGetIntegerv(GL_MAJOR_VERSION, &major);
+    glGetIntegerv(GL_MINOR_VERSION, &minor);
+    return major > 4 || (major == 4 && minor >= 3)
+        ? kAnySamplesPassedConservative
+        : GL_ANY_SAMPLES_PASSED;
+}
+
+auto GLDevice::DeleteQuery(GLuint query) -> void {
+    glDeleteQueries(1, &query);
+}
+
+auto GLDevice::BeginQuery(GLenum target, GLuint query) -> void {
+    glBeginQuery(target, query);
+}
+
+auto GLDevice::EndQuery(GLenum target) -> void {
+    glEndQuery(target);
+}
+
+auto GLDevice::QueryResult(GLuint query, GLuint& result) -> bool {
+    auto available = GLuint {0};
+    glGetQueryObjectuiv(query, GL_QUERY_RESULT_AVAILABLE, &available);
+    if (!available) return false;
+    glGetQueryObjectuiv(query, GL_QUERY_RESULT, &result);
+    return true;
+}
+
+auto GLDevice::BeginConditionalRender(GLuint query, GLenum mode) -> void {
+    glBeginConditionalRender(query, mode);
+}
+
+auto GLDevice::EndConditionalRender() -> void {
+    glEndConditionalRender();
+}
+
+auto GLDevice::Finish() -> void {
+    glFinish();
+}
+
+}
\ No newline at end of file
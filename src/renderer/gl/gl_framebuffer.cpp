@@ -0,0 +1,54 @@
+/*
+===========================================================================
+  VGLX https://vglx.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#include "renderer/gl/gl_framebuffer.hpp"
+
+#include "utilities/logger.hpp"
+
+namespace vglx {
+
+GLFramebuffer::GLFramebuffer(int width, int height) : width_(width), height_(height) {
+    glGenFramebuffers(1, &framebuffer_);
+    glGenRenderbuffers(1, &color_);
+    glGenRenderbuffers(1, &depth_stencil_);
+    Allocate();
+}
+
+auto GLFramebuffer::Bind() const -> void {
+    glBindFramebuffer(GL_FRAMEBUFFER, framebuffer_);
+}
+
+auto GLFramebuffer::Resize(int width, int height) -> void {
+    if (width == width_ && height == height_) return;
+    width_ = width;
+    height_ = height;
+    Allocate();
+}
+
+auto GLFramebuffer::Allocate() -> void {
+    glBindRenderbuffer(GL_RENDERBUFFER, color_);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, width_, height_);
+    glBindRenderbuffer(GL_RENDERBUFFER, depth_stencil_);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH24_STENCIL8, width_, height_);
+    glBindRenderbuffer(GL_RENDERBUFFER, 0);
+
+    glBindFramebuffer(GL_FRAMEBUFFER, framebuffer_);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, color_);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, GL_RENDERBUFFER, depth_stencil_);
+
+    if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) {
+        VGLX_LOG(LogLevel::Error, "Offscreen framebuffer {}x{} is incomplete", width_, height_);
+    }
+}
+
+GLFramebuffer::~GLFramebuffer() {
+    glDeleteFramebuffers(1, &framebuffer_);
+    glDeleteRenderbuffers(1, &color_);
+    glDeleteRenderbuffers(1, &depth_stencil_);
+}
+
+}
\ No newline at end of file
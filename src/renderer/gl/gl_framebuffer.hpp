@@ -0,0 +1,44 @@
+/*
+===========================================================================
+  VGLX https://vglx.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#pragma once
+
+#include <glad/glad.h>
+
+namespace vglx {
+
+class GLFramebuffer {
+public:
+    GLFramebuffer(int width, int height);
+
+    GLFramebuffer(const GLFramebuffer&) = delete;
+    GLFramebuffer(GLFramebuffer&&) = delete;
+    GLFramebuffer& operator=(const GLFramebuffer&) = delete;
+    GLFramebuffer& operator=(GLFramebuffer&&) = delete;
+
+    auto Bind() const -> void;
+
+    auto Resize(int width, int height) -> void;
+
+    [[nodiscard]] auto Width() const { return width_; }
+
+    [[nodiscard]] auto Height() const { return height_; }
+
+    ~GLFramebuffer();
+
+private:
+    GLuint framebuffer_ {0};
+    GLuint color_ {0};
+    GLuint depth_stencil_ {0};
+
+    int width_ {0};
+    int height_ {0};
+
+    auto Allocate() -> void;
+};
+
+}
\ No newline at end of file
@@ -0,0 +1,133 @@
+/*
+===========================================================================
+  VGLX https://vglx.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#include "renderer/gl/gl_gpu_timer.hpp"
+
+#include <algorithm>
+#include <utility>
+
+namespace vglx {
+
+namespace {
+
+auto elapsed_ms(GLuint64 begin, GLuint64 end) {
+    return static_cast<double>(end - begin) / 1'000'000.0;
+}
+
+}
+
+auto GLGpuTimer::SetEnabled(bool passes, bool draws) -> void {
+    // Timestamp queries are core since OpenGL 3.3.
+    passes_enabled_ = passes && GLAD_GL_VERSION_3_3;
+    draws_enabled_ = passes_enabled_ && draws;
+}
+
+auto GLGpuTimer::BeginFrame() -> void {
+    if (!passes_enabled_) return;
+
+    // Frames complete in submission order, so stop at the first one that is
+    // still in flight rather than waiting for it.
+    for (auto i = size_t {1}; i <= frames_.size(); ++i) {
+        auto& frame = frames_[(current_ + i) % frames_.size()];
+        if (!frame.pending) continue;
+        if (frame.used == 0) {
+            frame.pending = false;
+            continue;
+        }
+
+        auto available = GLint {0};
+        glGetQueryObjectiv(frame.queries[frame.used - 1], GL_QUERY_RESULT_AVAILABLE, &available);
+        if (!available) break;
+        Resolve(frame);
+    }
+
+    current_ = (current_ + 1) % frames_.size();
+    auto& frame = frames_[current_];
+    frame.passes.fill({-1, -1});
+    frame.draws.clear();
+    frame.used = 0;
+    frame.number = ++frame_number_;
+    frame.pending = true;
+}
+
+auto GLGpuTimer::Begin(GpuPass pass) -> void {
+    auto& frame = frames_[current_];
+    if (!passes_enabled_ || !frame.pending) return;
+    frame.passes[std::to_underlying(pass)].first = Timestamp(frame);
+}
+
+auto GLGpuTimer::End(GpuPass pass) -> void {
+    auto& frame = frames_[current_];
+    if (!passes_enabled_ || !frame.pending) return;
+    frame.passes[std::to_underlying(pass)].second = Timestamp(frame);
+}
+
+auto GLGpuTimer::BeginDraw(Material::Type type, size_t program) -> void {
+    auto& frame = frames_[current_];
+    if (!draws_enabled_ || !frame.pending) return;
+    frame.draws.emplace_back(Draw {type, program, static_cast<size_t>(Timestamp(frame))});
+}
+
+auto GLGpuTimer::EndDraw() -> void {
+    auto& frame = frames_[current_];
+    if (!draws_enabled_ || !frame.pending) return;
+    Timestamp(frame);
+}
+
+auto GLGpuTimer::Timestamp(Frame& frame) -> int {
+    if (frame.used == frame.queries.size()) {
+        auto query = GLuint {0};
+        glGenQueries(1, &query);
+        frame.queries.emplace_back(query);
+    }
+    glQueryCounter(frame.queries[frame.used], GL_TIMESTAMP);
+    return static_cast<int>(frame.used++);
+}
+
+auto GLGpuTimer::Resolve(Frame& frame) -> void {
+    frame.pending = false;
+
+    const auto result = [&frame](size_t index) {
+        auto value = GLuint64 {0};
+        glGetQueryObjectui64v(frame.queries[index], GL_QUERY_RESULT, &value);
+        return value;
+    };
+
+    for (auto i = size_t {0}; i < frame.passes.size(); ++i) {
+        const auto [begin, end] = frame.passes[i];
+        profile_.gpu_ms[i] = begin >= 0 && end > begin
+            ? elapsed_ms(result(begin), result(end))
+            : 0.0;
+    }
+    // The profile is filled during the frame following the last one issued.
+    profile_.gpu_latency = frame_number_ + 1 - frame.number;
+
+    if (!draws_enabled_) return;
+
+    material_timings_.clear();
+    for (const auto& draw : frame.draws) {
+        const auto ms = elapsed_ms(result(draw.begin), result(draw.begin + 1));
+        auto it = std::ranges::find(material_timings_, draw.program, &GpuMaterialTiming::program);
+        if (it == material_timings_.end()) {
+            material_timings_.emplace_back(GpuMaterialTiming {draw.type, draw.program, ms, 1});
+        } else {
+            it->ms += ms;
+            ++it->draws;
+        }
+    }
+    std::ranges::sort(material_timings_, std::ranges::greater {}, &GpuMaterialTiming::ms);
+}
+
+GLGpuTimer::~GLGpuTimer() {
+    for (auto& frame : frames_) {
+        if (!frame.queries.empty()) {
+            glDeleteQueries(static_cast<GLsizei>(frame.queries.size()), frame.queries.data());
+        }
+    }
+}
+
+}
\ No newline at end of file
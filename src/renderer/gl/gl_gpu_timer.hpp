@@ -0,0 +1,87 @@
+/*
+===========================================================================
+  VGLX https://vglx.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#pragma once
+
+#include "vglx/core/renderer.hpp"
+#include "vglx/utilities/frame_profile.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <glad/glad.h>
+
+namespace vglx {
+
+class GLGpuTimer {
+public:
+    explicit GLGpuTimer(FrameProfile& profile) : profile_(profile) {}
+
+    GLGpuTimer(const GLGpuTimer&) = delete;
+    GLGpuTimer(GLGpuTimer&&) = delete;
+    GLGpuTimer& operator=(const GLGpuTimer&) = delete;
+    GLGpuTimer& operator=(GLGpuTimer&&) = delete;
+
+    auto SetEnabled(bool passes, bool draws) -> void;
+
+    [[nodiscard]] auto PassesEnabled() const -> bool { return passes_enabled_; }
+
+    auto BeginFrame() -> void;
+
+    auto Begin(GpuPass pass) -> void;
+
+    auto End(GpuPass pass) -> void;
+
+    auto BeginDraw(Material::Type type, size_t program) -> void;
+
+    auto EndDraw() -> void;
+
+    [[nodiscard]] auto MaterialTimings() const -> const std::vector<GpuMaterialTiming>& {
+        return material_timings_;
+    }
+
+    ~GLGpuTimer();
+
+private:
+    struct Draw {
+        Material::Type type;
+        size_t program;
+        size_t begin;
+    };
+
+    struct Frame {
+        std::vector<GLuint> queries;
+        std::array<std::pair<int, int>, FrameProfile::kGpuPassCount> passes;
+        std::vector<Draw> draws;
+        size_t used {0};
+        uint32_t number {0};
+        bool pending {false};
+    };
+
+    // Results are read back once the GPU is this many frames behind at
+    // most; older frames that still have not completed are dropped.
+    std::array<Frame, 4> frames_ {};
+
+    std::vector<GpuMaterialTiming> material_timings_;
+
+    FrameProfile& profile_;
+
+    size_t current_ {0};
+
+    uint32_t frame_number_ {0};
+
+    bool passes_enabled_ {false};
+    bool draws_enabled_ {false};
+
+    auto Timestamp(Frame& frame) -> int;
+
+    auto Resolve(Frame& frame) -> void;
+};
+
+}
\ No newline at end of file
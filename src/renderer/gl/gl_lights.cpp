@@ -20,9 +20,11 @@ namespace vglx {
 
 auto GLLights::AddLight(Light* light, Camera* camera) -> void {
     using enum Light::Type;
+    constexpr auto kLogInterval = std::chrono::seconds(1);
 
     if (idx_ >= kMaxLights) {
-        Logger::Log(
+        VGLX_LOG_EVERY(
+            kLogInterval,
             LogLevel::Error,
             "Exceeded the maximum allowed number of lights ({}) in the scene",
             kMaxLights
@@ -32,7 +34,8 @@ auto GLLights::AddLight(Light* light, Camera* camera) -> void {
 
     if (light->GetType() == Ambient) {
         if (ambient >= 1) {
-            Logger::Log(
+            VGLX_LOG_EVERY(
+                kLogInterval,
                 LogLevel::Error,
                 "Only one ambient light is permitted per scene."
             );
@@ -95,8 +98,8 @@ auto GLLights::AddLight(Light* light, Camera* camera) -> void {
     }
 }
 
-auto GLLights::Update() -> void {
-    uniform_buffer_.UploadIfNeeded(&lights_, sizeof(lights_));
+auto GLLights::Update() -> size_t {
+    return uniform_buffer_.UploadIfNeeded(&lights_, sizeof(lights_));
 }
 
 auto GLLights::HasLights() const -> bool {
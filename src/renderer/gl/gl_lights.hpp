@@ -47,7 +47,8 @@ public:
     uint8_t point {0};
     uint8_t spot {0};
 
-    GLLights() = default;
+    explicit GLLights(RenderDevice& device)
+      : uniform_buffer_(device, "ub_Lights", sizeof(UniformLights)) {}
 
     // delete copy constructor and assignment operator
     GLLights(const GLLights&) = delete;
@@ -63,12 +64,12 @@ public:
 
     auto Reset() -> void;
 
-    auto Update() -> void;
+    auto Update() -> size_t;
 
 private:
     UniformLights lights_ {};
 
-    GLUniformBuffer uniform_buffer_ {"ub_Lights", sizeof(UniformLights)};
+    GLUniformBuffer uniform_buffer_;
 
     unsigned int idx_ {0};
 };
@@ -0,0 +1,52 @@
+/*
+===========================================================================
+  VGLX https://vglx.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#include "renderer/gl/gl_occlusion_queries.hpp"
+
+namespace vglx {
+
+GLOcclusionQueries::GLOcclusionQueries(RenderDevice& device)
+  : device_(device), target_(device.OcclusionQueryTarget()) {}
+
+auto GLOcclusionQueries::BeginFrame() -> void {
+    history_.BeginFrame();
+
+    // Stop at the first query still in flight rather than waiting for it.
+    while (!pending_.empty()) {
+        const auto [name, object] = pending_.front();
+        auto result = GLuint {0};
+        if (!device_.QueryResult(name, result)) break;
+        history_.Resolve(object, result != 0);
+        free_.emplace_back(name);
+        pending_.pop_front();
+    }
+}
+
+auto GLOcclusionQueries::Begin(uint64_t object) -> GLuint {
+    auto name = GLuint {0};
+    if (free_.empty()) {
+        name = device_.CreateQuery();
+    } else {
+        name = free_.back();
+        free_.pop_back();
+    }
+    pending_.emplace_back(Query {name, object});
+    history_.QueryIssued(object);
+    device_.BeginQuery(target_, name);
+    return name;
+}
+
+auto GLOcclusionQueries::End() -> void {
+    device_.EndQuery(target_);
+}
+
+GLOcclusionQueries::~GLOcclusionQueries() {
+    for (const auto& query : pending_) device_.DeleteQuery(query.name);
+    for (const auto name : free_) device_.DeleteQuery(name);
+}
+
+}
\ No newline at end of file
@@ -0,0 +1,66 @@
+/*
+===========================================================================
+  VGLX https://vglx.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#pragma once
+
+#include "core/visibility_history.hpp"
+#include "renderer/render_device.hpp"
+
+#include <cstdint>
+#include <deque>
+#include <vector>
+
+#include <glad/glad.h>
+
+namespace vglx {
+
+// Issues occlusion queries and feeds their results into the visibility
+// history once the GPU has them, so reading them never stalls.
+class GLOcclusionQueries {
+public:
+    explicit GLOcclusionQueries(RenderDevice& device);
+
+    GLOcclusionQueries(const GLOcclusionQueries&) = delete;
+    GLOcclusionQueries(GLOcclusionQueries&&) = delete;
+    GLOcclusionQueries& operator=(const GLOcclusionQueries&) = delete;
+    GLOcclusionQueries& operator=(GLOcclusionQueries&&) = delete;
+
+    // Resolves the queries that completed since the last frame.
+    auto BeginFrame() -> void;
+
+    [[nodiscard]] auto History() -> VisibilityHistory& { return history_; }
+
+    [[nodiscard]] auto History() const -> const VisibilityHistory& { return history_; }
+
+    // Starts a query for `object` and returns its name. Draws until End
+    // count towards the result.
+    auto Begin(uint64_t object) -> GLuint;
+
+    auto End() -> void;
+
+    ~GLOcclusionQueries();
+
+private:
+    struct Query {
+        GLuint name;
+        uint64_t object;
+    };
+
+    RenderDevice& device_;
+
+    VisibilityHistory history_;
+
+    // Queries in the order they were issued, which is the order the GPU
+    // completes them in.
+    std::deque<Query> pending_;
+
+    std::vector<GLuint> free_;
+
+    GLenum target_;
+};
+
+}
\ No newline at end of file
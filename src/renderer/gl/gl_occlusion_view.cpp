@@ -0,0 +1,142 @@
+/*
+===========================================================================
+  VGLX https://vglx.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#include "renderer/gl/gl_occlusion_view.hpp"
+
+#include "utilities/logger.hpp"
+
+#include <array>
+
+namespace vglx {
+
+namespace {
+
+// Draws a quad from four vertex IDs, without vertex buffers.
+constexpr auto kVertexShader = R"(
+    #version 410 core
+    out vec2 v_TexCoord;
+    void main() {
+        v_TexCoord = vec2(gl_VertexID & 1, gl_VertexID >> 1);
+        gl_Position = vec4(v_TexCoord * 2.0 - 1.0, 0.0, 1.0);
+    })";
+
+constexpr auto kFragmentShader = R"(
+    #version 410 core
+    uniform sampler2D u_Depth;
+    in vec2 v_TexCoord;
+    out vec4 v_FragColor;
+    void main() {
+        v_FragColor = vec4(vec3(texture(u_Depth, v_TexCoord).r), 1.0);
+    })";
+
+auto compile(GLenum type, const char* source) {
+    const auto shader = glCreateShader(type);
+    glShaderSource(shader, 1, &source, nullptr);
+    glCompileShader(shader);
+    auto status = GLint {0};
+    glGetShaderiv(shader, GL_COMPILE_STATUS, &status);
+    if (!status) {
+        VGLX_LOG(LogLevel::Error, "Failed to compile the occlusion view shader");
+    }
+    return shader;
+}
+
+// GL state changed by Draw, restored afterwards.
+struct SavedState {
+    std::array<GLint, 4> viewport;
+    GLint program;
+    GLint vao;
+    GLint active_texture;
+    GLint texture;
+    GLboolean depth_test;
+    GLboolean blend;
+    GLboolean cull_face;
+    GLboolean polygon_offset;
+
+    static auto Save() {
+        auto state = SavedState {};
+        glGetIntegerv(GL_VIEWPORT, state.viewport.data());
+        glGetIntegerv(GL_CURRENT_PROGRAM, &state.program);
+        glGetIntegerv(GL_VERTEX_ARRAY_BINDING, &state.vao);
+        glGetIntegerv(GL_ACTIVE_TEXTURE, &state.active_texture);
+        glActiveTexture(GL_TEXTURE0);
+        glGetIntegerv(GL_TEXTURE_BINDING_2D, &state.texture);
+        state.depth_test = glIsEnabled(GL_DEPTH_TEST);
+        state.blend = glIsEnabled(GL_BLEND);
+        state.cull_face = glIsEnabled(GL_CULL_FACE);
+        state.polygon_offset = glIsEnabled(GL_POLYGON_OFFSET_FILL);
+        return state;
+    }
+
+    auto Restore() const {
+        const auto set = [](GLenum capability, GLboolean enabled) {
+            enabled ? glEnable(capability) : glDisable(capability);
+        };
+        set(GL_DEPTH_TEST, depth_test);
+        set(GL_BLEND, blend);
+        set(GL_CULL_FACE, cull_face);
+        set(GL_POLYGON_OFFSET_FILL, polygon_offset);
+        glBindTexture(GL_TEXTURE_2D, texture);
+        glActiveTexture(active_texture);
+        glBindVertexArray(vao);
+        glUseProgram(program);
+        glViewport(viewport[0], viewport[1], viewport[2], viewport[3]);
+    }
+};
+
+}
+
+GLOcclusionView::GLOcclusionView() {
+    const auto vertex = compile(GL_VERTEX_SHADER, kVertexShader);
+    const auto fragment = compile(GL_FRAGMENT_SHADER, kFragmentShader);
+    program_ = glCreateProgram();
+    glAttachShader(program_, vertex);
+    glAttachShader(program_, fragment);
+    glLinkProgram(program_);
+    glDeleteShader(vertex);
+    glDeleteShader(fragment);
+
+    glGenVertexArrays(1, &vao_);
+    glGenTextures(1, &texture_);
+}
+
+auto GLOcclusionView::Draw(
+    std::span<const uint8_t> image,
+    int image_width,
+    int image_height,
+    int x,
+    int y,
+    int width,
+    int height
+) -> void {
+    const auto saved = SavedState::Save();
+
+    glBindTexture(GL_TEXTURE_2D, texture_);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_R8, image_width, image_height, 0, GL_RED, GL_UNSIGNED_BYTE, image.data());
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+
+    glDisable(GL_DEPTH_TEST);
+    glDisable(GL_BLEND);
+    glDisable(GL_CULL_FACE);
+    glDisable(GL_POLYGON_OFFSET_FILL);
+    glViewport(x, y, width, height);
+    glUseProgram(program_);
+    glBindVertexArray(vao_);
+    glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
+
+    saved.Restore();
+}
+
+GLOcclusionView::~GLOcclusionView() {
+    glDeleteProgram(program_);
+    glDeleteVertexArrays(1, &vao_);
+    glDeleteTextures(1, &texture_);
+}
+
+}
\ No newline at end of file
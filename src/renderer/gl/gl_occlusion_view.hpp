@@ -0,0 +1,41 @@
+/*
+===========================================================================
+  VGLX https://vglx.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#pragma once
+
+#include <glad/glad.h>
+
+#include <cstdint>
+#include <span>
+
+namespace vglx {
+
+// Debug overlay that draws the occlusion buffer in the corner of the frame.
+// It saves and restores the GL state it changes, so the renderer's state
+// caches stay valid.
+class GLOcclusionView {
+public:
+    GLOcclusionView();
+
+    GLOcclusionView(const GLOcclusionView&) = delete;
+    GLOcclusionView(GLOcclusionView&&) = delete;
+    GLOcclusionView& operator=(const GLOcclusionView&) = delete;
+    GLOcclusionView& operator=(GLOcclusionView&&) = delete;
+
+    // Draws a grayscale image, bottom row first, into the given rectangle
+    // of the current framebuffer.
+    auto Draw(std::span<const uint8_t> image, int image_width, int image_height, int x, int y, int width, int height) -> void;
+
+    ~GLOcclusionView();
+
+private:
+    GLuint program_ {0};
+    GLuint vao_ {0};
+    GLuint texture_ {0};
+};
+
+}
\ No newline at end of file
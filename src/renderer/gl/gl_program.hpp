@@ -9,8 +9,10 @@
 
 #include "renderer/gl/gl_uniform.hpp"
 #include "renderer/gl/gl_uniform_buffer.hpp"
+#include "renderer/render_device.hpp"
 
 #include <array>
+#include <functional>
 #include <string>
 #include <string_view>
 #include <unordered_map>
@@ -21,15 +23,11 @@
 
 namespace vglx {
 
-// Forward declarations
-enum class ShaderType;
-struct ShaderInfo;
-
 constexpr auto uniforms_len = static_cast<int>(Uniform::KnownUniformsLength);
 
 class GLProgram {
 public:
-    explicit GLProgram(const std::vector<ShaderInfo>& shaders);
+    GLProgram(RenderDevice& device, const std::vector<ShaderInfo>& shaders);
 
     GLProgram(const GLProgram&) = delete;
     GLProgram(GLProgram&&) = delete;
@@ -42,14 +40,25 @@ public:
 
     auto Id() const { return program_; }
 
-    auto SetUnknownUniform(const std::string& name, const void* v) -> void;
+    auto SetUnknownUniform(std::string_view name, const void* v) -> void;
 
     auto SetUniform(Uniform uniform, const void* v) -> void;
 
     ~GLProgram();
 
 private:
-    std::unordered_map<std::string, GLUniform> unknown_uniforms_ {};
+    RenderDevice& device_;
+
+    // Hashes names as views, so that uniforms are found without a copy.
+    struct NameHash {
+        using is_transparent = void;
+
+        auto operator()(std::string_view name) const -> size_t {
+            return std::hash<std::string_view> {}(name);
+        }
+    };
+
+    std::unordered_map<std::string, GLUniform, NameHash, std::equal_to<>> unknown_uniforms_ {};
 
     std::array<std::unique_ptr<GLUniform>, uniforms_len> uniforms_ {nullptr};
 
@@ -57,19 +66,9 @@ private:
 
     bool has_errors_ {false};
 
-    auto BindVertexAttributeLocations() const -> void;
-
-    auto GetUniformLoc(std::string_view name) const -> int;
-
     auto ProcessUniforms() -> void;
 
     auto ProcessUniformBlocks() -> void;
-
-    auto CheckProgramLinkStatus() const -> bool;
-
-    auto CheckShaderCompileStatus(GLuint shader_id) const -> bool;
-
-    auto GetShaderType(ShaderType type) const -> GLuint;
 };
 
 }
\ No newline at end of file
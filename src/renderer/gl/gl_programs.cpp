@@ -16,14 +16,14 @@ namespace vglx {
 auto GLPrograms::GetProgram(const ProgramAttributes& attrs) -> GLProgram* {
     const auto& key = attrs.key;
     if (!programs_.contains(key)) {
-        auto sources = shader_lib_.GetShaderSource(attrs);
+        auto sources = shader_lib_.GetShaderSource(attrs, arena_.Resource());
         if (sources.empty()) {
             return nullptr;
         }
 
-        programs_[key] = std::make_unique<GLProgram>(sources);
+        programs_[key] = std::make_unique<GLProgram>(device_, sources);
 
-        Logger::Log(
+        VGLX_LOG(
             LogLevel::Info,
             "Created a new shader program {}:{}",
             key, Material::TypeToString(attrs.type)
@@ -7,9 +7,11 @@
 
 #pragma once
 
+#include "core/frame_arena.hpp"
 #include "core/program_attributes.hpp"
 #include "core/shader_library.hpp"
 #include "renderer/gl/gl_program.hpp"
+#include "renderer/render_device.hpp"
 
 #include <memory>
 #include <unordered_map>
@@ -18,9 +20,16 @@ namespace vglx {
 
 class GLPrograms {
 public:
+    GLPrograms(RenderDevice& device, FrameArena& arena) : device_(device), arena_(arena) {}
+
     auto GetProgram(const ProgramAttributes& attrs) -> GLProgram*;
 
 private:
+    RenderDevice& device_;
+
+    // Program sources are built in the current frame's arena.
+    FrameArena& arena_;
+
     ShaderLibrary shader_lib_;
 
     std::unordered_map<std::size_t, std::unique_ptr<GLProgram>> programs_ {};
@@ -0,0 +1,102 @@
+/*
+===========================================================================
+  VGLX https://vglx.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#include "renderer/gl/gl_readback.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+namespace vglx {
+
+auto GLReadback::Request(int width, int height, ReadbackCallback callback) -> void {
+    if (count_ == slots_.size()) {
+        CompleteOldest();
+    }
+
+    auto& slot = slots_[(head_ + count_) % slots_.size()];
+    const auto size = static_cast<size_t>(width) * height * 4;
+
+    if (slot.buffer == 0) {
+        glGenBuffers(1, &slot.buffer);
+    }
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, slot.buffer);
+    if (slot.capacity < size) {
+        glBufferData(GL_PIXEL_PACK_BUFFER, size, nullptr, GL_STREAM_READ);
+        slot.capacity = size;
+    }
+
+    // With a pack buffer bound the copy is queued on the GPU and returns
+    // immediately; the fence tells us when the pixels can be mapped.
+    glPixelStorei(GL_PACK_ALIGNMENT, 1);
+    glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+    slot.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    slot.width = width;
+    slot.height = height;
+    slot.callback = std::move(callback);
+    ++count_;
+}
+
+auto GLReadback::Poll(bool wait) -> void {
+    while (count_ > 0) {
+        const auto& slot = slots_[head_];
+        const auto timeout = wait ? std::numeric_limits<GLuint64>::max() : GLuint64 {0};
+        const auto status = glClientWaitSync(slot.fence, GL_SYNC_FLUSH_COMMANDS_BIT, timeout);
+        if (status == GL_TIMEOUT_EXPIRED) return;
+        CompleteOldest();
+    }
+}
+
+auto GLReadback::CompleteOldest() -> void {
+    auto& slot = slots_[head_];
+    head_ = (head_ + 1) % slots_.size();
+    --count_;
+
+    glClientWaitSync(slot.fence, GL_SYNC_FLUSH_COMMANDS_BIT, std::numeric_limits<GLuint64>::max());
+    glDeleteSync(slot.fence);
+    slot.fence = nullptr;
+
+    const auto row_size = static_cast<size_t>(slot.width) * 4;
+    auto pixels = std::vector<uint8_t>(row_size * slot.height);
+
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, slot.buffer);
+    const auto mapped = static_cast<const uint8_t*>(
+        glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, pixels.size(), GL_MAP_READ_BIT)
+    );
+    if (mapped != nullptr) {
+        // OpenGL returns the bottom row first; images are stored top-down.
+        for (auto row = 0; row < slot.height; ++row) {
+            std::memcpy(
+                pixels.data() + row * row_size,
+                mapped + (slot.height - 1 - row) * row_size,
+                row_size
+            );
+        }
+        glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+    }
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+    // The callback may request another readback, so the slot is released
+    // before it runs.
+    const auto callback = std::move(slot.callback);
+    slot.callback = nullptr;
+    if (mapped != nullptr && callback) {
+        callback({slot.width, slot.height, pixels});
+    }
+}
+
+GLReadback::~GLReadback() {
+    for (auto& slot : slots_) {
+        if (slot.fence != nullptr) glDeleteSync(slot.fence);
+        if (slot.buffer != 0) glDeleteBuffers(1, &slot.buffer);
+    }
+}
+
+}
\ No newline at end of file
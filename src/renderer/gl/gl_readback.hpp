@@ -0,0 +1,55 @@
+/*
+===========================================================================
+  VGLX https://vglx.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#pragma once
+
+#include "vglx/core/renderer.hpp"
+
+#include <array>
+#include <cstddef>
+
+#include <glad/glad.h>
+
+namespace vglx {
+
+class GLReadback {
+public:
+    GLReadback() = default;
+
+    GLReadback(const GLReadback&) = delete;
+    GLReadback(GLReadback&&) = delete;
+    GLReadback& operator=(const GLReadback&) = delete;
+    GLReadback& operator=(GLReadback&&) = delete;
+
+    auto Request(int width, int height, ReadbackCallback callback) -> void;
+
+    auto Poll(bool wait) -> void;
+
+    [[nodiscard]] auto Pending() const { return count_; }
+
+    ~GLReadback();
+
+private:
+    struct Slot {
+        GLuint buffer {0};
+        GLsync fence {nullptr};
+        size_t capacity {0};
+        int width {0};
+        int height {0};
+        ReadbackCallback callback;
+    };
+
+    // Enough slots to keep the GPU a couple of frames ahead of the copies.
+    std::array<Slot, 3> slots_ {};
+
+    size_t head_ {0};
+    size_t count_ {0};
+
+    auto CompleteOldest() -> void;
+};
+
+}
\ No newline at end of file
@@ -7,133 +7,494 @@
 
 #include "renderer/gl/gl_renderer_impl.hpp"
 
+#include "vglx/geometries/box_geometry.hpp"
 #include "vglx/materials/phong_material.hpp"
 #include "vglx/materials/shader_material.hpp"
 #include "vglx/materials/sprite_material.hpp"
 #include "vglx/materials/unlit_material.hpp"
 #include "vglx/math/vector3.hpp"
+#include "vglx/math/vector4.hpp"
 #include "vglx/nodes/fog.hpp"
 #include "vglx/nodes/instanced_mesh.hpp"
 #include "vglx/nodes/sprite.hpp"
+#include "vglx/utilities/allocation_tracker.hpp"
+#include "vglx/utilities/tracer.hpp"
 
+#include "core/occlusion_buffer.hpp"
 #include "core/program_attributes.hpp"
 #include "core/render_lists.hpp"
+#include "renderer/capture_device.hpp"
+#include "renderer/gl/gl_device.hpp"
+#include "renderer/null/null_device.hpp"
+#include "utilities/image_writer.hpp"
 #include "utilities/logger.hpp"
 
 #include <glad/glad.h>
 
+#include <algorithm>
+#include <chrono>
+
 namespace vglx {
 
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+// Minimum time between repeats of a log message emitted every frame.
+constexpr auto kLogInterval = std::chrono::seconds(1);
+
+auto elapsed_ms(Clock::time_point start, Clock::time_point end) {
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+// Time and allocation count at a phase boundary.
+struct PhaseMark {
+    Clock::time_point time;
+    AllocationTracker::Counts allocations;
+
+    // Counts every thread, including the job system workers extraction uses.
+    static auto Now() {
+        return PhaseMark {Clock::now(), AllocationTracker::TotalCounts()};
+    }
+
+    // Counts the calling thread only. Submission runs on the rendering
+    // thread alone, while the pipelined simulation may allocate elsewhere.
+    static auto OnThread() {
+        return PhaseMark {Clock::now(), AllocationTracker::ThreadCounts()};
+    }
+};
+
+auto record_phase(FrameProfile& profile, ProfilePhase phase, const PhaseMark& start, const PhaseMark& end) {
+    profile[phase] += elapsed_ms(start.time, end.time);
+    profile.phase_allocations[std::to_underlying(phase)] += (end.allocations - start.allocations).allocations;
+}
+
+auto record_allocations(FrameProfile& profile, const PhaseMark& start, const PhaseMark& end) {
+    const auto counts = end.allocations - start.allocations;
+    profile[ProfileCounter::Allocations] += counts.allocations;
+    profile[ProfileCounter::AllocatedBytes] += counts.bytes;
+}
+
+// Copies the parameters of a material. Its textures are uploaded now and
+// its uniforms copied into `uniforms`, so that submission reads neither.
+auto extract_material(
+    const std::shared_ptr<Material>& material,
+    GLTextures& textures,
+    std::pmr::vector<UniformData>& uniforms
+) -> MaterialData {
+    auto data = MaterialData {};
+    data.material = material;
+    data.state.polygon_offset_factor = material->polygon_offset_factor;
+    data.state.polygon_offset_units = material->polygon_offset_units;
+    data.state.blending = material->blending;
+    data.state.two_sided = material->two_sided;
+    data.state.depth_test = material->depth_test;
+    data.state.transparent = material->transparent;
+    data.opacity = material->opacity;
+
+    const auto bind = [&textures](const std::shared_ptr<Texture2D>& texture) {
+        return texture
+            ? TextureBinding {textures.Upload(texture), texture->GetTransform()}
+            : TextureBinding {};
+    };
+
+    switch (material->GetType()) {
+        case Material::Type::PhongMaterial: {
+            auto m = static_cast<PhongMaterial*>(material.get());
+            data.color = m->color;
+            data.specular = m->specular;
+            data.shininess = m->shininess;
+            data.albedo_map = bind(m->albedo_map);
+            data.alpha_map = bind(m->alpha_map);
+            data.normal_map = bind(m->normal_map);
+            data.specular_map = bind(m->specular_map);
+            break;
+        }
+        case Material::Type::ShaderMaterial: {
+            const auto memory = uniforms.get_allocator().resource();
+            data.first_uniform = static_cast<uint32_t>(uniforms.size());
+            for (const auto& [name, value] : static_cast<ShaderMaterial*>(material.get())->uniforms) {
+                uniforms.emplace_back(UniformData {std::pmr::string {name, memory}, value});
+            }
+            data.uniform_count = static_cast<uint32_t>(uniforms.size()) - data.first_uniform;
+            break;
+        }
+        case Material::Type::SpriteMaterial: {
+            auto m = static_cast<SpriteMaterial*>(material.get());
+            data.color = m->color;
+            data.texture_map = bind(m->texture_map);
+            break;
+        }
+        case Material::Type::UnlitMaterial: {
+            auto m = static_cast<UnlitMaterial*>(material.get());
+            data.color = m->color;
+            data.texture_map = bind(m->texture_map);
+            data.alpha_map = bind(m->alpha_map);
+            break;
+        }
+        default:
+            break;
+    }
+
+    return data;
+}
+
+auto gl_primitive(GeometryPrimitiveType primitive) -> GLenum {
+    switch (primitive) {
+        case GeometryPrimitiveType::Lines: return GL_LINES;
+        case GeometryPrimitiveType::LineLoop: return GL_LINE_LOOP;
+        default: return GL_TRIANGLES;
+    }
+}
+
+// Opaque keys group packets by program, then by material, and keep the
+// front-to-back order within a group. Handles past the width of their
+// field share its last value, which only weakens the grouping.
+auto opaque_sort_key(const DrawPacket& packet, uint32_t order) -> uint64_t {
+    const auto program = std::min(packet.program, uint32_t {0xFFF});
+    const auto material = std::min(packet.material, uint32_t {0xFFFFF});
+    return uint64_t {program} << 52 | uint64_t {material} << 32 | order;
+}
+
+// Whether a renderable's depth can be drawn ahead of it by the position-only
+// program. Shader materials may move vertices in ways it does not know of,
+// and lines and wireframes would not be shaded at equal depth.
+auto uses_depth_prepass(Renderable* renderable) {
+    const auto& material = renderable->GetMaterial();
+    return Renderable::IsMeshType(renderable)
+        && material->depth_prepass
+        && material->depth_test
+        && !material->wireframe
+        && material->GetType() != Material::Type::ShaderMaterial
+        && renderable->GetGeometry()->primitive == GeometryPrimitiveType::Triangles;
+}
+
+// Whether any corner of a world space box is behind the near plane.
+auto reaches_near_plane(const Box3& box, const Matrix4& view_projection) {
+    for (auto corner = 0; corner < 8; ++corner) {
+        const auto p = view_projection * Vector4 {
+            corner & 1 ? box.max.x : box.min.x,
+            corner & 2 ? box.max.y : box.min.y,
+            corner & 4 ? box.max.z : box.min.z,
+            1.0f
+        };
+        if (p.w <= 0.0f || p.z < -p.w) return true;
+    }
+    return false;
+}
+
+// Maps a unit box centered at the origin onto `box`.
+auto box_transform(const Box3& box) -> Matrix4 {
+    const auto center = box.Center();
+    const auto size = box.max - box.min;
+    return {
+        size.x, 0.0f, 0.0f, center.x,
+        0.0f, size.y, 0.0f, center.y,
+        0.0f, 0.0f, size.z, center.z,
+        0.0f, 0.0f, 0.0f, 1.0f
+    };
+}
+
+auto create_device(const Renderer::Parameters& params) -> std::unique_ptr<RenderDevice> {
+    auto device = params.backend == Renderer::Backend::Null
+        ? std::unique_ptr<RenderDevice> {std::make_unique<NullDevice>()}
+        : std::unique_ptr<RenderDevice> {std::make_unique<GLDevice>()};
+    if (!params.capture_path.empty()) {
+        return std::make_unique<CaptureDevice>(std::move(device), params.capture_path);
+    }
+    return device;
+}
+
+}
+
 Renderer::Impl::Impl(const Renderer::Parameters& params)
-  : params_(params),
-    render_lists_(std::make_unique<RenderLists>()) {
+  : device_(create_device(params)),
+    params_(params),
+    render_lists_(std::make_unique<RenderLists>(&frame_arena_)),
+    viewport_width_(params.framebuffer_width),
+    viewport_height_(params.framebuffer_height) {
+    const auto null_backend = params.backend == Renderer::Backend::Null;
+    if (params.offscreen && !null_backend) {
+        framebuffer_ = std::make_unique<GLFramebuffer>(
+            params.framebuffer_width,
+            params.framebuffer_height
+        );
+    }
     state_.SetViewport(0, 0, params.framebuffer_width, params.framebuffer_height);
     state_.SetClearColor(params.clear_color);
+    gpu_timer_.SetEnabled(params.gpu_timers && !null_backend, params.gpu_material_timers);
+    if (params.occlusion_culling) {
+        occlusion_ = std::make_unique<OcclusionBuffer>();
+        if (params.occlusion_debug_view && !null_backend) {
+            occlusion_view_ = std::make_unique<GLOcclusionView>();
+        }
+    }
+    if (params.occlusion_queries) {
+        queries_ = std::make_unique<GLOcclusionQueries>(*device_);
+        query_box_ = Mesh::Create(BoxGeometry::Create(), UnlitMaterial::Create());
+    }
 }
 
 auto Renderer::Impl::Initialize() -> std::expected<void, std::string> {
-    // no-op, nothing to initialize
+    if (!params_.capture_path.empty()) {
+        return static_cast<CaptureDevice*>(device_.get())->Open();
+    }
     return {};
 }
 
-auto Renderer::Impl::RenderObjects(Scene* scene, Camera* camera) -> void {
-    camera_ubo_.Update(camera->projection_matrix, camera->view_matrix);
+auto Renderer::Impl::ExtractPacket(Renderable* renderable, Scene* scene) -> DrawPacket {
+    const auto& material = renderable->GetMaterial();
+    const auto wireframe = material->wireframe && Renderable::IsMeshType(renderable);
+
+    auto packet = DrawPacket {
+        .model = renderable->GetRenderTransform(),
+        .program = ProgramHandle({renderable, {
+            .directional = lights_.directional,
+            .point = lights_.point,
+            .spot = lights_.spot
+        }, scene}),
+        .material = MaterialHandle(material),
+        .geometry = wireframe
+            ? GeometryHandle(static_cast<Mesh*>(renderable)->GetWireframeGeometry())
+            : GeometryHandle(renderable->GetGeometry())
+    };
 
-    for (auto renderable : render_lists_->Opaque()) {
-        RenderObject(renderable, scene, camera);
+    if (renderable->GetNodeType() == Node::Type::Sprite) {
+        const auto sprite = static_cast<Sprite*>(renderable);
+        packet.anchor = sprite->anchor;
+        packet.rotation = sprite->rotation;
     }
 
-    if (!render_lists_->Transparent().empty()) state_.SetDepthMask(false);
-    for (auto renderable : render_lists_->Transparent()) {
-        RenderObject(renderable, scene, camera);
+    if (renderable->GetNodeType() == Node::Type::InstancedMesh) {
+        const auto instanced = static_cast<InstancedMesh*>(renderable);
+        buffers_.BindInstancedMesh(instanced);
+        packet.instance_count = static_cast<uint32_t>(instanced->Count());
     }
 
-    state_.SetDepthMask(true);
+    return packet;
+}
 
-    rendered_objects_per_frame_ = rendered_objects_counter_;
-    rendered_objects_counter_ = 0;
+auto Renderer::Impl::ProgramHandle(const ProgramAttributes& attributes) -> uint32_t {
+    const auto handle = static_cast<uint32_t>(snapshot_.programs.size());
+    const auto [it, inserted] = program_handles_.try_emplace(attributes.key, handle);
+    if (inserted) {
+        snapshot_.programs.emplace_back(attributes);
+    }
+    return it->second;
 }
 
-auto Renderer::Impl::RenderObject(Renderable* renderable, Scene* scene, Camera* camera) -> void {
-    auto geometry = renderable->GetGeometry().get();
-    auto material = renderable->GetMaterial().get();
-    auto attrs = ProgramAttributes {renderable, {
-        .directional = lights_.directional,
-        .point = lights_.point,
-        .spot = lights_.spot
-    }, scene};
+auto Renderer::Impl::MaterialHandle(const std::shared_ptr<Material>& material) -> uint32_t {
+    const auto handle = static_cast<uint32_t>(snapshot_.materials.size());
+    const auto [it, inserted] = material_handles_.try_emplace(material->Id(), handle);
+    if (inserted) {
+        snapshot_.materials.emplace_back(extract_material(material, textures_, snapshot_.uniforms));
+    }
+    return it->second;
+}
 
-    auto program = programs_.GetProgram(attrs);
-    if (!program->IsValid()) {
-        return;
+auto Renderer::Impl::GeometryHandle(const std::shared_ptr<Geometry>& geometry) -> uint32_t {
+    const auto handle = static_cast<uint32_t>(snapshot_.geometries.size());
+    const auto [it, inserted] = geometry_handles_.try_emplace(geometry->Id(), handle);
+    if (inserted) {
+        // Buffer uploads read node data, so they happen here rather than
+        // during submission when the scene may already be simulating the
+        // next frame.
+        const auto vertex_array = buffers_.Bind(geometry);
+        const auto index_count = geometry->IndexCount();
+        snapshot_.geometries.emplace_back(GeometryData {
+            .geometry = geometry,
+            .vertex_array = vertex_array,
+            .primitive = geometry->primitive,
+            .count = static_cast<uint32_t>(index_count ? index_count : geometry->VertexCount()),
+            .indexed = index_count > 0
+        });
     }
+    return it->second;
+}
 
-    state_.ProcessMaterial(material);
-    if (material->wireframe && Renderable::IsMeshType(renderable)) {
-        const auto mesh = static_cast<Mesh*>(renderable);
-        buffers_.Bind(mesh->GetWireframeGeometry());
-        geometry = mesh->GetWireframeGeometry().get();
-    } else {
-        buffers_.Bind(renderable->GetGeometry());
+auto Renderer::Impl::AddQuery(
+    Renderable* renderable,
+    const Matrix4& view_projection,
+    std::pmr::vector<OcclusionQuery>& queries
+) -> uint32_t {
+    if (!queries_ || !RenderLists::UsesOcclusionQuery(renderable)) {
+        return DrawPacket::kNoQuery;
+    }
+    auto& history = queries_->History();
+    const auto object = renderable->Id();
+    if (!history.NeedsQuery(object)) return DrawPacket::kNoQuery;
+
+    // The near plane would clip a box reaching the camera, which could then
+    // hide itself, so the renderable counts as visible instead.
+    auto bounds = renderable->BoundingBox();
+    bounds.ApplyTransform(renderable->GetRenderTransform());
+    if (bounds.IsEmpty() || reaches_near_plane(bounds, view_projection)) {
+        history.Resolve(object, true);
+        return DrawPacket::kNoQuery;
     }
 
-    SetUniforms(program, &attrs, renderable, camera, scene);
+    auto query = OcclusionQuery {query_box_packet_, object};
+    query.bounds.model = box_transform(bounds);
+    queries.emplace_back(query);
+    return static_cast<uint32_t>(queries.size() - 1);
+}
 
-    state_.UseProgram(program->Id());
-    program->UpdateUniforms();
+auto Renderer::Impl::SubmitPackets(std::span<const DrawPacket> packets, bool depth_writes) -> size_t {
+    auto rendered = size_t {0};
+    for (const auto& packet : packets) {
+        if (packet.query == DrawPacket::kNoQuery) {
+            rendered += SubmitPacket(packet);
+            continue;
+        }
 
-    auto primitive = GL_TRIANGLES;
-    if (geometry->primitive == GeometryPrimitiveType::Lines) {
-        primitive = GL_LINES;
+        // The bounds are tested against the depth drawn so far, and the GPU
+        // skips the draw if they are hidden without the CPU waiting for it.
+        device_->ColorMask(false);
+        state_.SetDepthMask(false);
+        const auto query = SubmitQuery(snapshot_.queries[packet.query]);
+        device_->ColorMask(true);
+        state_.SetDepthMask(depth_writes);
+
+        device_->BeginConditionalRender(query, GL_QUERY_WAIT);
+        rendered += SubmitPacket(packet);
+        device_->EndConditionalRender();
     }
-    if (geometry->primitive == GeometryPrimitiveType::LineLoop) {
-        primitive = GL_LINE_LOOP;
+    return rendered;
+}
+
+auto Renderer::Impl::SubmitDepthPrepass() -> bool {
+    if (snapshot_.prepassed.empty()) return false;
+
+    // Without a valid depth program the packets are drawn normally rather
+    // than against depth that was never written.
+    for (auto& program : snapshot_.programs) {
+        if (!program.attributes.depth_only) continue;
+        if (!program.program) {
+            program.program = programs_.GetProgram(program.attributes);
+        }
+        if (!program.program || !program.program->IsValid()) return false;
     }
 
-    const auto index_size = geometry->IndexData().size();
-    const auto vertex_size = geometry->VertexCount();
+    // Only frames that run the pre-pass time it, which is how the savings
+    // estimate tells them apart from baseline frames.
+    gpu_timer_.Begin(GpuPass::DepthPrepass);
+    device_->ColorMask(false);
+    state_.SetDepthMask(true);
+    for (const auto& packet : snapshot_.prepassed) {
+        auto depth = packet;
+        depth.program = packet.depth_program;
+        SubmitPacket(depth);
+    }
+    device_->ColorMask(true);
+    gpu_timer_.End(GpuPass::DepthPrepass);
+    return true;
+}
+
+auto Renderer::Impl::UpdatePrepassSavings() -> void {
+    if (!params_.depth_prepass || profile_.gpu_latency == 0) return;
 
-    if (renderable->GetNodeType() != Node::Type::InstancedMesh) {
-        index_size
-            ? glDrawElements(primitive, index_size, GL_UNSIGNED_INT, nullptr)
-            : glDrawArrays(primitive, 0, vertex_size);
+    // Timed frames arrive a few frames late, and baseline frames are the
+    // ones that ran no pre-pass, so they have no pre-pass time.
+    const auto prepass = profile_[GpuPass::DepthPrepass];
+    const auto opaque = profile_[GpuPass::Opaque];
+    const auto average = [](double& value, double sample, double weight) {
+        value = value > 0.0 ? value + (sample - value) * weight : sample;
+    };
+    if (prepass > 0.0) {
+        average(prepass_ms_, prepass + opaque, 0.05);
+    } else {
+        average(prepass_baseline_ms_, opaque, 0.25);
     }
+    if (prepass_ms_ > 0.0 && prepass_baseline_ms_ > 0.0) {
+        profile_.depth_prepass_saved_ms = prepass_baseline_ms_ - prepass_ms_;
+    }
+}
 
-    if (renderable->GetNodeType() == Node::Type::InstancedMesh) {
-        const auto instanced = static_cast<InstancedMesh*>(renderable);
-        const auto count = instanced->Count();
-        buffers_.BindInstancedMesh(instanced);
+auto Renderer::Impl::SubmitQuery(const OcclusionQuery& query) -> GLuint {
+    // Query boxes are not part of the scene, so they stay out of the draw
+    // counters and the per-program GPU timers.
+    const auto name = queries_->Begin(query.object);
+    SubmitPacket(query.bounds, /* counted = */ false);
+    queries_->End();
+    ++profile_[ProfileCounter::OcclusionQueries];
+    return name;
+}
+
+auto Renderer::Impl::SubmitPacket(const DrawPacket& packet, bool counted) -> bool {
+    VGLX_TRACE_ZONE("RenderObject");
+    // Reading the clock three times per draw is only worth it when asked
+    // for; otherwise Submit times all draws as a single phase.
+    const auto timed = params_.draw_phase_timers;
+    auto mark = timed ? PhaseMark::OnThread() : PhaseMark {};
+    const auto end_phase = [&](ProfilePhase phase) {
+        if (!timed) return;
+        const auto now = PhaseMark::OnThread();
+        record_phase(profile_, phase, mark, now);
+        mark = now;
+    };
 
-        index_size
-            ? glDrawElementsInstanced(primitive, index_size, GL_UNSIGNED_INT, nullptr, count)
-            : glDrawArraysInstanced(primitive, 0, vertex_size, count);
+    auto& program_data = snapshot_.programs[packet.program];
+    if (!program_data.program) {
+        program_data.program = programs_.GetProgram(program_data.attributes);
+    }
+    const auto program = program_data.program;
+    end_phase(ProfilePhase::ProgramResolve);
+    if (!program || !program->IsValid()) {
+        return false;
+    }
+
+    const auto& attrs = program_data.attributes;
+    const auto& material = snapshot_.materials[packet.material];
+    const auto& geometry = snapshot_.geometries[packet.geometry];
+
+    if (counted) gpu_timer_.BeginDraw(attrs.type, attrs.key);
+    SetUniforms(program, packet, material, attrs);
+
+    state_.UseProgram(program->Id());
+    program->UpdateUniforms();
+    end_phase(ProfilePhase::UniformUpload);
+
+    state_.ProcessMaterial(material.state);
+    buffers_.Bind(geometry.vertex_array);
+
+    const auto primitive = gl_primitive(geometry.primitive);
+    const auto count = static_cast<GLsizei>(geometry.count);
+    if (!attrs.instancing) {
+        device_->Draw(primitive, count, geometry.indexed);
+    } else {
+        device_->DrawInstanced(primitive, count, geometry.indexed, packet.instance_count);
+    }
+    if (counted) {
+        gpu_timer_.EndDraw();
+        ++profile_[ProfileCounter::DrawCalls];
+        if (primitive == GL_TRIANGLES) {
+            const auto instances = attrs.instancing ? packet.instance_count : 1;
+            profile_[ProfileCounter::Triangles] += geometry.count / 3 * instances;
+        }
     }
+    end_phase(ProfilePhase::DrawSubmit);
 
-    rendered_objects_counter_++;
+    return true;
 }
 
 auto Renderer::Impl::SetUniforms(
     GLProgram* program,
-    ProgramAttributes* attrs,
-    Renderable* renderable,
-    Camera* camera,
-    Scene* scene
+    const DrawPacket& packet,
+    const MaterialData& material,
+    const ProgramAttributes& attrs
 ) -> void {
-    auto material = renderable->GetMaterial().get();
-    auto model = renderable->GetWorldTransform();
     auto resolution = Vector2(
         params_.framebuffer_width,
         params_.framebuffer_height
     );
 
-    program->SetUniform(Uniform::Model, &model);
-    program->SetUniform(Uniform::Opacity, &material->opacity);
+    program->SetUniform(Uniform::Model, &packet.model);
+    program->SetUniform(Uniform::Opacity, &material.opacity);
     program->SetUniform(Uniform::Resolution, &resolution);
 
-    const auto bind_texture = [&](GLTextureMapType type, std::shared_ptr<Texture2D> tex) {
-        textures_.Bind(tex, type);
-        const auto& transform = tex->GetTransform();
-        program->SetUniform(Uniform::TextureTransform, &transform);
+    const auto bind_texture = [&](GLTextureMapType type, const TextureBinding& binding) {
+        textures_.Bind(binding.texture, type);
+        program->SetUniform(Uniform::TextureTransform, &binding.transform);
         switch(type) {
             case GLTextureMapType::AlbedoMap:
                 program->SetUniform(Uniform::AlbedoMap, &type);
@@ -151,73 +512,64 @@ auto Renderer::Impl::SetUniforms(
                 program->SetUniform(Uniform::TextureMap, &type);
                 break;
             default:
-                Logger::Log(LogLevel::Error, "Unable to bind unknown texture map type");
+                VGLX_LOG_EVERY(kLogInterval, LogLevel::Error, "Unable to bind unknown texture map type");
         }
     };
 
-    if (auto fog = scene->fog.get()) {
-        auto type = fog->GetType();
-        program->SetUniform(Uniform::FogType, &type);
-        if (type == FogType::LinearFog) {
-            auto f = static_cast<LinearFog*>(fog);
-            program->SetUniform(Uniform::FogColor, &f->color);
-            program->SetUniform(Uniform::FogNear, &f->near);
-            program->SetUniform(Uniform::FogFar, &f->far);
+    if (const auto& fog = snapshot_.fog; fog.enabled) {
+        program->SetUniform(Uniform::FogType, &fog.type);
+        program->SetUniform(Uniform::FogColor, &fog.color);
+        if (fog.type == FogType::LinearFog) {
+            program->SetUniform(Uniform::FogNear, &fog.near);
+            program->SetUniform(Uniform::FogFar, &fog.far);
         }
 
-        if (type == FogType::ExponentialFog) {
-            auto f = static_cast<ExponentialFog*>(fog);
-            program->SetUniform(Uniform::FogColor, &f->color);
-            program->SetUniform(Uniform::FogDensity, &f->density);
+        if (fog.type == FogType::ExponentialFog) {
+            program->SetUniform(Uniform::FogDensity, &fog.density);
         }
     }
 
-    if (attrs->type == Material::Type::PhongMaterial) {
-        auto m = static_cast<PhongMaterial*>(material);
+    if (attrs.type == Material::Type::PhongMaterial) {
         if (lights_.HasLights()) {
             program->SetUniform(Uniform::AmbientLight, &lights_.ambient_light);
-            program->SetUniform(Uniform::MaterialDiffuseColor, &m->color);
-            program->SetUniform(Uniform::MaterialSpecularColor, &m->specular);
-            program->SetUniform(Uniform::MaterialShininess, &m->shininess);
+            program->SetUniform(Uniform::MaterialDiffuseColor, &material.color);
+            program->SetUniform(Uniform::MaterialSpecularColor, &material.specular);
+            program->SetUniform(Uniform::MaterialShininess, &material.shininess);
         }
 
-        if (attrs->albedo_map)
-            bind_texture(GLTextureMapType::AlbedoMap, m->albedo_map);
-        if (attrs->alpha_map)
-            bind_texture(GLTextureMapType::AlphaMap, m->alpha_map);
-        if (attrs->normal_map)
-            bind_texture(GLTextureMapType::NormalMap, m->normal_map);
-        if (attrs->specular_map)
-            bind_texture(GLTextureMapType::SpecularMap, m->specular_map);
+        if (attrs.albedo_map)
+            bind_texture(GLTextureMapType::AlbedoMap, material.albedo_map);
+        if (attrs.alpha_map)
+            bind_texture(GLTextureMapType::AlphaMap, material.alpha_map);
+        if (attrs.normal_map)
+            bind_texture(GLTextureMapType::NormalMap, material.normal_map);
+        if (attrs.specular_map)
+            bind_texture(GLTextureMapType::SpecularMap, material.specular_map);
     }
 
-    if (attrs->type == Material::Type::ShaderMaterial) {
-        auto m = static_cast<ShaderMaterial*>(material);
-        for (const auto& [name, value] : m->uniforms) {
+    if (attrs.type == Material::Type::ShaderMaterial) {
+        const auto uniforms = std::span {snapshot_.uniforms}.subspan(material.first_uniform, material.uniform_count);
+        for (const auto& [name, value] : uniforms) {
             program->SetUnknownUniform(name, &value);
         }
     }
 
-    if (attrs->type == Material::Type::SpriteMaterial) {
-        auto m = static_cast<SpriteMaterial*>(material);
-        auto r = static_cast<Sprite*>(renderable);
+    if (attrs.type == Material::Type::SpriteMaterial) {
+        program->SetUniform(Uniform::Anchor, &packet.anchor);
+        program->SetUniform(Uniform::Color, &material.color);
+        program->SetUniform(Uniform::Rotation, &packet.rotation);
 
-        program->SetUniform(Uniform::Anchor, &r->anchor);
-        program->SetUniform(Uniform::Color, &m->color);
-        program->SetUniform(Uniform::Rotation, &r->rotation);
-
-        if (attrs->texture_map)
-            bind_texture(GLTextureMapType::TextureMap, m->texture_map);
+        if (attrs.texture_map)
+            bind_texture(GLTextureMapType::TextureMap, material.texture_map);
     }
 
-    if (attrs->type == Material::Type::UnlitMaterial) {
-        auto m = static_cast<UnlitMaterial*>(material);
-        program->SetUniform(Uniform::Color, &m->color);
+    if (attrs.type == Material::Type::UnlitMaterial) {
+        program->SetUniform(Uniform::Color, &material.color);
 
-        if (attrs->texture_map)
-            bind_texture(GLTextureMapType::TextureMap, m->texture_map);
-        if (attrs->alpha_map)
-            bind_texture(GLTextureMapType::AlphaMap, m->alpha_map);
+        if (attrs.texture_map)
+            bind_texture(GLTextureMapType::TextureMap, material.texture_map);
+        if (attrs.alpha_map)
+            bind_texture(GLTextureMapType::AlphaMap, material.alpha_map);
     }
 }
 
@@ -228,22 +580,216 @@ auto Renderer::Impl::ProcessLights(Camera* camera) -> void {
         lights_.AddLight(light, camera);
     }
 
-    if (lights_.HasLights()) lights_.Update();
+    if (lights_.HasLights()) {
+        profile_[ProfileCounter::UploadedBytes] += lights_.Update();
+    }
 }
 
 auto Renderer::Impl::Render(Scene* scene, Camera* camera) -> void {
-    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+    VGLX_TRACE_ZONE("Render");
+    Extract(scene, camera);
+    Submit();
+}
 
-    scene->UpdateTransformHierarchy();
-    camera->UpdateViewMatrix();
+auto Renderer::Impl::Extract(Scene* scene, Camera* camera) -> void {
+    VGLX_TRACE_ZONE("Extract");
+    const auto frame_start = PhaseMark::Now();
+    frame_arena_.BeginFrame();
+    snapshot_.Reset(frame_arena_.Resource());
+    profile_.Reset();
+    device_->BeginFrame();
+    gpu_timer_.BeginFrame();
+    UpdatePrepassSavings();
+
+    auto start = PhaseMark::Now();
+    {
+        VGLX_TRACE_ZONE("UpdateTransformHierarchy");
+        scene->UpdateTransformHierarchy();
+        camera->UpdateViewMatrix();
+    }
+    auto end = PhaseMark::Now();
+    record_phase(profile_, ProfilePhase::TransformUpdate, start, end);
+
+    {
+        VGLX_TRACE_ZONE("ProcessScene");
+        start = end;
+        render_lists_->Collect(scene, camera);
+        end = PhaseMark::Now();
+        record_phase(profile_, ProfilePhase::Cull, start, end);
+
+        if (occlusion_) {
+            VGLX_TRACE_ZONE("Occlusion");
+            start = end;
+            occlusion_->Rasterize(
+                render_lists_->Occluders(),
+                camera->projection_matrix * camera->view_matrix,
+                jobs_.get()
+            );
+            profile_[ProfileCounter::OccludedObjects] += render_lists_->RemoveOccluded(*occlusion_);
+            end = PhaseMark::Now();
+            record_phase(profile_, ProfilePhase::Occlusion, start, end);
+        }
+
+        if (queries_) {
+            VGLX_TRACE_ZONE("OcclusionQueries");
+            start = end;
+            queries_->BeginFrame();
+            profile_[ProfileCounter::OccludedObjects] += render_lists_->RemoveHidden(queries_->History());
+            end = PhaseMark::Now();
+            record_phase(profile_, ProfilePhase::Occlusion, start, end);
+        }
 
-    render_lists_->ProcessScene(scene, camera);
+        start = end;
+        render_lists_->Sort(camera);
+        end = PhaseMark::Now();
+        record_phase(profile_, ProfilePhase::Sort, start, end);
+    }
+
+    start = end;
     ProcessLights(camera);
+    profile_[ProfileCounter::UploadedBytes] += camera_ubo_.Update(
+        camera->projection_matrix,
+        camera->view_matrix
+    );
+
+    if (auto fog = scene->fog.get()) {
+        auto& state = snapshot_.fog;
+        state.enabled = true;
+        state.type = fog->GetType();
+        state.color = fog->color;
+        if (state.type == FogType::LinearFog) {
+            const auto f = static_cast<LinearFog*>(fog);
+            state.near = f->near;
+            state.far = f->far;
+        }
+        if (state.type == FogType::ExponentialFog) {
+            state.density = static_cast<ExponentialFog*>(fog)->density;
+        }
+    }
+
+    const auto memory = frame_arena_.Resource();
+    rebind_map(program_handles_, memory);
+    rebind_map(material_handles_, memory);
+    rebind_map(geometry_handles_, memory);
 
-    RenderObjects(scene, camera);
+    const auto view_projection = camera->projection_matrix * camera->view_matrix;
+    if (query_box_) {
+        query_box_packet_ = ExtractPacket(query_box_.get(), scene);
+    }
+
+    // Baseline frames are only worth their overdraw when the GPU timer can
+    // measure them.
+    const auto baseline = gpu_timer_.PassesEnabled() &&
+        ++prepass_frame_ % kPrepassBaselineInterval == 0;
+    const auto prepass = params_.depth_prepass && !baseline;
+    const auto opaque = render_lists_->Opaque();
+    for (auto i = size_t {0}; i < opaque.size(); ++i) {
+        auto packet = ExtractPacket(opaque[i], scene);
+        packet.sort_key = opaque_sort_key(packet, static_cast<uint32_t>(i));
+        packet.query = AddQuery(opaque[i], view_projection, snapshot_.queries);
+        // Queried packets are left out, their draws depend on the query.
+        if (prepass && packet.query == DrawPacket::kNoQuery && uses_depth_prepass(opaque[i])) {
+            const auto depth_only = snapshot_.programs[packet.program].attributes.DepthOnly();
+            packet.depth_program = ProgramHandle(depth_only);
+            snapshot_.prepassed.emplace_back(packet);
+        } else {
+            snapshot_.opaque.emplace_back(packet);
+        }
+    }
+
+    const auto transparent = render_lists_->Transparent();
+    for (auto i = size_t {0}; i < transparent.size(); ++i) {
+        auto& packet = snapshot_.transparent.emplace_back(ExtractPacket(transparent[i], scene));
+        packet.sort_key = i;
+        packet.query = AddQuery(transparent[i], view_projection, snapshot_.queries);
+    }
+
+    for (auto renderable : render_lists_->Hidden()) {
+        AddQuery(renderable, view_projection, snapshot_.hidden_queries);
+    }
+
+    end = PhaseMark::Now();
+    record_phase(profile_, ProfilePhase::Extract, start, end);
+
+    start = end;
+    std::ranges::sort(snapshot_.opaque, {}, &DrawPacket::sort_key);
+    std::ranges::sort(snapshot_.prepassed, {}, &DrawPacket::sort_key);
+    end = PhaseMark::Now();
+    record_phase(profile_, ProfilePhase::Sort, start, end);
+    record_allocations(profile_, frame_start, end);
+}
+
+auto Renderer::Impl::Submit() -> void {
+    VGLX_TRACE_ZONE("Submit");
+    const auto submit_start = PhaseMark::OnThread();
+    if (framebuffer_) framebuffer_->Bind();
+    gpu_timer_.Begin(GpuPass::Clear);
+    device_->Clear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+    gpu_timer_.End(GpuPass::Clear);
+
+    const auto draws_start = PhaseMark::OnThread();
+    const auto prepassed = SubmitDepthPrepass();
+
+    auto rendered_objects = size_t {0};
+    gpu_timer_.Begin(GpuPass::Opaque);
+    if (prepassed) {
+        // Only the nearest surface of each pixel passes, so it is the only
+        // one shaded, and the depth is already written.
+        state_.SetDepthFunc(GL_EQUAL);
+        state_.SetDepthMask(false);
+        rendered_objects += SubmitPackets(snapshot_.prepassed, /* depth_writes = */ false);
+        state_.SetDepthFunc(GL_LESS);
+        state_.SetDepthMask(true);
+    } else {
+        rendered_objects += SubmitPackets(snapshot_.prepassed, /* depth_writes = */ true);
+    }
+    rendered_objects += SubmitPackets(snapshot_.opaque, /* depth_writes = */ true);
+    gpu_timer_.End(GpuPass::Opaque);
+
+    if (!snapshot_.hidden_queries.empty()) {
+        // Hidden renderables are tested against the complete opaque depth.
+        device_->ColorMask(false);
+        state_.SetDepthMask(false);
+        for (const auto& query : snapshot_.hidden_queries) {
+            SubmitQuery(query);
+        }
+        device_->ColorMask(true);
+        state_.SetDepthMask(true);
+    }
+
+    gpu_timer_.Begin(GpuPass::Transparent);
+    if (!snapshot_.transparent.empty()) state_.SetDepthMask(false);
+    rendered_objects += SubmitPackets(snapshot_.transparent, /* depth_writes = */ false);
+
+    state_.SetDepthMask(true);
+    gpu_timer_.End(GpuPass::Transparent);
+    if (!params_.draw_phase_timers) {
+        record_phase(profile_, ProfilePhase::DrawSubmit, draws_start, PhaseMark::OnThread());
+    }
+
+    if (occlusion_view_) {
+        // A quarter of the view wide, in the bottom left corner.
+        const auto width = viewport_width_ / 4;
+        occlusion_view_->Draw(
+            occlusion_->DebugImage(),
+            OcclusionBuffer::kWidth,
+            OcclusionBuffer::kHeight,
+            0, 0, width, width * OcclusionBuffer::kHeight / OcclusionBuffer::kWidth
+        );
+    }
+
+    rendered_objects_per_frame_ = rendered_objects;
+
+    readback_.Poll(/* wait = */ false);
+    record_allocations(profile_, submit_start, PhaseMark::OnThread());
 }
 
 auto Renderer::Impl::SetViewport(int x, int y, int width, int height) -> void {
+    if (framebuffer_) {
+        framebuffer_->Resize(x + width, y + height);
+    }
+    viewport_width_ = x + width;
+    viewport_height_ = y + height;
     state_.SetViewport(x, y, width, height);
 }
 
@@ -251,6 +797,35 @@ auto Renderer::Impl::SetClearColor(const Color& color) -> void {
     state_.SetClearColor(color);
 }
 
-Renderer::Impl::~Impl() = default;
+auto Renderer::Impl::SetJobSystem(std::shared_ptr<JobSystem> jobs) -> void {
+    jobs_ = std::move(jobs);
+    render_lists_->SetJobSystem(jobs_.get());
+}
+
+auto Renderer::Impl::ReadPixels(ReadbackCallback callback) -> void {
+    if (params_.backend == Renderer::Backend::Null) {
+        VGLX_LOG_EVERY(kLogInterval, LogLevel::Warning, "ReadPixels is not supported by the null backend");
+        return;
+    }
+    if (framebuffer_) framebuffer_->Bind();
+    readback_.Request(viewport_width_, viewport_height_, std::move(callback));
+}
+
+auto Renderer::Impl::ReadPixels(const std::filesystem::path& path) -> void {
+    ReadPixels([path](const ReadbackImage& image) {
+        auto result = write_tga(path, image.width, image.height, image.pixels);
+        if (!result) {
+            VGLX_LOG(LogLevel::Error, "{}", result.error());
+        }
+    });
+}
+
+auto Renderer::Impl::FlushReadbacks() -> void {
+    readback_.Poll(/* wait = */ true);
+}
+
+Renderer::Impl::~Impl() {
+    FlushReadbacks();
+}
 
 }
\ No newline at end of file
@@ -8,19 +8,34 @@
 #pragma once
 
 #include "vglx/core/renderer.hpp"
+#include "vglx/nodes/mesh.hpp"
 #include "vglx/nodes/renderable.hpp"
+#include "vglx/utilities/frame_profile.hpp"
 
+#include "core/frame_arena.hpp"
+#include "core/frame_snapshot.hpp"
 #include "renderer/gl/gl_buffers.hpp"
 #include "renderer/gl/gl_camera.hpp"
+#include "renderer/gl/gl_framebuffer.hpp"
+#include "renderer/gl/gl_gpu_timer.hpp"
 #include "renderer/gl/gl_lights.hpp"
+#include "renderer/gl/gl_occlusion_queries.hpp"
+#include "renderer/gl/gl_occlusion_view.hpp"
 #include "renderer/gl/gl_programs.hpp"
+#include "renderer/gl/gl_readback.hpp"
 #include "renderer/gl/gl_state.hpp"
 #include "renderer/gl/gl_textures.hpp"
+#include "renderer/render_device.hpp"
 
+#include <cstdint>
 #include <memory>
+#include <memory_resource>
+#include <span>
+#include <unordered_map>
 
 namespace vglx {
 
+class OcclusionBuffer;
 class RenderLists;
 
 class Renderer::Impl {
@@ -36,43 +51,138 @@ public:
 
     auto Render(Scene* scene, Camera* camera) -> void;
 
+    auto Extract(Scene* scene, Camera* camera) -> void;
+
+    auto Submit() -> void;
+
     auto SetViewport(int x, int y, int width, int height) -> void;
 
     auto SetClearColor(const Color& color) -> void;
 
+    auto SetJobSystem(std::shared_ptr<JobSystem> jobs) -> void;
+
     [[nodiscard]] auto RenderedObjectsPerFrame() const {
         return rendered_objects_per_frame_;
     }
 
+    [[nodiscard]] auto GetFrameProfile() const -> const FrameProfile& {
+        return profile_;
+    }
+
+    [[nodiscard]] auto GetGpuMaterialTimings() const -> const std::vector<GpuMaterialTiming>& {
+        return gpu_timer_.MaterialTimings();
+    }
+
+    auto BeginGpuPass(GpuPass pass) -> void {
+        gpu_timer_.Begin(pass);
+    }
+
+    auto EndGpuPass(GpuPass pass) -> void {
+        gpu_timer_.End(pass);
+    }
+
+    [[nodiscard]] auto GetCommandStream() const -> const RenderCommandStream* {
+        return device_->CommandStream();
+    }
+
+    auto ReadPixels(ReadbackCallback callback) -> void;
+
+    auto ReadPixels(const std::filesystem::path& path) -> void;
+
+    auto FlushReadbacks() -> void;
+
     ~Impl();
 
 private:
-    GLBuffers buffers_;
-    GLCamera camera_ubo_;
-    GLLights lights_;
-    GLPrograms programs_;
-    GLState state_;
-    GLTextures textures_;
+    FrameProfile profile_;
+
+    // Declared before the components that issue their calls through it.
+    std::unique_ptr<RenderDevice> device_;
+
+    // Scratch memory for the render lists, snapshot and program sources.
+    // Declared before its users so that it outlives their containers.
+    FrameArena frame_arena_;
+
+    GLBuffers buffers_ {*device_, profile_};
+    GLCamera camera_ubo_ {*device_};
+    GLGpuTimer gpu_timer_ {profile_};
+    GLLights lights_ {*device_};
+    GLPrograms programs_ {*device_, frame_arena_};
+    GLReadback readback_;
+    GLState state_ {*device_, profile_};
+    GLTextures textures_ {*device_, profile_};
 
     Renderer::Parameters params_;
 
+    std::shared_ptr<JobSystem> jobs_;
+
     std::unique_ptr<RenderLists> render_lists_;
 
-    size_t rendered_objects_counter_ {0};
+    std::unique_ptr<GLFramebuffer> framebuffer_;
+
+    // Set when occlusion culling is enabled, the view only when it is also
+    // drawn as a debug overlay.
+    std::unique_ptr<OcclusionBuffer> occlusion_;
+    std::unique_ptr<GLOcclusionView> occlusion_view_;
+
+    // Set when occlusion queries are enabled. Query bounds are drawn as a
+    // unit box scaled to each renderable's bounding box.
+    std::unique_ptr<GLOcclusionQueries> queries_;
+    std::shared_ptr<Mesh> query_box_;
+    DrawPacket query_box_packet_;
+
+    // While pass timers are enabled, every kPrepassBaselineInterval frames a
+    // frame is drawn without the depth pre-pass to measure the opaque pass it
+    // saves. Both times are moving averages, zero until measured.
+    static constexpr auto kPrepassBaselineInterval = 60u;
+    unsigned prepass_frame_ {0};
+    double prepass_ms_ {0.0};
+    double prepass_baseline_ms_ {0.0};
+
+    FrameSnapshot snapshot_;
+
+    // Snapshot table handles by program key, material ID and geometry ID,
+    // rebuilt in the frame arena for every extraction.
+    std::pmr::unordered_map<size_t, uint32_t> program_handles_;
+    std::pmr::unordered_map<uint64_t, uint32_t> material_handles_;
+    std::pmr::unordered_map<uint64_t, uint32_t> geometry_handles_;
+
     size_t rendered_objects_per_frame_ {0};
 
+    int viewport_width_ {0};
+    int viewport_height_ {0};
+
     auto ProcessLights(Camera* camera) -> void;
 
-    auto RenderObjects(Scene* scene, Camera* camera) -> void;
+    auto ExtractPacket(Renderable* renderable, Scene* scene) -> DrawPacket;
+
+    auto ProgramHandle(const ProgramAttributes& attributes) -> uint32_t;
 
-    auto RenderObject(Renderable* renderable, Scene* scene, Camera* camera) -> void;
+    auto MaterialHandle(const std::shared_ptr<Material>& material) -> uint32_t;
+
+    auto GeometryHandle(const std::shared_ptr<Geometry>& geometry) -> uint32_t;
+
+    auto AddQuery(
+        Renderable* renderable,
+        const Matrix4& view_projection,
+        std::pmr::vector<OcclusionQuery>& queries
+    ) -> uint32_t;
+
+    auto SubmitPackets(std::span<const DrawPacket> packets, bool depth_writes) -> size_t;
+
+    auto SubmitDepthPrepass() -> bool;
+
+    auto UpdatePrepassSavings() -> void;
+
+    auto SubmitPacket(const DrawPacket& packet, bool counted = true) -> bool;
+
+    auto SubmitQuery(const OcclusionQuery& query) -> GLuint;
 
     auto SetUniforms(
         GLProgram* program,
-        ProgramAttributes* attrs,
-        Renderable* renderable,
-        Camera* camera,
-        Scene* scene
+        const DrawPacket& packet,
+        const MaterialData& material,
+        const ProgramAttributes& attrs
     ) -> void;
 };
 
@@ -7,33 +7,31 @@
 
 #include "renderer/gl/gl_state.hpp"
 
-#include <glad/glad.h>
-
 namespace vglx {
 
-auto GLState::ProcessMaterial(const Material* material) -> void {
-    SetBackfaceCulling(!material->two_sided);
-    SetDepthTest(material->depth_test);
-    SetPolygonOffset(material->polygon_offset_factor, material->polygon_offset_units);
-    SetBlending(!material->transparent ? Material::Blending::None : material->blending);
+auto GLState::ProcessMaterial(const MaterialState& material) -> void {
+    SetBackfaceCulling(!material.two_sided);
+    SetDepthTest(material.depth_test);
+    SetPolygonOffset(material.polygon_offset_factor, material.polygon_offset_units);
+    SetBlending(!material.transparent ? Material::Blending::None : material.blending);
 }
 
 auto GLState::Enable(int token) -> void {
     if (!features_.contains(token) || !features_[token]) {
-        glEnable(token);
+        device_.Enable(token);
         features_[token] = true;
     }
 }
 
 auto GLState::Disable(int token) -> void {
     if (features_.contains(token) && features_[token]) {
-        glDisable(token);
+        device_.Disable(token);
         features_[token] = false;
     }
 }
 
 auto GLState::SetViewport(int x, int y, int width, int height) const -> void {
-    glViewport(x, y, width, height);
+    device_.Viewport(x, y, width, height);
 }
 
 auto GLState::SetBackfaceCulling(bool enabled) -> void {
@@ -46,22 +44,30 @@ auto GLState::SetDepthTest(bool enabled) -> void {
 
 auto GLState::SetDepthMask(bool enabled) -> void {
     if (curr_depth_mask_ != enabled) {
-        glDepthMask(enabled ? GL_TRUE : GL_FALSE);
+        device_.DepthMask(enabled);
         curr_depth_mask_ = enabled;
     }
 }
 
+auto GLState::SetDepthFunc(GLenum func) -> void {
+    if (curr_depth_func_ != func) {
+        device_.DepthFunc(func);
+        curr_depth_func_ = func;
+    }
+}
+
 auto GLState::UseProgram(unsigned int program_id) -> void {
     if (curr_program_ != program_id) {
-        glUseProgram(program_id);
+        device_.UseProgram(program_id);
         curr_program_ = program_id;
+        ++profile_[ProfileCounter::ProgramSwitches];
     }
 }
 
 auto GLState::SetPolygonOffset(float factor, float units) -> void {
     if (factor != 0.0f || units != 0.0f) {
         Enable(GL_POLYGON_OFFSET_FILL);
-        glPolygonOffset(factor, units);
+        device_.PolygonOffset(factor, units);
     } else {
         Disable(GL_POLYGON_OFFSET_FILL);
     }
@@ -75,16 +81,16 @@ auto GLState::SetBlending(Material::Blending blending) -> void {
             Enable(GL_BLEND);
             switch (blending) {
             case Material::Blending::Normal:
-                glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+                device_.BlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
                 break;
             case Material::Blending::Additive:
-                glBlendFunc(GL_SRC_ALPHA, GL_ONE);
+                device_.BlendFunc(GL_SRC_ALPHA, GL_ONE);
                 break;
             case Material::Blending::Subtractive:
-                glBlendFunc(GL_ZERO, GL_ONE_MINUS_SRC_COLOR);
+                device_.BlendFunc(GL_ZERO, GL_ONE_MINUS_SRC_COLOR);
                 break;
             case Material::Blending::Multiply:
-                glBlendFunc(GL_ZERO, GL_SRC_COLOR);
+                device_.BlendFunc(GL_ZERO, GL_SRC_COLOR);
                 break;
             case Material::Blending::None:
                 break;
@@ -96,22 +102,24 @@ auto GLState::SetBlending(Material::Blending blending) -> void {
 
 auto GLState::SetClearColor(const Color& color) -> void {
     if (curr_clear_color_ != color) {
-        glClearColor(color.r, color.g, color.b, 1.0f);
+        device_.ClearColor(color.r, color.g, color.b, 1.0f);
         curr_clear_color_ = color;
     }
 }
 
 auto GLState::Reset() -> void {
-    glDisable(GL_CULL_FACE);
-    glDisable(GL_DEPTH_TEST);
-    glDisable(GL_POLYGON_OFFSET_FILL);
-    glFrontFace(GL_CCW);
-    glPolygonMode(GL_FRONT_AND_BACK, GL_FILL);
+    device_.Disable(GL_CULL_FACE);
+    device_.Disable(GL_DEPTH_TEST);
+    device_.Disable(GL_POLYGON_OFFSET_FILL);
+    device_.DepthFunc(GL_LESS);
+    device_.FrontFace(GL_CCW);
+    device_.PolygonMode(GL_FRONT_AND_BACK, GL_FILL);
 
     features_.clear();
 
     curr_blending_ = Material::Blending::None;
     curr_depth_mask_ = false;
+    curr_depth_func_ = GL_LESS;
     curr_wireframe_mode_ = false;
     curr_program_ = 0;
 }
@@ -9,6 +9,10 @@
 
 #include <vglx/materials/material.hpp>
 #include <vglx/math/color.hpp>
+#include <vglx/utilities/frame_profile.hpp>
+
+#include "core/frame_snapshot.hpp"
+#include "renderer/render_device.hpp"
 
 #include <memory>
 #include <unordered_map>
@@ -17,12 +21,17 @@ namespace vglx {
 
 class GLState {
 public:
-    auto ProcessMaterial(const Material* material) -> void;
+    GLState(RenderDevice& device, FrameProfile& profile)
+      : device_(device), profile_(profile) {}
+
+    auto ProcessMaterial(const MaterialState& material) -> void;
 
     auto SetClearColor(const Color& color) -> void;
 
     auto SetDepthMask(bool enabled) -> void;
 
+    auto SetDepthFunc(GLenum func) -> void;
+
     auto SetViewport(int x, int y, int width, int height) const -> void;
 
     auto UseProgram(unsigned int program_id) -> void;
@@ -30,6 +39,10 @@ public:
     auto Reset() -> void;
 
 private:
+    RenderDevice& device_;
+
+    FrameProfile& profile_;
+
     std::unordered_map<int, bool> features_;
 
     Material::Blending curr_blending_ {Material::Blending::None};
@@ -42,6 +55,8 @@ private:
 
     unsigned int curr_program_ = 0;
 
+    GLenum curr_depth_func_ {GL_LESS};
+
     auto Enable(int token) -> void;
 
     auto Disable(int token) -> void;
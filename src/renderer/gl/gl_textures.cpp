@@ -15,63 +15,50 @@
 
 namespace vglx {
 
-auto GLTextures::Bind(
-    const std::shared_ptr<Texture>& texture,
-    GLTextureMapType map_type
-) -> void {
-    auto tex_unit = std::to_underlying(map_type);
-    glActiveTexture(GL_TEXTURE0 + tex_unit);
-
-    auto tex_id = texture->renderer_id;
-    if (tex_id == 0) {
-        tex_id = GenerateTexture(texture.get());
+auto GLTextures::Upload(const std::shared_ptr<Texture>& texture) -> GLuint {
+    if (texture->renderer_id == 0) {
+        GenerateTexture(texture.get());
         textures_.emplace_back(texture);
+        // The upload bound the texture to whichever unit was active.
+        current_texture_ids_.fill(0);
     }
+    return texture->renderer_id;
+}
+
+auto GLTextures::Bind(GLuint tex_id, GLTextureMapType map_type) -> void {
+    auto tex_unit = std::to_underlying(map_type);
+    device_.ActiveTexture(tex_unit);
 
     if (tex_id == current_texture_ids_[tex_unit]) return;
 
-    glBindTexture(GL_TEXTURE_2D, tex_id);
+    device_.BindTexture(tex_id);
     current_texture_ids_[tex_unit] = tex_id;
+    ++profile_[ProfileCounter::TextureSwitches];
 }
 
-auto GLTextures::GenerateTexture(Texture* texture) const -> GLuint {
+auto GLTextures::GenerateTexture(Texture* texture) -> GLuint {
     auto& tex_id = texture->renderer_id;
-    glGenTextures(1, &tex_id);
-    glBindTexture(GL_TEXTURE_2D, tex_id);
+    tex_id = device_.CreateTexture();
+    device_.BindTexture(tex_id);
 
     // Currently, the engine only supports 2D textures.
     auto texture_2d = static_cast<Texture2D*>(texture);
 
-    glPixelStorei(
-        GL_UNPACK_ALIGNMENT,
-        std::to_underlying(texture->row_alignment)
-    );
-
-    glTexImage2D(
-        GL_TEXTURE_2D,
-        0,
-        GL_RGBA8, // Guaranteed by asset builder
+    const auto uploaded = device_.TexImage2D(
         texture_2d->width,
         texture_2d->height,
-        0,
-        GL_RGBA,
-        GL_UNSIGNED_BYTE,
+        std::to_underlying(texture->row_alignment),
         texture_2d->data.data()
     );
+    profile_[ProfileCounter::UploadedBytes] += texture_2d->data.size();
 
-    // Complete without mipmaps
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, 0);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, 0);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-
-    if (glGetError() != GL_NO_ERROR) {
-        Logger::Log(LogLevel::Error, "OpenGL error failed to generate texture");
+    if (!uploaded) {
+        VGLX_LOG(LogLevel::Error, "OpenGL error failed to generate texture");
     }
 
     texture->OnDispose([this](Disposable* target) {
-        glDeleteTextures(1, &(static_cast<Texture*>(target)->renderer_id));
-        Logger::Log(LogLevel::Info, "Texture buffer cleared {}", *static_cast<Texture*>(target));
+        this->device_.DeleteTexture(static_cast<Texture*>(target)->renderer_id);
+        VGLX_LOG(LogLevel::Info, "Texture buffer cleared {}", *static_cast<Texture*>(target));
     });
 
     return tex_id;
@@ -8,6 +8,9 @@
 #pragma once
 
 #include "vglx/textures/texture.hpp"
+#include "vglx/utilities/frame_profile.hpp"
+
+#include "renderer/render_device.hpp"
 
 #include <array>
 #include <memory>
@@ -29,26 +32,32 @@ enum class GLTextureMapType {
 
 class GLTextures {
 public:
-    GLTextures() = default;
+    GLTextures(RenderDevice& device, FrameProfile& profile)
+      : device_(device), profile_(profile) {}
 
     GLTextures(const GLTextures&) = delete;
     GLTextures(GLTextures&&) = delete;
     GLTextures& operator=(const GLTextures&) = delete;
     GLTextures& operator=(GLTextures&&) = delete;
 
-    auto Bind(
-        const std::shared_ptr<Texture>& texture,
-        GLTextureMapType map_type
-    ) -> void;
+    // Creates and uploads the texture on first use and returns its name.
+    // Called during extraction, so that submission never reads texture data.
+    auto Upload(const std::shared_ptr<Texture>& texture) -> GLuint;
+
+    auto Bind(GLuint texture_id, GLTextureMapType map_type) -> void;
 
     ~GLTextures();
 
 private:
+    RenderDevice& device_;
+
+    FrameProfile& profile_;
+
     std::vector<std::weak_ptr<Texture>> textures_;
 
     std::array<GLuint, 16> current_texture_ids_ {};
 
-    auto GenerateTexture(Texture* texture) const -> GLuint;
+    auto GenerateTexture(Texture* texture) -> GLuint;
 };
 
 }
\ No newline at end of file
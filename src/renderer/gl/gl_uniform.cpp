@@ -9,6 +9,8 @@
 
 #include "utilities/logger.hpp"
 
+#include <cstring>
+
 namespace vglx {
 
 namespace {
@@ -35,11 +37,20 @@ GLUniform::GLUniform(std::string_view name, GLint location, GLenum type)
     type_(ToUniformType(type))
 {
     if (type_ == UniformType::Unsupported) {
-        Logger::Log(LogLevel::Error, "Unsupported GL uniform type {}:{}", name, type);
+        VGLX_LOG(LogLevel::Error, "Unsupported GL uniform type {}:{}", name, type);
     }
 }
 
 auto GLUniform::SetValue(const void* value) -> void {
+    // The cached value is uninitialized until the first call, so the first
+    // value is uploaded even when it happens to match.
+    if (!has_value_) {
+        std::memcpy(&data_, value, uniform_size(type_));
+        has_value_ = true;
+        needs_upload_ = true;
+        return;
+    }
+
     switch(type_) {
         case UniformType::Float:
             if (data_.f != *reinterpret_cast<const float*>(value)) {
@@ -93,20 +104,9 @@ auto GLUniform::SetValue(const void* value) -> void {
     }
 }
 
-auto GLUniform::UploadIfNeeded() -> void {
+auto GLUniform::UploadIfNeeded(RenderDevice& device) -> void {
     if (!needs_upload_) return;
-    switch(type_) {
-        case UniformType::Float: glUniform1f(location_, data_.f); break;
-        case UniformType::Int: glUniform1i(location_, data_.i); break;
-        case UniformType::Matrix3: glUniformMatrix3fv(location_, 1, GL_FALSE, &data_.m3[0][0]); break;
-        case UniformType::Matrix4: glUniformMatrix4fv(location_, 1, GL_FALSE, &data_.m4[0][0]); break;
-        case UniformType::Sampler2D: glUniform1i(location_, data_.i); break;
-        case UniformType::Vector2: glUniform2fv(location_, 1, &data_.v2[0]); break;
-        case UniformType::Vector3: glUniform3fv(location_, 1, &data_.v3[0]); break;
-        case UniformType::Vector4: glUniform4fv(location_, 1, &data_.v4[0]); break;
-        case UniformType::Unsupported: break;
-    }
-
+    device.SetUniform(location_, type_, &data_);
     needs_upload_ = false;
 }
 
@@ -14,24 +14,14 @@
 #include "vglx/math/vector3.hpp"
 #include "vglx/math/vector4.hpp"
 
+#include "renderer/render_device.hpp"
+
 #include <string>
 
 #include <glad/glad.h>
 
 namespace vglx {
 
-enum class UniformType {
-    Float,
-    Int,
-    Matrix3,
-    Matrix4,
-    Sampler2D,
-    Vector2,
-    Vector3,
-    Vector4,
-    Unsupported
-};
-
 enum class Uniform {
     AlbedoMap,
     AlphaMap,
@@ -89,7 +79,7 @@ public:
 
     auto SetValue(const void* value) -> void;
 
-    auto UploadIfNeeded() -> void;
+    auto UploadIfNeeded(RenderDevice& device) -> void;
 
 private:
     std::string name_;
@@ -100,6 +90,8 @@ private:
 
     bool needs_upload_ {false};
 
+    bool has_value_ {false};
+
     union {
         GLfloat f;
         GLint i;
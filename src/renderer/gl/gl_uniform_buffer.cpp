@@ -13,27 +13,29 @@
 
 namespace vglx {
 
-GLUniformBuffer::GLUniformBuffer(std::string_view name, std::size_t size) :
+GLUniformBuffer::GLUniformBuffer(RenderDevice& device, std::string_view name, std::size_t size) :
+    device_(&device),
     name_(name),
     binding_point_(get_uniform_block_loc(name)),
     size_(size)
 {
     if (binding_point_ == -1) {
-        Logger::Log(LogLevel::Error, "Unknown uniform block {}", name);
+        VGLX_LOG(LogLevel::Error, "Unknown uniform block {}", name);
         return;
     }
 
     data_ = std::make_unique<std::byte[]>(size);
 
-    glGenBuffers(1, &buffer_);
-    glBindBuffer(GL_UNIFORM_BUFFER, buffer_);
-    glBufferData(GL_UNIFORM_BUFFER, size_, nullptr, GL_DYNAMIC_DRAW);
-    glBindBufferBase(GL_UNIFORM_BUFFER, binding_point_, buffer_);
-    glBindBuffer(GL_UNIFORM_BUFFER, 0);
+    device_->CreateBuffers({&buffer_, 1});
+    device_->BindBuffer(GL_UNIFORM_BUFFER, buffer_);
+    device_->BufferData(GL_UNIFORM_BUFFER, size_, nullptr, GL_DYNAMIC_DRAW);
+    device_->BindBufferBase(GL_UNIFORM_BUFFER, binding_point_, buffer_);
+    device_->BindBuffer(GL_UNIFORM_BUFFER, 0);
 }
 
 GLUniformBuffer::GLUniformBuffer(GLUniformBuffer&& other) noexcept
-    : name_(std::move(other.name_)),
+    : device_(other.device_),
+      name_(std::move(other.name_)),
       buffer_(other.buffer_),
       binding_point_(other.binding_point_),
       size_(other.size_),
@@ -46,8 +48,9 @@ GLUniformBuffer::GLUniformBuffer(GLUniformBuffer&& other) noexcept
 auto GLUniformBuffer::operator=(GLUniformBuffer&& other) noexcept -> GLUniformBuffer& {
     if (this != &other) {
         if (buffer_ != 0) {
-            glDeleteBuffers(1, &buffer_);
+            device_->DeleteBuffers({&buffer_, 1});
         }
+        device_ = other.device_;
         name_ = std::move(other.name_);
         buffer_ = other.buffer_;
         binding_point_ = other.binding_point_;
@@ -61,38 +64,31 @@ auto GLUniformBuffer::operator=(GLUniformBuffer&& other) noexcept -> GLUniformBu
     return *this;
 }
 
-auto GLUniformBuffer::UploadIfNeeded(const void* data, std::size_t size) const -> void {
-    if (binding_point_ == -1) return;
+auto GLUniformBuffer::UploadIfNeeded(const void* data, std::size_t size) const -> std::size_t {
+    constexpr auto kLogInterval = std::chrono::seconds(1);
+
+    if (binding_point_ == -1) return 0;
 
     if (size > size_) {
-        Logger::Log(LogLevel::Error, "UBO {} update size exceeds buffer size", name_);
-        return;
+        VGLX_LOG_EVERY(kLogInterval, LogLevel::Error, "UBO {} update size exceeds buffer size", name_);
+        return 0;
     }
     if (std::memcmp(data_.get(), data, size) != 0) {
-        glBindBuffer(GL_UNIFORM_BUFFER, buffer_);
-
-        auto mapped = glMapBufferRange(
-            GL_UNIFORM_BUFFER,
-            /* offset = */ 0,
-            size,
-            GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT
-        );
-
-        if (mapped) {
-            std::memcpy(mapped, data, size);
-            glUnmapBuffer(GL_UNIFORM_BUFFER);
-        } else {
-            Logger::Log(LogLevel::Error, "UBO {} map buffer failed", name_);
+        device_->BindBuffer(GL_UNIFORM_BUFFER, buffer_);
+        if (!device_->BufferSubData(GL_UNIFORM_BUFFER, size, data)) {
+            VGLX_LOG_EVERY(kLogInterval, LogLevel::Error, "UBO {} map buffer failed", name_);
         }
-
-        glBindBuffer(GL_UNIFORM_BUFFER, 0);
+        device_->BindBuffer(GL_UNIFORM_BUFFER, 0);
         std::memcpy(data_.get(), data, size);
+        return size;
     }
+
+    return 0;
 }
 
 GLUniformBuffer::~GLUniformBuffer() {
     if (buffer_ != 0) {
-        glDeleteBuffers(1, &buffer_);
+        device_->DeleteBuffers({&buffer_, 1});
         buffer_ = 0;
     }
 }
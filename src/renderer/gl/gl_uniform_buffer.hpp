@@ -7,6 +7,8 @@
 
 #pragma once
 
+#include "renderer/render_device.hpp"
+
 #include <memory>
 #include <span>
 #include <string>
@@ -31,7 +33,7 @@ constexpr auto get_uniform_block_loc(std::string_view str) {
 
 class GLUniformBuffer {
 public:
-    GLUniformBuffer(std::string_view name, std::size_t size);
+    GLUniformBuffer(RenderDevice& device, std::string_view name, std::size_t size);
 
     // implement move constructor and assignment operator
     GLUniformBuffer(GLUniformBuffer&& other) noexcept;
@@ -41,11 +43,12 @@ public:
     GLUniformBuffer(const GLUniformBuffer&) = delete;
     auto operator=(const GLUniformBuffer&) -> GLUniformBuffer& = delete;
 
-    auto UploadIfNeeded(const void* data, std::size_t size) const -> void;
+    auto UploadIfNeeded(const void* data, std::size_t size) const -> std::size_t;
 
     ~GLUniformBuffer();
 
 private:
+    RenderDevice* device_;
     std::string name_ {""};
     GLuint buffer_ {0};
     int binding_point_ {-1};
@@ -0,0 +1,559 @@
+/*
+===========================================================================
+  VGLX https://vglx.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#include "renderer/null/null_device.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <charconv>
+#include <cctype>
+#include <string_view>
+
+namespace vglx {
+
+namespace {
+
+using Command = RenderCommandType;
+
+struct StructMember {
+    std::string name;
+    std::string type;
+};
+
+using Structs = std::unordered_map<std::string, std::vector<StructMember>>;
+using Defines = std::unordered_map<std::string, std::string>;
+
+auto float_bits(float value) {
+    return std::bit_cast<uint32_t>(value);
+}
+
+auto glsl_type(std::string_view type) -> GLenum {
+    if (type == "float") return GL_FLOAT;
+    if (type == "int") return GL_INT;
+    if (type == "bool") return GL_BOOL;
+    if (type == "vec2") return GL_FLOAT_VEC2;
+    if (type == "vec3") return GL_FLOAT_VEC3;
+    if (type == "vec4") return GL_FLOAT_VEC4;
+    if (type == "mat3") return GL_FLOAT_MAT3;
+    if (type == "mat4") return GL_FLOAT_MAT4;
+    if (type == "sampler2D") return GL_SAMPLER_2D;
+    return 0;
+}
+
+auto is_qualifier(std::string_view token) {
+    return token == "lowp" || token == "mediump" || token == "highp" || token == "const";
+}
+
+auto trim(std::string_view str) -> std::string_view {
+    const auto first = str.find_first_not_of(" \t\r");
+    if (first == std::string_view::npos) return {};
+    const auto last = str.find_last_not_of(" \t\r");
+    return str.substr(first, last - first + 1);
+}
+
+auto split_word(std::string_view str) -> std::pair<std::string_view, std::string_view> {
+    str = trim(str);
+    const auto end = str.find_first_of(" \t(");
+    if (end == std::string_view::npos) return {str, {}};
+    return {str.substr(0, end), trim(str.substr(end))};
+}
+
+auto resolve_value(std::string_view token, const Defines& defines) -> long {
+    token = trim(token);
+    if (auto it = defines.find(std::string {token}); it != defines.end()) {
+        token = trim(it->second);
+    }
+    auto value = 0L;
+    std::from_chars(token.data(), token.data() + token.size(), value);
+    return value;
+}
+
+// Evaluates the `#if` conditions found in engine shaders: a single value,
+// `defined(NAME)`, or a comparison of two values. Anything else is treated as
+// true so that no declaration is missed.
+auto evaluate(std::string_view expr, const Defines& defines) -> bool {
+    expr = trim(expr);
+    if (expr.starts_with("defined")) {
+        auto name = trim(expr.substr(7));
+        if (name.starts_with('(') && name.ends_with(')')) {
+            name = trim(name.substr(1, name.size() - 2));
+        }
+        return defines.contains(std::string {name});
+    }
+
+    for (const auto op : {">=", "<=", "==", "!=", ">", "<"}) {
+        const auto pos = expr.find(op);
+        if (pos == std::string_view::npos) continue;
+        const auto lhs = resolve_value(expr.substr(0, pos), defines);
+        const auto rhs = resolve_value(expr.substr(pos + std::char_traits<char>::length(op)), defines);
+        const auto o = std::string_view {op};
+        if (o == ">=") return lhs >= rhs;
+        if (o == "<=") return lhs <= rhs;
+        if (o == "==") return lhs == rhs;
+        if (o == "!=") return lhs != rhs;
+        if (o == ">") return lhs > rhs;
+        return lhs < rhs;
+    }
+
+    if (expr.find_first_of("&|!()") != std::string_view::npos) return true;
+    return resolve_value(expr, defines) != 0;
+}
+
+// Strips comments and inactive preprocessor branches from a shader source.
+auto preprocess(std::string_view source) -> std::string {
+    struct Branch {
+        bool parent_active;
+        bool active;
+        bool taken;
+    };
+
+    auto defines = Defines {};
+    auto branches = std::vector<Branch> {};
+    const auto active = [&] { return branches.empty() || branches.back().active; };
+
+    auto output = std::string {};
+    auto in_comment = false;
+    while (!source.empty()) {
+        const auto eol = source.find('\n');
+        auto line = std::string {source.substr(0, eol)};
+        source = eol == std::string_view::npos ? std::string_view {} : source.substr(eol + 1);
+
+        // Remove block and line comments.
+        auto code = std::string {};
+        for (auto i = size_t {0}; i < line.size(); ++i) {
+            if (in_comment) {
+                if (line.compare(i, 2, "*/") == 0) {
+                    in_comment = false;
+                    ++i;
+                }
+            } else if (line.compare(i, 2, "/*") == 0) {
+                in_comment = true;
+                ++i;
+            } else if (line.compare(i, 2, "//") == 0) {
+                break;
+            } else {
+                code.push_back(line[i]);
+            }
+        }
+
+        const auto stripped = trim(code);
+        if (!stripped.starts_with('#')) {
+            if (active()) {
+                output += code;
+                output.push_back('\n');
+            }
+            continue;
+        }
+
+        const auto [directive, rest] = split_word(stripped.substr(1));
+        if (directive == "ifdef" || directive == "ifndef") {
+            const auto defined = defines.contains(std::string {split_word(rest).first});
+            const auto value = directive == "ifdef" ? defined : !defined;
+            branches.emplace_back(Branch {active(), active() && value, value});
+        } else if (directive == "if") {
+            const auto value = evaluate(rest, defines);
+            branches.emplace_back(Branch {active(), active() && value, value});
+        } else if (directive == "elif" && !branches.empty()) {
+            auto& branch = branches.back();
+            const auto value = !branch.taken && evaluate(rest, defines);
+            branch.active = branch.parent_active && value;
+            branch.taken = branch.taken || value;
+        } else if (directive == "else" && !branches.empty()) {
+            auto& branch = branches.back();
+            branch.active = branch.parent_active && !branch.taken;
+            branch.taken = true;
+        } else if (directive == "endif" && !branches.empty()) {
+            branches.pop_back();
+        } else if (directive == "define" && active()) {
+            const auto [name, value] = split_word(rest);
+            defines[std::string {name}] = std::string {value};
+        } else if (directive == "undef" && active()) {
+            defines.erase(std::string {split_word(rest).first});
+        }
+    }
+
+    return output;
+}
+
+auto tokenize(std::string_view code) -> std::vector<std::string_view> {
+    auto tokens = std::vector<std::string_view> {};
+    auto i = size_t {0};
+    while (i < code.size()) {
+        const auto c = static_cast<unsigned char>(code[i]);
+        if (std::isalnum(c) || c == '_' || c == '.') {
+            const auto start = i;
+            while (i < code.size()) {
+                const auto n = static_cast<unsigned char>(code[i]);
+                if (!std::isalnum(n) && n != '_' && n != '.') break;
+                ++i;
+            }
+            tokens.emplace_back(code.substr(start, i - start));
+            continue;
+        }
+        if (std::string_view {"{}();,[]"}.find(code[i]) != std::string_view::npos) {
+            tokens.emplace_back(code.substr(i, 1));
+        }
+        ++i;
+    }
+    return tokens;
+}
+
+auto add_uniform(
+    std::vector<ActiveUniform>& uniforms,
+    const Structs& structs,
+    const std::string& name,
+    std::string_view type
+) -> void {
+    if (auto it = structs.find(std::string {type}); it != structs.end()) {
+        for (const auto& member : it->second) {
+            add_uniform(uniforms, structs, name + "." + member.name, member.type);
+        }
+        return;
+    }
+    if (std::ranges::find(uniforms, name, &ActiveUniform::name) == uniforms.end()) {
+        uniforms.emplace_back(ActiveUniform {name, glsl_type(type)});
+    }
+}
+
+// Reads the declarations that follow a type up to the closing semicolon,
+// e.g. `a, b[4];`, and returns their names. Arrays are reported by the name
+// of their first element, as drivers do.
+auto read_declarators(
+    const std::vector<std::string_view>& tokens,
+    size_t& i
+) -> std::vector<std::string> {
+    auto names = std::vector<std::string> {};
+    while (i < tokens.size() && tokens[i] != ";") {
+        if (tokens[i] == ",") {
+            ++i;
+            continue;
+        }
+        auto name = std::string {tokens[i++]};
+        if (i < tokens.size() && tokens[i] == "[") {
+            while (i < tokens.size() && tokens[i] != "]") ++i;
+            ++i;
+            name += "[0]";
+        }
+        names.emplace_back(std::move(name));
+    }
+    return names;
+}
+
+auto skip_block(const std::vector<std::string_view>& tokens, size_t& i) {
+    while (i < tokens.size() && tokens[i] != "}") ++i;
+    while (i < tokens.size() && tokens[i] != ";") ++i;
+}
+
+auto reflect(
+    const std::string& code,
+    std::vector<ActiveUniform>& uniforms,
+    std::vector<std::string>& blocks
+) -> void {
+    const auto tokens = tokenize(code);
+    auto structs = Structs {};
+
+    auto i = size_t {0};
+    while (i < tokens.size()) {
+        const auto token = tokens[i++];
+
+        if (token == "struct" && i + 1 < tokens.size() && tokens[i + 1] == "{") {
+            auto& members = structs[std::string {tokens[i]}];
+            i += 2;
+            while (i < tokens.size() && tokens[i] != "}") {
+                while (i < tokens.size() && is_qualifier(tokens[i])) ++i;
+                if (i >= tokens.size()) break;
+                const auto type = tokens[i++];
+                for (auto& name : read_declarators(tokens, i)) {
+                    members.emplace_back(StructMember {std::move(name), std::string {type}});
+                }
+                ++i;
+            }
+            skip_block(tokens, i);
+            continue;
+        }
+
+        if (token != "uniform") continue;
+
+        while (i < tokens.size() && is_qualifier(tokens[i])) ++i;
+        if (i + 1 >= tokens.size()) break;
+
+        if (tokens[i + 1] == "{") {
+            const auto name = std::string {tokens[i]};
+            if (std::ranges::find(blocks, name) == blocks.end()) {
+                blocks.emplace_back(name);
+            }
+            skip_block(tokens, i);
+            continue;
+        }
+
+        const auto type = tokens[i++];
+        for (const auto& name : read_declarators(tokens, i)) {
+            add_uniform(uniforms, structs, name, type);
+        }
+    }
+}
+
+}
+
+auto NullDevice::BeginFrame() -> void {
+    stream_.Clear();
+}
+
+auto NullDevice::CreateVertexArray() -> GLuint {
+    const auto vao = next_id_++;
+    stream_.Record(Command::CreateVertexArray, {vao});
+    return vao;
+}
+
+auto NullDevice::BindVertexArray(GLuint vao) -> void {
+    stream_.Record(Command::BindVertexArray, {vao});
+}
+
+auto NullDevice::CreateBuffers(std::span<GLuint> buffers) -> void {
+    const auto first = next_id_;
+    for (auto& buffer : buffers) buffer = next_id_++;
+    stream_.Record(
+        Command::CreateBuffers,
+        {static_cast<uint32_t>(buffers.size()), first},
+        std::as_bytes(buffers)
+    );
+}
+
+auto NullDevice::DeleteBuffers(std::span<const GLuint> buffers) -> void {
+    stream_.Record(
+        Command::DeleteBuffers,
+        {static_cast<uint32_t>(buffers.size())},
+        std::as_bytes(buffers)
+    );
+}
+
+auto NullDevice::BindBuffer(GLenum target, GLuint buffer) -> void {
+    stream_.Record(Command::BindBuffer, {target, buffer});
+}
+
+auto NullDevice::BindBufferBase(GLenum target, GLuint index, GLuint buffer) -> void {
+    stream_.Record(Command::BindBufferBase, {target, index, buffer});
+}
+
+auto NullDevice::BufferData(GLenum target, size_t size, const void*, GLenum usage) -> void {
+    stream_.Record(Command::BufferData, {target, static_cast<uint32_t>(size), usage});
+}
+
+auto NullDevice::BufferSubData(GLenum target, size_t size, const void*) -> bool {
+    stream_.Record(Command::BufferSubData, {target, static_cast<uint32_t>(size)});
+    return true;
+}
+
+auto NullDevice::VertexAttribPointer(GLuint index, GLint size, GLsizei stride, size_t offset) -> void {
+    stream_.Record(Command::VertexAttribPointer, {
+        index,
+        static_cast<uint32_t>(size),
+        static_cast<uint32_t>(stride),
+        static_cast<uint32_t>(offset)
+    });
+}
+
+auto NullDevice::EnableVertexAttribArray(GLuint index) -> void {
+    stream_.Record(Command::EnableVertexAttribArray, {index});
+}
+
+auto NullDevice::VertexAttribDivisor(GLuint index, GLuint divisor) -> void {
+    stream_.Record(Command::VertexAttribDivisor, {index, divisor});
+}
+
+auto NullDevice::CreateTexture() -> GLuint {
+    const auto texture = next_id_++;
+    stream_.Record(Command::CreateTexture, {texture});
+    return texture;
+}
+
+auto NullDevice::DeleteTexture(GLuint texture) -> void {
+    stream_.Record(Command::DeleteTexture, {texture});
+}
+
+auto NullDevice::ActiveTexture(GLuint unit) -> void {
+    stream_.Record(Command::ActiveTexture, {unit});
+}
+
+auto NullDevice::BindTexture(GLuint texture) -> void {
+    stream_.Record(Command::BindTexture, {texture});
+}
+
+auto NullDevice::TexImage2D(int width, int height, int alignment, const void*) -> bool {
+    stream_.Record(Command::TexImage2D, {
+        static_cast<uint32_t>(width),
+        static_cast<uint32_t>(height),
+        static_cast<uint32_t>(alignment)
+    });
+    return true;
+}
+
+auto NullDevice::CreateProgram(const std::vector<ShaderInfo>& shaders) -> GLuint {
+    const auto program = next_id_++;
+    auto& reflection = programs_[program];
+    for (const auto& shader : shaders) {
+        reflect(preprocess(shader.source), reflection.uniforms, reflection.blocks);
+    }
+    stream_.Record(Command::CreateProgram, {program});
+    return program;
+}
+
+auto NullDevice::DeleteProgram(GLuint program) -> void {
+    programs_.erase(program);
+    stream_.Record(Command::DeleteProgram, {program});
+}
+
+auto NullDevice::ActiveUniforms(GLuint program) -> std::vector<ActiveUniform> {
+    return programs_[program].uniforms;
+}
+
+auto NullDevice::ActiveUniformBlocks(GLuint program) -> std::vector<std::string> {
+    return programs_[program].blocks;
+}
+
+auto NullDevice::UniformLocation(GLuint program, const std::string& name) -> GLint {
+    const auto& uniforms = programs_[program].uniforms;
+    const auto it = std::ranges::find(uniforms, name, &ActiveUniform::name);
+    const auto location = it == uniforms.end()
+        ? -1
+        : static_cast<GLint>(std::distance(uniforms.begin(), it));
+    stream_.Record(
+        Command::UniformLocation,
+        {program, static_cast<uint32_t>(location)},
+        std::as_bytes(std::span {name})
+    );
+    return location;
+}
+
+auto NullDevice::UniformBlockBinding(GLuint program, GLuint index, GLuint binding) -> void {
+    const auto& blocks = programs_[program].blocks;
+    const auto name = index < blocks.size() ? std::string_view {blocks[index]} : std::string_view {};
+    stream_.Record(
+        Command::UniformBlockBinding,
+        {program, index, binding},
+        std::as_bytes(std::span {name})
+    );
+}
+
+auto NullDevice::UseProgram(GLuint program) -> void {
+    stream_.Record(Command::UseProgram, {program});
+}
+
+auto NullDevice::SetUniform(GLint location, UniformType type, const void* value) -> void {
+    stream_.Record(
+        Command::SetUniform,
+        {static_cast<uint32_t>(location), static_cast<uint32_t>(type)},
+        {static_cast<const std::byte*>(value), uniform_size(type)}
+    );
+}
+
+auto NullDevice::Enable(GLenum capability) -> void {
+    stream_.Record(Command::Enable, {capability});
+}
+
+auto NullDevice::Disable(GLenum capability) -> void {
+    stream_.Record(Command::Disable, {capability});
+}
+
+auto NullDevice::Viewport(int x, int y, int width, int height) -> void {
+    stream_.Record(Command::Viewport, {
+        static_cast<uint32_t>(x),
+        static_cast<uint32_t>(y),
+        static_cast<uint32_t>(width),
+        static_cast<uint32_t>(height)
+    });
+}
+
+auto NullDevice::DepthMask(bool enabled) -> void {
+    stream_.Record(Command::DepthMask, {enabled});
+}
+
+auto NullDevice::DepthFunc(GLenum func) -> void {
+    stream_.Record(Command::DepthFunc, {func});
+}
+
+auto NullDevice::PolygonOffset(float factor, float units) -> void {
+    stream_.Record(Command::PolygonOffset, {float_bits(factor), float_bits(units)});
+}
+
+auto NullDevice::BlendFunc(GLenum source, GLenum destination) -> void {
+    stream_.Record(Command::BlendFunc, {source, destination});
+}
+
+auto NullDevice::ClearColor(float r, float g, float b, float a) -> void {
+    stream_.Record(Command::ClearColor, {float_bits(r), float_bits(g), float_bits(b), float_bits(a)});
+}
+
+auto NullDevice::FrontFace(GLenum mode) -> void {
+    stream_.Record(Command::FrontFace, {mode});
+}
+
+auto NullDevice::PolygonMode(GLenum face, GLenum mode) -> void {
+    stream_.Record(Command::PolygonMode, {face, mode});
+}
+
+auto NullDevice::ColorMask(bool enabled) -> void {
+    stream_.Record(Command::ColorMask, {enabled});
+}
+
+auto NullDevice::Clear(GLbitfield mask) -> void {
+    stream_.Record(Command::Clear, {mask});
+}
+
+auto NullDevice::Draw(GLenum primitive, GLsizei count, bool indexed) -> void {
+    stream_.Record(Command::Draw, {primitive, static_cast<uint32_t>(count), 1, indexed});
+}
+
+auto NullDevice::DrawInstanced(GLenum primitive, GLsizei count, bool indexed, GLsizei instances) -> void {
+    stream_.Record(Command::Draw, {
+        primitive,
+        static_cast<uint32_t>(count),
+        static_cast<uint32_t>(instances),
+        indexed
+    });
+}
+
+
+auto NullDevice::OcclusionQueryTarget() const -> GLenum {
+    // Without a driver, only the target every supported version has.
+    return GL_ANY_SAMPLES_PASSED;
+}
+
+auto NullDevice::CreateQuery() -> GLuint {
+    const auto query = next_id_++;
+    stream_.Record(Command::CreateQuery, {query});
+    return query;
+}
+
+auto NullDevice::DeleteQuery(GLuint query) -> void {
+    stream_.Record(Command::DeleteQuery, {query});
+}
+
+auto NullDevice::BeginQuery(GLenum target, GLuint query) -> void {
+    stream_.Record(Command::BeginQuery, {target, query});
+}
+
+auto NullDevice::EndQuery(GLenum target) -> void {
+    stream_.Record(Command::EndQuery, {target});
+}
+
+auto NullDevice::QueryResult(GLuint, GLuint& result) -> bool {
+    // Nothing is rasterized, so every query is complete and reports that
+    // samples passed.
+    result = 1;
+    return true;
+}
+
+auto NullDevice::BeginConditionalRender(GLuint query, GLenum mode) -> void {
+    stream_.Record(Command::BeginConditionalRender, {query, mode});
+}
+
+auto NullDevice::EndConditionalRender() -> void {
+    stream_.Record(Command::EndConditionalRender);
+}
+
+}
\ No newline at end of file
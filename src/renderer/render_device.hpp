@@ -0,0 +1,132 @@
+/*
+===========================================================================
+  VGLX https://vglx.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#pragma once
+
+#include "vglx/core/render_commands.hpp"
+
+#include "core/shader_library.hpp"
+
+#include <cstddef>
+#include <span>
+#include <string>
+#include <vector>
+
+#include <glad/glad.h>
+
+namespace vglx {
+
+enum class UniformType {
+    Float,
+    Int,
+    Matrix3,
+    Matrix4,
+    Sampler2D,
+    Vector2,
+    Vector3,
+    Vector4,
+    Unsupported
+};
+
+// Size in bytes of the value passed to SetUniform.
+inline auto uniform_size(UniformType type) -> size_t {
+    switch (type) {
+        case UniformType::Float: return sizeof(float);
+        case UniformType::Int: return sizeof(int);
+        case UniformType::Matrix3: return 9 * sizeof(float);
+        case UniformType::Matrix4: return 16 * sizeof(float);
+        case UniformType::Sampler2D: return sizeof(int);
+        case UniformType::Vector2: return 2 * sizeof(float);
+        case UniformType::Vector3: return 3 * sizeof(float);
+        case UniformType::Vector4: return 4 * sizeof(float);
+        default: return 0;
+    }
+}
+
+// Core since OpenGL 4.3, past the version the loader is generated for. It
+// lets the driver answer occlusion queries from coarser, cheaper depth tests.
+constexpr auto kAnySamplesPassedConservative = GLenum {0x8D6A};
+
+struct ActiveUniform {
+    std::string name;
+    GLenum type;
+};
+
+// The subset of OpenGL used by the renderer components. The OpenGL device
+// forwards each call to the driver and the null device records it into a
+// RenderCommandStream, which lets the renderer run without a context. The
+// capture device wraps either one and writes the calls to a file.
+class RenderDevice {
+public:
+    virtual ~RenderDevice() = default;
+
+    virtual auto BeginFrame() -> void {}
+
+    [[nodiscard]] virtual auto CommandStream() const -> const RenderCommandStream* {
+        return nullptr;
+    }
+
+    virtual auto CreateVertexArray() -> GLuint = 0;
+    virtual auto BindVertexArray(GLuint vao) -> void = 0;
+
+    virtual auto CreateBuffers(std::span<GLuint> buffers) -> void = 0;
+    virtual auto DeleteBuffers(std::span<const GLuint> buffers) -> void = 0;
+    virtual auto BindBuffer(GLenum target, GLuint buffer) -> void = 0;
+    virtual auto BindBufferBase(GLenum target, GLuint index, GLuint buffer) -> void = 0;
+    virtual auto BufferData(GLenum target, size_t size, const void* data, GLenum usage) -> void = 0;
+    virtual auto BufferSubData(GLenum target, size_t size, const void* data) -> bool = 0;
+
+    virtual auto VertexAttribPointer(GLuint index, GLint size, GLsizei stride, size_t offset) -> void = 0;
+    virtual auto EnableVertexAttribArray(GLuint index) -> void = 0;
+    virtual auto VertexAttribDivisor(GLuint index, GLuint divisor) -> void = 0;
+
+    virtual auto CreateTexture() -> GLuint = 0;
+    virtual auto DeleteTexture(GLuint texture) -> void = 0;
+    virtual auto ActiveTexture(GLuint unit) -> void = 0;
+    virtual auto BindTexture(GLuint texture) -> void = 0;
+    virtual auto TexImage2D(int width, int height, int alignment, const void* data) -> bool = 0;
+
+    virtual auto CreateProgram(const std::vector<ShaderInfo>& shaders) -> GLuint = 0;
+    virtual auto DeleteProgram(GLuint program) -> void = 0;
+    virtual auto ActiveUniforms(GLuint program) -> std::vector<ActiveUniform> = 0;
+    virtual auto ActiveUniformBlocks(GLuint program) -> std::vector<std::string> = 0;
+    virtual auto UniformLocation(GLuint program, const std::string& name) -> GLint = 0;
+    virtual auto UniformBlockBinding(GLuint program, GLuint index, GLuint binding) -> void = 0;
+    virtual auto UseProgram(GLuint program) -> void = 0;
+    virtual auto SetUniform(GLint location, UniformType type, const void* value) -> void = 0;
+
+    virtual auto Enable(GLenum capability) -> void = 0;
+    virtual auto Disable(GLenum capability) -> void = 0;
+    virtual auto Viewport(int x, int y, int width, int height) -> void = 0;
+    virtual auto DepthMask(bool enabled) -> void = 0;
+    virtual auto DepthFunc(GLenum func) -> void = 0;
+    virtual auto PolygonOffset(float factor, float units) -> void = 0;
+    virtual auto BlendFunc(GLenum source, GLenum destination) -> void = 0;
+    virtual auto ClearColor(float r, float g, float b, float a) -> void = 0;
+    virtual auto FrontFace(GLenum mode) -> void = 0;
+    virtual auto PolygonMode(GLenum face, GLenum mode) -> void = 0;
+    virtual auto ColorMask(bool enabled) -> void = 0;
+
+    virtual auto Clear(GLbitfield mask) -> void = 0;
+    virtual auto Draw(GLenum primitive, GLsizei count, bool indexed) -> void = 0;
+    virtual auto DrawInstanced(GLenum primitive, GLsizei count, bool indexed, GLsizei instances) -> void = 0;
+
+    // Target occlusion queries are issued with, the conservative one where
+    // the driver supports it.
+    [[nodiscard]] virtual auto OcclusionQueryTarget() const -> GLenum = 0;
+    virtual auto CreateQuery() -> GLuint = 0;
+    virtual auto DeleteQuery(GLuint query) -> void = 0;
+    virtual auto BeginQuery(GLenum target, GLuint query) -> void = 0;
+    virtual auto EndQuery(GLenum target) -> void = 0;
+    // Stores the result and returns true only if it is available, without
+    // waiting for the GPU.
+    virtual auto QueryResult(GLuint query, GLuint& result) -> bool = 0;
+    virtual auto BeginConditionalRender(GLuint query, GLenum mode) -> void = 0;
+    virtual auto EndConditionalRender() -> void = 0;
+};
+
+}
\ No newline at end of file
@@ -0,0 +1,34 @@
+#version 410 core
+
+#extension GL_GOOGLE_include_directive : enable
+
+#pragma inject_attributes
+
+// Position-only shader of the depth pre-pass. The position is computed the
+// same way as in vert_main_varyings.glsl, and both declare gl_Position
+// invariant, so the color pass can test against it with GL_EQUAL.
+
+in vec3 a_Position;
+
+#ifdef USE_INSTANCING
+    in mat4 a_InstanceTransform;
+#endif
+
+uniform mat4 u_Model;
+
+layout(std140) uniform ub_Camera {
+    mat4 u_Projection;
+    mat4 u_View;
+};
+
+invariant gl_Position;
+
+void main() {
+    mat4 model_view = u_View * u_Model;
+
+    #ifdef USE_INSTANCING
+        model_view *= a_InstanceTransform;
+    #endif
+
+    gl_Position = u_Projection * (model_view * vec4(a_Position, 1.0));
+}
\ No newline at end of file
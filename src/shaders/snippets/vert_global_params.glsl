@@ -51,4 +51,8 @@ out vec4 v_Position;
 layout(std140) uniform ub_Camera {
     mat4 u_Projection;
     mat4 u_View;
-};
\ No newline at end of file
+};
+
+// Matches depth.vert so the depth pre-pass and the color pass produce
+// identical depths.
+invariant gl_Position;
\ No newline at end of file
@@ -0,0 +1,156 @@
+/*
+===========================================================================
+  VGLX https://vglx.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+// Replacements for the global allocation functions that count allocations
+// with the AllocationTracker. They are built as the vglx_allocation_hooks
+// object library rather than into the engine, so only executables that link
+// it, such as the tests and benchmarks, replace the program's allocator.
+
+#include "vglx/utilities/allocation_tracker.hpp"
+
+#include <cstdlib>
+#include <new>
+
+namespace vglx {
+
+namespace {
+
+// Marks the tracker as supported once this object is linked in.
+[[maybe_unused]] const auto installed = AllocationTracker::Install();
+
+auto try_allocate(std::size_t size, std::align_val_t alignment) -> void* {
+    const auto align = static_cast<std::size_t>(alignment);
+    if (align <= __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+        return std::malloc(size ? size : 1);
+    }
+#ifdef _WIN32
+    return _aligned_malloc(size ? size : 1, align);
+#else
+    // aligned_alloc requires the size to be a multiple of the alignment.
+    return std::aligned_alloc(align, (size + align - 1) / align * align);
+#endif
+}
+
+auto release(void* ptr, std::align_val_t alignment) {
+#ifdef _WIN32
+    if (static_cast<std::size_t>(alignment) > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+        _aligned_free(ptr);
+        return;
+    }
+#else
+    static_cast<void>(alignment);
+#endif
+    std::free(ptr);
+}
+
+// Exceptions are disabled, so allocation failure that the new handler
+// cannot resolve terminates instead of throwing std::bad_alloc.
+auto allocate(std::size_t size, std::align_val_t alignment) -> void* {
+    AllocationTracker::Record(size);
+    while (true) {
+        if (auto ptr = try_allocate(size, alignment)) return ptr;
+        const auto handler = std::get_new_handler();
+        if (!handler) std::abort();
+        handler();
+    }
+}
+
+constexpr auto kDefaultAlignment = std::align_val_t {__STDCPP_DEFAULT_NEW_ALIGNMENT__};
+
+}
+
+}
+
+using vglx::allocate;
+using vglx::AllocationTracker;
+using vglx::kDefaultAlignment;
+using vglx::release;
+using vglx::try_allocate;
+
+auto operator new(std::size_t size) -> void* {
+    return allocate(size, kDefaultAlignment);
+}
+
+auto operator new[](std::size_t size) -> void* {
+    return allocate(size, kDefaultAlignment);
+}
+
+auto operator new(std::size_t size, std::align_val_t alignment) -> void* {
+    return allocate(size, alignment);
+}
+
+auto operator new[](std::size_t size, std::align_val_t alignment) -> void* {
+    return allocate(size, alignment);
+}
+
+auto operator new(std::size_t size, const std::nothrow_t&) noexcept -> void* {
+    AllocationTracker::Record(size);
+    return try_allocate(size, kDefaultAlignment);
+}
+
+auto operator new[](std::size_t size, const std::nothrow_t&) noexcept -> void* {
+    AllocationTracker::Record(size);
+    return try_allocate(size, kDefaultAlignment);
+}
+
+auto operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept -> void* {
+    AllocationTracker::Record(size);
+    return try_allocate(size, alignment);
+}
+
+auto operator new[](std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept -> void* {
+    AllocationTracker::Record(size);
+    return try_allocate(size, alignment);
+}
+
+auto operator delete(void* ptr) noexcept -> void {
+    release(ptr, kDefaultAlignment);
+}
+
+auto operator delete[](void* ptr) noexcept -> void {
+    release(ptr, kDefaultAlignment);
+}
+
+auto operator delete(void* ptr, std::size_t) noexcept -> void {
+    release(ptr, kDefaultAlignment);
+}
+
+auto operator delete[](void* ptr, std::size_t) noexcept -> void {
+    release(ptr, kDefaultAlignment);
+}
+
+auto operator delete(void* ptr, std::align_val_t alignment) noexcept -> void {
+    release(ptr, alignment);
+}
+
+auto operator delete[](void* ptr, std::align_val_t alignment) noexcept -> void {
+    release(ptr, alignment);
+}
+
+auto operator delete(void* ptr, std::size_t, std::align_val_t alignment) noexcept -> void {
+    release(ptr, alignment);
+}
+
+auto operator delete[](void* ptr, std::size_t, std::align_val_t alignment) noexcept -> void {
+    release(ptr, alignment);
+}
+
+auto operator delete(void* ptr, const std::nothrow_t&) noexcept -> void {
+    release(ptr, kDefaultAlignment);
+}
+
+auto operator delete[](void* ptr, const std::nothrow_t&) noexcept -> void {
+    release(ptr, kDefaultAlignment);
+}
+
+auto operator delete(void* ptr, std::align_val_t alignment, const std::nothrow_t&) noexcept -> void {
+    release(ptr, alignment);
+}
+
+auto operator delete[](void* ptr, std::align_val_t alignment, const std::nothrow_t&) noexcept -> void {
+    release(ptr, alignment);
+}
\ No newline at end of file
@@ -0,0 +1,70 @@
+/*
+===========================================================================
+  VGLX https://vglx.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#include "vglx/utilities/allocation_tracker.hpp"
+
+#include <atomic>
+
+namespace vglx {
+
+namespace {
+
+std::atomic<bool> installed {false};
+std::atomic<bool> recording {false};
+
+// Shared by every thread, so only touched while recording.
+std::atomic<uint64_t> total_allocations {0};
+std::atomic<uint64_t> total_bytes {0};
+
+// Trivial so that reading it from inside operator new never runs a
+// constructor or registers a destructor.
+thread_local constinit auto thread_counts = AllocationTracker::Counts {};
+
+}
+
+auto AllocationTracker::IsSupported() -> bool {
+    return installed.load(std::memory_order_relaxed);
+}
+
+auto AllocationTracker::Start() -> void {
+    recording.store(true, std::memory_order_relaxed);
+}
+
+auto AllocationTracker::Stop() -> void {
+    recording.store(false, std::memory_order_relaxed);
+}
+
+auto AllocationTracker::IsRecording() -> bool {
+    return recording.load(std::memory_order_relaxed);
+}
+
+auto AllocationTracker::ThreadCounts() -> Counts {
+    return thread_counts;
+}
+
+auto AllocationTracker::TotalCounts() -> Counts {
+    return {
+        total_allocations.load(std::memory_order_relaxed),
+        total_bytes.load(std::memory_order_relaxed)
+    };
+}
+
+auto AllocationTracker::Install() -> bool {
+    installed.store(true, std::memory_order_relaxed);
+    return true;
+}
+
+auto AllocationTracker::Record(std::size_t size) -> void {
+    if (recording.load(std::memory_order_relaxed)) {
+        ++thread_counts.allocations;
+        thread_counts.bytes += size;
+        total_allocations.fetch_add(1, std::memory_order_relaxed);
+        total_bytes.fetch_add(size, std::memory_order_relaxed);
+    }
+}
+
+}
\ No newline at end of file
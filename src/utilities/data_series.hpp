@@ -7,7 +7,6 @@
 
 #pragma once
 
-#include <algorithm>
 #include <array>
 #include <cassert>
 #include <concepts>
@@ -19,24 +18,39 @@ public:
     static_assert(N > 0, "DataSeries buffer size must be greater than 0");
 
     auto Push(const T value) {
-        if (count_ < N) {
-            buffer_[count_++] = value;
+        if (count_ == N) {
+            sum_ -= buffer_[head_];
         } else {
-            sum_ -= buffer_[0];
-            std::ranges::rotate(buffer_, buffer_.begin() + 1);
-            buffer_[N - 1] = value;
+            ++count_;
         }
+        buffer_[head_] = value;
+        head_ = (head_ + 1) % N;
         sum_ += value;
     }
 
     [[nodiscard]] auto LastValue() const {
-        return count_ > 0 ? buffer_[count_ - 1] : T {};
+        return count_ > 0 ? buffer_[(head_ + N - 1) % N] : T {};
     }
 
     [[nodiscard]] auto Average() const {
         return count_ > 0 ? sum_ / count_ : T {};
     }
 
+    [[nodiscard]] auto Size() const {
+        return count_;
+    }
+
+    // Index of the oldest value in the buffer.
+    [[nodiscard]] auto Offset() const -> size_t {
+        return count_ == N ? head_ : 0;
+    }
+
+    // Returns the i-th value, from oldest to newest.
+    [[nodiscard]] auto At(size_t i) const {
+        assert(i < count_);
+        return buffer_[(Offset() + i) % N];
+    }
+
     [[nodiscard]] auto Buffer() const -> const T* {
         return buffer_.data();
     }
@@ -47,4 +61,6 @@ private:
     T sum_ {0};
 
     size_t count_ {0};
+
+    size_t head_ {0};
 };
\ No newline at end of file
@@ -0,0 +1,57 @@
+/*
+===========================================================================
+  VGLX https://vglx.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <expected>
+#include <filesystem>
+#include <fstream>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace vglx {
+
+// Writes tightly packed, top-down RGBA8 pixels as an uncompressed TGA file.
+inline auto write_tga(
+    const std::filesystem::path& path,
+    int width,
+    int height,
+    std::span<const uint8_t> pixels
+) -> std::expected<void, std::string> {
+    auto file = std::ofstream {path, std::ios::binary};
+    if (!file) {
+        return std::unexpected("Unable to open file " + path.string());
+    }
+
+    const auto header = std::array<uint8_t, 18> {
+        0, 0, 2, // no id, no color map, uncompressed true-color
+        0, 0, 0, 0, 0,
+        0, 0, 0, 0, // origin
+        static_cast<uint8_t>(width & 0xFF), static_cast<uint8_t>(width >> 8),
+        static_cast<uint8_t>(height & 0xFF), static_cast<uint8_t>(height >> 8),
+        32, // bits per pixel
+        0x28 // 8 alpha bits, top-left origin
+    };
+    file.write(reinterpret_cast<const char*>(header.data()), header.size());
+
+    // TGA stores pixels as BGRA.
+    auto bgra = std::vector<uint8_t>(pixels.begin(), pixels.end());
+    for (size_t i = 0; i + 3 < bgra.size(); i += 4) {
+        std::swap(bgra[i], bgra[i + 2]);
+    }
+    file.write(reinterpret_cast<const char*>(bgra.data()), bgra.size());
+
+    if (!file) {
+        return std::unexpected("Failed to write file " + path.string());
+    }
+    return {};
+}
+
+}
\ No newline at end of file
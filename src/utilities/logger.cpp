@@ -7,11 +7,323 @@
 
 #include "utilities/logger.hpp"
 
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstdlib>
+#include <ctime>
+#include <iostream>
+#include <mutex>
+#include <thread>
+
 namespace vglx {
 
-namespace fs = std::filesystem;
+namespace {
+
+using SystemClock = std::chrono::system_clock;
+
+constexpr auto kSlotCount = size_t {2048};
+constexpr auto kSlotMask = kSlotCount - 1;
+constexpr auto kMaxSpan = size_t {64};
+
+static_assert((kSlotCount & kSlotMask) == 0, "The slot count must be a power of two");
+
+struct SlotHeader {
+    std::atomic<size_t> sequence;
+    const char* file;
+    SystemClock::rep time;
+    uint32_t line;
+    uint32_t length;
+    uint32_t span;
+    LogLevel level;
+};
+
+constexpr auto kSlotSize = size_t {256};
+constexpr auto kTextSize = kSlotSize - sizeof(SlotHeader);
+
+// A message occupies one slot, or a run of consecutive slots when it does
+// not fit; continuation slots only carry text.
+struct alignas(64) Slot : SlotHeader {
+    std::array<char, kTextSize> text;
+};
+
+static_assert(sizeof(Slot) == kSlotSize);
+
+auto file_name(std::string_view path) {
+    const auto separator = path.find_last_of("/\\");
+    return separator == std::string_view::npos ? path : path.substr(separator + 1);
+}
+
+}
+
+// Bounded multi-producer single-consumer ring. Producers claim slots with a
+// CAS on the enqueue position and publish them through the per-slot sequence
+// number, so logging never takes a lock. A single writer thread consumes the
+// slots in order, formats the lines and writes them to the standard streams.
+class LogWriter {
+public:
+    LogWriter() {
+        for (auto i = size_t {0}; i < kSlotCount; ++i) {
+            slots_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+        thread_ = std::thread([this] { Run(); });
+    }
+
+    [[nodiscard]] static auto Get() -> LogWriter& {
+        // Intentionally leaked so that logging stays valid during static
+        // destruction; the thread is stopped by an exit handler instead.
+        static auto* writer = [] {
+            auto* instance = new LogWriter();
+            std::atexit([] { Get().Shutdown(); });
+            return instance;
+        }();
+        return *writer;
+    }
+
+    auto Enqueue(LogLevel level, std::string_view message, const std::source_location& loc) -> void {
+        if (!running_.load(std::memory_order_acquire)) {
+            WriteDirect(level, message, loc);
+            return;
+        }
+
+        const auto span = std::clamp<size_t>((message.size() + kTextSize - 1) / kTextSize, 1, kMaxSpan);
+        const auto length = std::min(message.size(), span * kTextSize);
+
+        auto pos = enqueue_.load(std::memory_order_relaxed);
+        for (;;) {
+            // Slots are released in order, so the last slot of the run being
+            // free implies the whole run is.
+            const auto last = pos + span - 1;
+            const auto sequence = slots_[last & kSlotMask].sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(last);
+            if (diff == 0) {
+                if (enqueue_.compare_exchange_weak(pos, pos + span, std::memory_order_relaxed)) break;
+            } else if (diff < 0) {
+                dropped_.fetch_add(1, std::memory_order_relaxed);
+                return;
+            } else {
+                pos = enqueue_.load(std::memory_order_relaxed);
+            }
+        }
+
+        for (auto i = size_t {0}; i < span; ++i) {
+            const auto offset = i * kTextSize;
+            const auto count = std::min(kTextSize, length - offset);
+            std::copy_n(message.data() + offset, count, slots_[(pos + i) & kSlotMask].text.data());
+        }
+
+        auto& head = slots_[pos & kSlotMask];
+        head.file = loc.file_name();
+        head.time = SystemClock::now().time_since_epoch().count();
+        head.line = loc.line();
+        head.length = static_cast<uint32_t>(length);
+        head.span = static_cast<uint32_t>(span);
+        head.level = level;
+        head.sequence.store(pos + 1, std::memory_order_release);
+
+        Wake();
+    }
+
+    auto Flush() -> void {
+        if (!running_.load(std::memory_order_acquire)) return;
+
+        const auto target = enqueue_.load(std::memory_order_acquire);
+        Wake();
+        for (auto written = written_.load(std::memory_order_acquire); written < target;) {
+            written_.wait(written, std::memory_order_acquire);
+            written = written_.load(std::memory_order_acquire);
+        }
+    }
+
+    [[nodiscard]] auto Dropped() const -> size_t {
+        return dropped_total_.load(std::memory_order_relaxed);
+    }
+
+private:
+    std::array<Slot, kSlotCount> slots_;
+
+    alignas(64) std::atomic<size_t> enqueue_ {0};
+
+    alignas(64) std::atomic<uint32_t> signal_ {0};
+
+    alignas(64) std::atomic<size_t> written_ {0};
+
+    std::atomic<size_t> dropped_ {0};
+
+    std::atomic<size_t> dropped_total_ {0};
+
+    std::atomic<bool> running_ {true};
 
-std::mutex Logger::mutex_;
+    std::mutex direct_mutex_;
+
+    std::thread thread_;
+
+    size_t dequeue_ {0};
+
+    std::string out_;
+
+    std::string err_;
+
+    std::time_t cached_second_ {-1};
+
+    std::string cached_timestamp_;
+
+    auto Wake() -> void {
+        signal_.fetch_add(1, std::memory_order_release);
+        signal_.notify_one();
+    }
+
+    auto Run() -> void {
+        for (;;) {
+            const auto signal = signal_.load(std::memory_order_acquire);
+            const auto stopping = !running_.load(std::memory_order_acquire);
+            if (!Drain() && !stopping) {
+                signal_.wait(signal, std::memory_order_acquire);
+            }
+            if (stopping) break;
+        }
+    }
+
+    auto Drain() -> bool {
+        auto consumed = false;
+        for (;;) {
+            auto& head = slots_[dequeue_ & kSlotMask];
+            if (head.sequence.load(std::memory_order_acquire) != dequeue_ + 1) break;
+
+            const auto span = size_t {head.span};
+            auto message = std::string {};
+            message.reserve(head.length);
+            for (auto i = size_t {0}; i < span; ++i) {
+                const auto offset = i * kTextSize;
+                const auto count = std::min<size_t>(kTextSize, head.length - offset);
+                message.append(slots_[(dequeue_ + i) & kSlotMask].text.data(), count);
+            }
+
+            Format(
+                head.level == LogLevel::Error ? err_ : out_,
+                head.level,
+                message,
+                head.file,
+                head.line,
+                head.time
+            );
+
+            for (auto i = size_t {0}; i < span; ++i) {
+                slots_[(dequeue_ + i) & kSlotMask].sequence.store(
+                    dequeue_ + i + kSlotCount,
+                    std::memory_order_release
+                );
+            }
+            dequeue_ += span;
+            consumed = true;
+        }
+
+        if (const auto dropped = dropped_.exchange(0, std::memory_order_relaxed)) {
+            dropped_total_.fetch_add(dropped, std::memory_order_relaxed);
+            Format(
+                out_,
+                LogLevel::Warning,
+                std::format("Dropped {} log messages, the log queue was full", dropped),
+                __FILE__,
+                __LINE__,
+                SystemClock::now().time_since_epoch().count()
+            );
+        }
+
+        if (!out_.empty()) {
+            std::cout << out_ << std::flush;
+            out_.clear();
+        }
+        if (!err_.empty()) {
+            std::cerr << err_ << std::flush;
+            err_.clear();
+        }
+
+        if (consumed) {
+            written_.store(dequeue_, std::memory_order_release);
+            written_.notify_all();
+        }
+        return consumed;
+    }
+
+    auto Format(
+        std::string& out,
+        LogLevel level,
+        std::string_view message,
+        std::string_view file,
+        uint32_t line,
+        SystemClock::rep time
+    ) -> void {
+        std::format_to(
+            std::back_inserter(out),
+            "[{}]{}: {} -> {}:{}\n",
+            Timestamp(time),
+            Logger::ToString(level),
+            message,
+            file_name(file),
+            line
+        );
+    }
+
+    auto Timestamp(SystemClock::rep time) -> const std::string& {
+        const auto point = SystemClock::time_point {SystemClock::duration {time}};
+        const auto seconds = SystemClock::to_time_t(point);
+        if (seconds == cached_second_) return cached_timestamp_;
+
+        std::tm time_info {};
+#ifdef _WIN32
+        localtime_s(&time_info, &seconds);
+#else
+        localtime_r(&seconds, &time_info);
+#endif
+
+        cached_second_ = seconds;
+        cached_timestamp_ = std::format("{:04}-{:02}-{:02} {:02}:{:02}:{:02}",
+            time_info.tm_year + 1900,
+            time_info.tm_mon + 1,
+            time_info.tm_mday,
+            time_info.tm_hour,
+            time_info.tm_min,
+            time_info.tm_sec
+        );
+        return cached_timestamp_;
+    }
+
+    auto WriteDirect(LogLevel level, std::string_view message, const std::source_location& loc) -> void {
+        const auto lock = std::scoped_lock(direct_mutex_);
+        auto line = std::string {};
+        Format(
+            line,
+            level,
+            message,
+            loc.file_name(),
+            loc.line(),
+            SystemClock::now().time_since_epoch().count()
+        );
+        (level == LogLevel::Error ? std::cerr : std::cout) << line;
+    }
+
+    auto Shutdown() -> void {
+        running_.store(false, std::memory_order_release);
+        Wake();
+        if (thread_.joinable()) thread_.join();
+
+        const auto lock = std::scoped_lock(direct_mutex_);
+        Drain();
+    }
+};
+
+auto Logger::Enqueue(LogLevel level, std::string_view message, const std::source_location& loc) -> void {
+    LogWriter::Get().Enqueue(level, message, loc);
+}
+
+auto Logger::Flush() -> void {
+    LogWriter::Get().Flush();
+}
+
+auto Logger::DroppedMessages() -> size_t {
+    return LogWriter::Get().Dropped();
+}
 
 auto Logger::ToString(LogLevel level) -> std::string {
     using enum LogLevel;
@@ -8,19 +8,42 @@
 #pragma once
 
 #include "vglx/core/identity.hpp"
-#include "vglx/utilities/timer.hpp"
 
-#include <filesystem>
+#include <atomic>
+#include <chrono>
 #include <format>
-#include <iostream>
-#include <mutex>
+#include <iterator>
 #include <source_location>
 #include <string>
+#include <string_view>
+
+// Messages above this level are compiled out by VGLX_LOG and VGLX_LOG_EVERY,
+// and discarded before formatting by Logger::Log.
+// 0 = Error, 1 = Warning, 2 = Info, 3 = Debug.
+#ifndef VGLX_LOG_LEVEL
+#define VGLX_LOG_LEVEL 3
+#endif
+
+#define VGLX_LOG(level, ...) \
+    do { \
+        if constexpr (::vglx::Logger::IsEnabled(level)) { \
+            ::vglx::Logger::Log(level, __VA_ARGS__); \
+        } \
+    } while (false)
+
+// Logs at most once per interval from this call site.
+#define VGLX_LOG_EVERY(interval, level, ...) \
+    do { \
+        if constexpr (::vglx::Logger::IsEnabled(level)) { \
+            static auto vglx_log_limiter = ::vglx::LogRateLimiter {interval}; \
+            if (vglx_log_limiter.Allow()) { \
+                ::vglx::Logger::Log(level, __VA_ARGS__); \
+            } \
+        } \
+    } while (false)
 
 namespace vglx {
 
-namespace fs = std::filesystem;
-
 enum class LogLevel {
     Error,
     Warning,
@@ -38,25 +61,20 @@ public:
             Args&&... args,
             const std::source_location& loc = std::source_location::current()
         ) {
-            const auto lock = std::scoped_lock(mutex_);
-
-            auto stream = level == LogLevel::Error ? &std::cerr : &std::cout;
-            const auto& path = fs::path{loc.file_name()};
-            // std::format needs a compile-time string; std::vformat allows
-            // runtime strings using format args.
-            const auto message = std::vformat(
+            if (!Logger::IsEnabled(level)) return;
+
+            // Arguments are formatted on the calling thread since they may
+            // not outlive the call. The buffer keeps its capacity, so this
+            // does not allocate once warmed up.
+            thread_local auto buffer = std::string {};
+            buffer.clear();
+            std::vformat_to(
+                std::back_inserter(buffer),
                 format_str,
                 std::make_format_args(static_cast<const Args&>(args)...)
             );
 
-            *stream << std::format(
-                "[{}]{}: {} -> {}:{}\n",
-                Timer::GetTimestamp(),
-                Logger::ToString(level),
-                message,
-                path.filename().string(),
-                loc.line()
-            );
+            Logger::Enqueue(level, buffer, loc);
         }
 
         Log(
@@ -72,10 +90,42 @@ public:
     template <typename... Args>
     Log(std::string_view message, Args&&...) -> Log<Args...>;
 
+    [[nodiscard]] static constexpr auto IsEnabled(LogLevel level) -> bool {
+        return static_cast<int>(level) <= VGLX_LOG_LEVEL;
+    }
+
+    static auto Flush() -> void;
+
+    [[nodiscard]] static auto DroppedMessages() -> size_t;
+
 private:
-    static std::mutex mutex_;
+    static auto Enqueue(
+        LogLevel level,
+        std::string_view message,
+        const std::source_location& loc
+    ) -> void;
 
     [[nodiscard]] static auto ToString(LogLevel level) -> std::string;
+
+    friend class LogWriter;
+};
+
+class LogRateLimiter {
+public:
+    explicit LogRateLimiter(std::chrono::steady_clock::duration interval)
+      : interval_(interval.count()) {}
+
+    [[nodiscard]] auto Allow() -> bool {
+        const auto now = std::chrono::steady_clock::now().time_since_epoch().count();
+        auto next = next_.load(std::memory_order_relaxed);
+        if (now < next) return false;
+        return next_.compare_exchange_strong(next, now + interval_, std::memory_order_relaxed);
+    }
+
+private:
+    std::chrono::steady_clock::rep interval_;
+
+    std::atomic<std::chrono::steady_clock::rep> next_ {0};
 };
 
 }
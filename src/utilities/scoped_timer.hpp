@@ -33,11 +33,11 @@ public:
             const auto delta = end - start_;
             if (unit_ == Unit::Microseconds) {
                 const auto duration = std::chrono::duration_cast<std::chrono::microseconds>(delta);
-                Logger::Log(LogLevel::Debug, "{}: {} µs", label_, duration.count());
+                VGLX_LOG(LogLevel::Debug, "{}: {} µs", label_, duration.count());
             }
             if (unit_ == Unit::Milliseconds) {
                 const auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(delta);
-                Logger::Log(LogLevel::Debug, "{}: {} ms", label_, duration.count());
+                VGLX_LOG(LogLevel::Debug, "{}: {} ms", label_, duration.count());
             }
         }
     }
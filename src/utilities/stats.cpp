@@ -11,6 +11,11 @@
 
 #include "utilities/data_series.hpp"
 
+#include <algorithm>
+#include <cmath>
+#include <utility>
+#include <vector>
+
 #ifdef VGLX_USE_IMGUI
 #include <imgui/imgui.h>
 #endif
@@ -19,12 +24,26 @@ namespace vglx {
 
 static const float kContainerWidth {250.0f};
 static const float kContainerHeight {215.0f};
+static const float kProfilerHeight {390.0f};
+
+using History = DataSeries<double, Stats::kHistorySize>;
 
 struct Stats::Impl {
     DataSeries<float, 150> fps_series;
     DataSeries<float, 150> frame_time_series;
     DataSeries<float, 150> rendered_objects_series;
 
+    History frame_time_history;
+    std::array<History, FrameProfile::kPhaseCount> phase_history;
+    std::array<History, FrameProfile::kPhaseCount> phase_allocation_history;
+    std::array<History, FrameProfile::kCounterCount> counter_history;
+    std::array<History, FrameProfile::kGpuPassCount> gpu_history;
+
+    FrameProfile last_profile;
+
+    // Scratch space for percentiles, reused to avoid allocating per query.
+    mutable std::vector<double> window;
+
     Timer timer {true};
 
     double last_flush = 0.0;
@@ -35,11 +54,16 @@ struct Stats::Impl {
     unsigned frame_count = 0;
 
     Impl() {
-        last_flush = timer.GetElapsedMilliseconds();
+        last_flush = Now();
+        window.reserve(Stats::kHistorySize);
+    }
+
+    auto Now() const -> double {
+        return timer.GetElapsedSeconds() * 1000.0;
     }
 
     auto Before() {
-        const auto now = timer.GetElapsedMilliseconds();
+        const auto now = Now();
 
         while (now - last_flush >= 1000.0) {
             fps_series.Push(static_cast<float>(frame_count));
@@ -54,9 +78,53 @@ struct Stats::Impl {
     }
 
     auto After(unsigned int n_objects) {
-        const auto frame_end = timer.GetElapsedMilliseconds();
+        const auto frame_end = Now();
         frame_time = frame_end - frame_start;
         last_objects = n_objects;
+        frame_time_history.Push(frame_time);
+    }
+
+    auto Record(const FrameProfile& profile) {
+        for (auto i = size_t {0}; i < phase_history.size(); ++i) {
+            phase_history[i].Push(profile.phase_ms[i]);
+            phase_allocation_history[i].Push(static_cast<double>(profile.phase_allocations[i]));
+        }
+        for (auto i = size_t {0}; i < counter_history.size(); ++i) {
+            counter_history[i].Push(static_cast<double>(profile.counters[i]));
+        }
+        if (profile.gpu_latency > 0) {
+            for (auto i = size_t {0}; i < gpu_history.size(); ++i) {
+                gpu_history[i].Push(profile.gpu_ms[i]);
+            }
+        }
+        last_profile = profile;
+    }
+
+    auto Summarize(const History& history, size_t frames) const -> Stats::Summary {
+        const auto count = std::min(frames, history.Size());
+        if (count == 0) return {};
+
+        window.clear();
+        for (auto i = history.Size() - count; i < history.Size(); ++i) {
+            window.emplace_back(history.At(i));
+        }
+
+        auto summary = Stats::Summary {.frames = count};
+        auto total = 0.0;
+        summary.min = window.front();
+        for (const auto value : window) {
+            summary.min = std::min(summary.min, value);
+            total += value;
+        }
+        summary.avg = total / static_cast<double>(count);
+
+        // Nearest-rank percentile.
+        const auto rank = static_cast<size_t>(std::ceil(0.99 * static_cast<double>(count)));
+        const auto nth = window.begin() + (rank - 1);
+        std::ranges::nth_element(window, nth);
+        summary.p99 = *nth;
+
+        return summary;
     }
 };
 
@@ -70,11 +138,40 @@ auto Stats::AfterRender(unsigned int n_objects) -> void {
     impl_->After(n_objects);
 }
 
+auto Stats::AfterRender(unsigned n_objects, const FrameProfile& profile) -> void {
+    impl_->After(n_objects);
+    impl_->Record(profile);
+}
+
+auto Stats::FrameTime(size_t window) const -> Summary {
+    return impl_->Summarize(impl_->frame_time_history, window);
+}
+
+auto Stats::Query(ProfilePhase phase, size_t window) const -> Summary {
+    return impl_->Summarize(impl_->phase_history[std::to_underlying(phase)], window);
+}
+
+auto Stats::QueryAllocations(ProfilePhase phase, size_t window) const -> Summary {
+    return impl_->Summarize(impl_->phase_allocation_history[std::to_underlying(phase)], window);
+}
+
+auto Stats::Query(GpuPass pass, size_t window) const -> Summary {
+    return impl_->Summarize(impl_->gpu_history[std::to_underlying(pass)], window);
+}
+
+auto Stats::Query(ProfileCounter counter, size_t window) const -> Summary {
+    return impl_->Summarize(impl_->counter_history[std::to_underlying(counter)], window);
+}
+
+auto Stats::LastProfile() const -> const FrameProfile& {
+    return impl_->last_profile;
+}
+
 auto Stats::Draw() const -> void {
 #ifdef VGLX_USE_IMGUI
     const auto window_width = ImGui::GetIO().DisplaySize.x;
 
-    ImGui::SetNextWindowSize({kContainerWidth, kContainerHeight});
+    ImGui::SetNextWindowSize({kContainerWidth, kContainerHeight + kProfilerHeight});
     ImGui::SetNextWindowPos({window_width - kContainerWidth - 10.0f, 10.0f});
     ImGui::Begin("Stats", nullptr,
         ImGuiWindowFlags_NoResize |
@@ -86,7 +183,7 @@ auto Stats::Draw() const -> void {
     ImGui::Text("FPS: %.0f", impl_->fps_series.LastValue());
     ImGui::PlotHistogram(
         "##FPS",
-        impl_->fps_series.Buffer(), 150, 0, nullptr, 0.0f, 120.0f, {235, 40}
+        impl_->fps_series.Buffer(), 150, impl_->fps_series.Offset(), nullptr, 0.0f, 120.0f, {235, 40}
     );
     ImGui::PopStyleColor();
 
@@ -95,7 +192,7 @@ auto Stats::Draw() const -> void {
     ImGui::Text("Frame Time: %.0fms", impl_->frame_time_series.LastValue());
     ImGui::PlotHistogram(
         "##Frame Time",
-        impl_->frame_time_series.Buffer(), 150, 0, nullptr, 0.0f, 10.0f, {235, 40}
+        impl_->frame_time_series.Buffer(), 150, impl_->frame_time_series.Offset(), nullptr, 0.0f, 10.0f, {235, 40}
     );
     ImGui::PopStyleColor();
 
@@ -104,10 +201,48 @@ auto Stats::Draw() const -> void {
     ImGui::Text("Rendered objects: %.0f", impl_->rendered_objects_series.LastValue());
     ImGui::PlotHistogram(
         "##Rendered Objects",
-        impl_->rendered_objects_series.Buffer(), 150, 0, nullptr, 0.0f, 1000.0f, {235, 40}
+        impl_->rendered_objects_series.Buffer(), 150, impl_->rendered_objects_series.Offset(), nullptr, 0.0f, 1000.0f, {235, 40}
     );
     ImGui::PopStyleColor();
 
+    // CPU phases and their allocations, averaged over the last second at 60 fps
+    ImGui::SeparatorText("CPU (avg ms, allocs)");
+    for (auto i = 0; i < FrameProfile::kPhaseCount; ++i) {
+        const auto phase = static_cast<ProfilePhase>(i);
+        const auto name = GetName(phase);
+        ImGui::Text(
+            "%-18.*s %.3f %6.0f",
+            static_cast<int>(name.size()),
+            name.data(),
+            Query(phase, 60).avg,
+            QueryAllocations(phase, 60).avg
+        );
+    }
+
+    // GPU passes, averaged over the last 60 timed frames
+    ImGui::SeparatorText("GPU (avg ms)");
+    for (auto i = 0; i < FrameProfile::kGpuPassCount; ++i) {
+        const auto pass = static_cast<GpuPass>(i);
+        const auto name = GetName(pass);
+        ImGui::Text("%-18.*s %.3f", static_cast<int>(name.size()), name.data(), Query(pass, 60).avg);
+    }
+    if (const auto saved = impl_->last_profile.depth_prepass_saved_ms; saved != 0.0) {
+        ImGui::Text("%-18s %.3f", "Pre-pass saved", saved);
+    }
+
+    // counters of the last frame
+    ImGui::SeparatorText("Last frame");
+    for (auto i = 0; i < FrameProfile::kCounterCount; ++i) {
+        const auto counter = static_cast<ProfileCounter>(i);
+        const auto name = GetName(counter);
+        ImGui::Text(
+            "%-18.*s %llu",
+            static_cast<int>(name.size()),
+            name.data(),
+            static_cast<unsigned long long>(impl_->last_profile[counter])
+        );
+    }
+
     ImGui::End();
 #endif
 }
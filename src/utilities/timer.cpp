@@ -21,7 +21,7 @@ Timer::Timer(bool auto_start) {
 
 auto Timer::Start() -> void {
     if (running_) {
-        Logger::Log(LogLevel::Warning, "The timer is already running");
+        VGLX_LOG(LogLevel::Warning, "The timer is already running");
         return;
     }
 
@@ -31,7 +31,7 @@ auto Timer::Start() -> void {
 
 auto Timer::GetElapsedMilliseconds() const -> double {
     if (!running_) {
-        Logger::Log(LogLevel::Warning, "The timer has not been started");
+        VGLX_LOG(LogLevel::Warning, "The timer has not been started");
         return 0.0;
     }
 
@@ -44,7 +44,7 @@ auto Timer::GetElapsedMilliseconds() const -> double {
 
 auto Timer::GetElapsedSeconds() const -> double {
     if (!running_) {
-        Logger::Log(LogLevel::Warning, "The timer has not been started");
+        VGLX_LOG(LogLevel::Warning, "The timer has not been started");
         return 0.0;
     }
 
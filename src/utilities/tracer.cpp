@@ -0,0 +1,209 @@
+/*
+===========================================================================
+  VGLX https://vglx.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#include "vglx/utilities/tracer.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <format>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace vglx {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+struct TraceEvent {
+    const char* name;
+    int64_t start;
+    int64_t end;
+    uint32_t frame;
+};
+
+// Each thread appends to its own buffer. The mutex is only contended while a
+// trace is started or exported. Once full, the buffer is a ring whose oldest
+// event is at `next`.
+struct ThreadBuffer {
+    std::mutex mutex;
+    std::vector<TraceEvent> events;
+    size_t next {0};
+    std::string name;
+    uint32_t id;
+
+    auto Push(const TraceEvent& event) -> void {
+        if (events.size() < Tracer::kMaxEventsPerThread) {
+            events.emplace_back(event);
+            return;
+        }
+        events[next] = event;
+        next = (next + 1) % events.size();
+    }
+
+    auto Clear() -> void {
+        events.clear();
+        next = 0;
+    }
+};
+
+struct TraceState {
+    std::atomic<bool> recording {false};
+    std::atomic<uint32_t> frame {0};
+
+    // Buffers are kept for the lifetime of the process so that zones of
+    // threads that already exited can still be exported.
+    std::mutex mutex;
+    std::vector<std::unique_ptr<ThreadBuffer>> buffers;
+
+    Clock::time_point epoch {Clock::now()};
+};
+
+auto state() -> TraceState& {
+    static auto* instance = new TraceState();
+    return *instance;
+}
+
+auto thread_buffer() -> ThreadBuffer& {
+    thread_local ThreadBuffer* buffer = [] {
+        auto& s = state();
+        const auto lock = std::scoped_lock(s.mutex);
+        auto& b = s.buffers.emplace_back(std::make_unique<ThreadBuffer>());
+        b->id = static_cast<uint32_t>(s.buffers.size());
+        b->events.reserve(4096);
+        return b.get();
+    }();
+    return *buffer;
+}
+
+auto append_escaped(std::string& out, std::string_view value) {
+    for (const auto c : value) {
+        if (c == '"' || c == '\\') out.push_back('\\');
+        if (static_cast<unsigned char>(c) < 0x20) continue;
+        out.push_back(c);
+    }
+}
+
+}
+
+auto Tracer::Start() -> void {
+    auto& s = state();
+    {
+        const auto lock = std::scoped_lock(s.mutex);
+        for (auto& buffer : s.buffers) {
+            const auto buffer_lock = std::scoped_lock(buffer->mutex);
+            buffer->Clear();
+        }
+    }
+    s.recording.store(true, std::memory_order_release);
+}
+
+auto Tracer::Stop() -> void {
+    state().recording.store(false, std::memory_order_release);
+}
+
+auto Tracer::IsRecording() -> bool {
+    return state().recording.load(std::memory_order_relaxed);
+}
+
+auto Tracer::NextFrame() -> void {
+    state().frame.fetch_add(1, std::memory_order_relaxed);
+}
+
+auto Tracer::CurrentFrame() -> uint32_t {
+    return state().frame.load(std::memory_order_relaxed);
+}
+
+auto Tracer::SetThreadName(std::string_view name) -> void {
+    auto& buffer = thread_buffer();
+    const auto lock = std::scoped_lock(buffer.mutex);
+    buffer.name = name;
+}
+
+auto Tracer::Now() -> int64_t {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        Clock::now() - state().epoch
+    ).count();
+}
+
+auto Tracer::Record(const char* name, int64_t start, uint32_t frame) -> void {
+    const auto end = Now();
+    auto& buffer = thread_buffer();
+    const auto lock = std::scoped_lock(buffer.mutex);
+    buffer.Push(TraceEvent {name, start, end, frame});
+}
+
+auto Tracer::ToJson(uint32_t first_frame, uint32_t last_frame) -> std::string {
+    auto& s = state();
+    auto out = std::string {"{\"displayTimeUnit\":\"ms\",\"traceEvents\":["};
+    auto first = true;
+    const auto separator = [&] {
+        if (!first) out.push_back(',');
+        first = false;
+    };
+
+    const auto lock = std::scoped_lock(s.mutex);
+    for (const auto& buffer : s.buffers) {
+        const auto buffer_lock = std::scoped_lock(buffer->mutex);
+
+        if (!buffer->name.empty()) {
+            separator();
+            out += std::format(
+                "{{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":{},\"args\":{{\"name\":\"",
+                buffer->id
+            );
+            append_escaped(out, buffer->name);
+            out += "\"}}";
+        }
+
+        const auto& events = buffer->events;
+        for (auto i = size_t {0}; i < events.size(); ++i) {
+            const auto& event = events[(buffer->next + i) % events.size()];
+            if (event.frame < first_frame || event.frame > last_frame) continue;
+
+            separator();
+            out += "{\"name\":\"";
+            append_escaped(out, event.name);
+            // Timestamps are in microseconds.
+            std::format_to(
+                std::back_inserter(out),
+                "\",\"ph\":\"X\",\"pid\":1,\"tid\":{},\"ts\":{:.3f},\"dur\":{:.3f},\"args\":{{\"frame\":{}}}}}",
+                buffer->id,
+                static_cast<double>(event.start) / 1000.0,
+                static_cast<double>(event.end - event.start) / 1000.0,
+                event.frame
+            );
+        }
+    }
+
+    out += "]}";
+    return out;
+}
+
+auto Tracer::Export(
+    const std::filesystem::path& path,
+    uint32_t first_frame,
+    uint32_t last_frame
+) -> std::expected<void, std::string> {
+    auto file = std::ofstream {path, std::ios::binary};
+    if (!file) {
+        return std::unexpected(std::format("Unable to open trace file '{}'", path.string()));
+    }
+
+    const auto json = ToJson(first_frame, last_frame);
+    file.write(json.data(), static_cast<std::streamsize>(json.size()));
+    if (!file) {
+        return std::unexpected(std::format("Unable to write trace file '{}'", path.string()));
+    }
+
+    return {};
+}
+
+}
\ No newline at end of file
@@ -0,0 +1,181 @@
+/*
+===========================================================================
+  VGLX https://vglx.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#include <gtest/gtest.h>
+
+#include <vglx/core/job_system.hpp>
+#include <vglx/core/shared_context.hpp>
+#include <vglx/utilities/allocation_tracker.hpp>
+
+#include "scene_helpers.hpp"
+
+#include <memory>
+#include <numeric>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+// Stops the tracker when a test ends, even when an assertion returns early.
+struct ScopedTracking {
+    ScopedTracking() { vglx::AllocationTracker::Start(); }
+    ~ScopedTracking() { vglx::AllocationTracker::Stop(); }
+};
+
+// Updated every frame, on job system workers when `thread_safe` is set.
+class Spinner : public vglx::Node {
+public:
+    explicit Spinner(bool thread_safe) { update_thread_safe = thread_safe; }
+
+    auto OnUpdate(float delta) -> void override { RotateY(delta); }
+};
+
+}
+
+#pragma region Counting
+
+TEST(AllocationTracker, CountsAllocationsOnlyWhileRecording) {
+    if (!vglx::AllocationTracker::IsSupported()) {
+        GTEST_SKIP() << "Built without VGLX_ENABLE_ALLOCATION_TRACKING";
+    }
+
+    auto before = vglx::AllocationTracker::ThreadCounts();
+    auto ignored = std::make_unique<int>(1);
+    EXPECT_EQ((vglx::AllocationTracker::ThreadCounts() - before).allocations, 0);
+
+    vglx::AllocationTracker::Start();
+    EXPECT_TRUE(vglx::AllocationTracker::IsRecording());
+    before = vglx::AllocationTracker::ThreadCounts();
+    auto counted = std::make_unique<std::vector<int>>(16);
+    const auto counts = vglx::AllocationTracker::ThreadCounts() - before;
+    vglx::AllocationTracker::Stop();
+
+    EXPECT_FALSE(vglx::AllocationTracker::IsRecording());
+    EXPECT_EQ(counts.allocations, 2);
+    EXPECT_EQ(counts.bytes, sizeof(std::vector<int>) + 16 * sizeof(int));
+}
+
+TEST(AllocationTracker, TotalCountsIncludeOtherThreads) {
+    if (!vglx::AllocationTracker::IsSupported()) {
+        GTEST_SKIP() << "Built without VGLX_ENABLE_ALLOCATION_TRACKING";
+    }
+
+    auto tracking = ScopedTracking {};
+    const auto before = vglx::AllocationTracker::TotalCounts();
+    auto worker_counts = vglx::AllocationTracker::Counts {};
+    auto worker = std::thread {[&worker_counts] {
+        const auto start = vglx::AllocationTracker::ThreadCounts();
+        auto counted = std::make_unique<std::vector<int>>(16);
+        worker_counts = vglx::AllocationTracker::ThreadCounts() - start;
+    }};
+    worker.join();
+
+    EXPECT_EQ(worker_counts.allocations, 2);
+    EXPECT_GE((vglx::AllocationTracker::TotalCounts() - before).allocations, 2);
+}
+
+TEST(AllocationTracker, ReportsAllocationsInFrameProfile) {
+    if (!vglx::AllocationTracker::IsSupported()) {
+        GTEST_SKIP() << "Built without VGLX_ENABLE_ALLOCATION_TRACKING";
+    }
+
+    auto renderer = make_null_renderer(null_renderer_parameters(1920, 1080));
+    auto scene = make_scene(16, 0);
+    auto camera = make_camera();
+
+    auto tracking = ScopedTracking {};
+    // The first frame builds programs and uploads buffers.
+    renderer->Render(scene.get(), camera.get());
+
+    const auto& profile = renderer->GetFrameProfile();
+    EXPECT_GT(profile[vglx::ProfileCounter::Allocations], 0);
+    EXPECT_GT(profile[vglx::ProfileCounter::AllocatedBytes], 0);
+    const auto phases = std::accumulate(
+        profile.phase_allocations.begin(),
+        profile.phase_allocations.end(),
+        uint64_t {0}
+    );
+    EXPECT_LE(phases, profile[vglx::ProfileCounter::Allocations]);
+}
+
+#pragma endregion
+
+#pragma region Steady State
+
+class AllocationTrackerSteadyState : public ::testing::TestWithParam<int> {};
+
+TEST_P(AllocationTrackerSteadyState, FrameDoesNotAllocate) {
+    if (!vglx::AllocationTracker::IsSupported()) {
+        GTEST_SKIP() << "Built without VGLX_ENABLE_ALLOCATION_TRACKING";
+    }
+
+    auto renderer = make_null_renderer(null_renderer_parameters(1920, 1080));
+    auto scene = make_scene(1024, GetParam());
+    auto camera = make_camera();
+    for (auto i = 0; i < 512; ++i) {
+        scene->Add(std::make_shared<Spinner>(/* thread_safe = */ i % 4 != 0));
+    }
+
+    auto context = vglx::SharedContext {};
+    context.jobs = vglx::JobSystem::Create(4);
+    scene->SetContext(&context);
+    renderer->SetJobSystem(context.jobs);
+
+    // Let programs, buffers, work queues and per-frame containers reach
+    // their final size.
+    for (auto i = 0; i < 3; ++i) {
+        scene->Advance(0.016f);
+        renderer->Render(scene.get(), camera.get());
+    }
+
+    auto tracking = ScopedTracking {};
+    const auto before = vglx::AllocationTracker::TotalCounts();
+    scene->Advance(0.016f);
+    renderer->Render(scene.get(), camera.get());
+
+    EXPECT_EQ((vglx::AllocationTracker::TotalCounts() - before).allocations, 0);
+    const auto& profile = renderer->GetFrameProfile();
+    EXPECT_GT(profile[vglx::ProfileCounter::DrawCalls], 0);
+    EXPECT_EQ(profile[vglx::ProfileCounter::Allocations], 0);
+    for (auto i = size_t {0}; i < profile.phase_allocations.size(); ++i) {
+        EXPECT_EQ(profile.phase_allocations[i], 0)
+            << GetName(static_cast<vglx::ProfilePhase>(i));
+    }
+}
+
+TEST(AllocationTrackerSteadyState, ParallelForDoesNotAllocate) {
+    if (!vglx::AllocationTracker::IsSupported()) {
+        GTEST_SKIP() << "Built without VGLX_ENABLE_ALLOCATION_TRACKING";
+    }
+
+    auto jobs = vglx::JobSystem {4};
+    auto values = std::vector<int>(4096);
+    auto first = size_t {0};
+    auto second = size_t {0};
+    const auto scale = [&values, &first, &second](size_t begin, size_t end) {
+        for (auto i = begin; i < end; ++i) values[i] += static_cast<int>(first + second);
+    };
+
+    // Let the work queues reach their final size.
+    jobs.ParallelFor(values.size(), scale, 16);
+
+    auto tracking = ScopedTracking {};
+    const auto before = vglx::AllocationTracker::TotalCounts();
+    jobs.ParallelFor(values.size(), scale, 16);
+
+    EXPECT_EQ((vglx::AllocationTracker::TotalCounts() - before).allocations, 0);
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    BenchmarkScene,
+    AllocationTrackerSteadyState,
+    ::testing::Values(0, 8),
+    [](const auto& info) { return info.param ? std::string {"Fanout"} : std::string {"Flat"}; }
+);
+
+#pragma endregion
\ No newline at end of file
@@ -0,0 +1,154 @@
+/*
+===========================================================================
+  VGLX https://vglx.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#include <gtest/gtest.h>
+
+#include <vglx/core/application.hpp>
+#include <vglx/core/offscreen_context.hpp>
+#include <vglx/geometries/box_geometry.hpp>
+#include <vglx/materials/unlit_material.hpp>
+#include <vglx/nodes/mesh.hpp>
+#include <vglx/nodes/node.hpp>
+#include <vglx/nodes/scene.hpp>
+
+#include <memory>
+#include <vector>
+
+namespace {
+
+class UpdateCounter : public vglx::Node {
+public:
+    int update_calls {0};
+
+    float elapsed {0.0f};
+
+    auto OnUpdate(float delta) -> void override {
+        ++update_calls;
+        elapsed += delta;
+    }
+
+    static auto Create() {
+        return std::make_shared<UpdateCounter>();
+    }
+};
+
+class HeadlessApp : public vglx::Application {
+public:
+    Parameters params {
+        .mode = Mode::Headless,
+        .frame_limit = 10,
+        .simulated_delta = 0.5f
+    };
+
+    std::shared_ptr<UpdateCounter> counter = UpdateCounter::Create();
+
+    std::vector<float> deltas;
+
+    int stop_after {0};
+
+    auto Configure() -> Parameters override {
+        return params;
+    }
+
+    auto CreateScene() -> std::shared_ptr<vglx::Scene> override {
+        auto scene = vglx::Scene::Create();
+        auto mesh = vglx::Mesh::Create(
+            vglx::BoxGeometry::Create(),
+            vglx::UnlitMaterial::Create(0xFFFFFF)
+        );
+        mesh->transform.SetPosition({0.0f, 0.0f, -5.0f});
+        scene->Add(mesh);
+        scene->Add(counter);
+        return scene;
+    }
+
+    auto Update(float delta) -> bool override {
+        deltas.emplace_back(delta);
+        return stop_after == 0 || static_cast<int>(deltas.size()) < stop_after;
+    }
+};
+
+}
+
+#pragma region Headless Mode
+
+TEST(Application, HeadlessRunsFrameLimit) {
+    auto app = HeadlessApp {};
+    app.Start();
+
+    EXPECT_EQ(app.deltas, std::vector<float>(10, 0.5f));
+    EXPECT_EQ(app.counter->update_calls, 10);
+    EXPECT_FLOAT_EQ(app.counter->elapsed, 5.0f);
+}
+
+TEST(Application, HeadlessReportsFrameTimings) {
+    auto app = HeadlessApp {};
+    app.Start();
+
+    const auto& timings = app.GetFrameTimings();
+    ASSERT_EQ(timings.size(), 10);
+    for (const auto& timing : timings) {
+        EXPECT_FLOAT_EQ(timing.delta, 0.5f);
+        EXPECT_EQ(timing.rendered_objects, 1);
+        EXPECT_GE(timing.frame_ms, timing.update_ms + timing.render_ms);
+    }
+}
+
+TEST(Application, HeadlessStopsWhenUpdateReturnsFalse) {
+    auto app = HeadlessApp {};
+    app.stop_after = 3;
+    app.Start();
+
+    EXPECT_EQ(app.deltas.size(), 3);
+    EXPECT_EQ(app.GetFrameTimings().size(), 3);
+}
+
+TEST(Application, HeadlessWithFixedTimestep) {
+    auto app = HeadlessApp {};
+    app.params.fixed_timestep = 0.25f;
+    app.Start();
+
+    EXPECT_EQ(app.counter->update_calls, 20);
+    EXPECT_FLOAT_EQ(app.counter->elapsed, 5.0f);
+}
+
+#pragma endregion
+
+#pragma region Offscreen Mode
+
+TEST(Application, OffscreenRendersWithoutWindow) {
+    if (!vglx::OffscreenContext::IsSupported() || !vglx::OffscreenContext {}.Initialize()) {
+        GTEST_SKIP() << "No offscreen context available";
+    }
+
+    auto app = HeadlessApp {};
+    app.params.mode = vglx::Application::Mode::Offscreen;
+    app.params.frame_limit = 3;
+    app.Start();
+
+    ASSERT_NE(app.GetRenderer(), nullptr);
+    ASSERT_EQ(app.GetFrameTimings().size(), 3);
+    EXPECT_EQ(app.GetFrameTimings().back().rendered_objects, 1);
+}
+
+TEST(Application, OffscreenStopsWhenRendererFails) {
+    if (!vglx::OffscreenContext::IsSupported() || !vglx::OffscreenContext {}.Initialize()) {
+        GTEST_SKIP() << "No offscreen context available";
+    }
+
+    // The capture file cannot be opened, so renderer initialization fails.
+    auto app = HeadlessApp {};
+    app.params.mode = vglx::Application::Mode::Offscreen;
+    app.params.capture_path = "/nonexistent/vglx/capture.bin";
+    app.Start();
+
+    EXPECT_EQ(app.GetScene(), nullptr);
+    EXPECT_TRUE(app.deltas.empty());
+    EXPECT_TRUE(app.GetFrameTimings().empty());
+}
+
+#pragma endregion
\ No newline at end of file
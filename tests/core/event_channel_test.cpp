@@ -0,0 +1,150 @@
+/*
+===========================================================================
+  VGLX https://vglx.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include "events/event_channel.hpp"
+#include "utilities/logger.hpp"
+
+#include <vector>
+
+struct TestEvent : public vglx::Event {
+    int value {0};
+};
+
+using TestChannel = vglx::EventChannel<TestEvent>;
+
+class EventChannelTest : public ::testing::Test {
+protected:
+    void TearDown() override {
+        for (auto id : ids) TestChannel::Get().Unsubscribe(id);
+        ids.clear();
+    }
+
+    auto Subscribe(TestChannel::Listener listener) {
+        const auto id = TestChannel::Get().Subscribe(std::move(listener));
+        ids.emplace_back(id);
+        return id;
+    }
+
+    std::vector<vglx::ListenerId> ids;
+};
+
+#pragma region Event Listener Management
+
+TEST_F(EventChannelTest, Subscribe) {
+    auto calls = 0;
+    Subscribe([&calls](TestEvent&) { calls++; });
+
+    auto event = TestEvent {};
+    TestChannel::Get().Dispatch(event);
+
+    EXPECT_EQ(calls, 1);
+}
+
+TEST_F(EventChannelTest, Unsubscribe) {
+    auto calls = 0;
+    const auto id = TestChannel::Get().Subscribe([&calls](TestEvent&) { calls++; });
+    TestChannel::Get().Unsubscribe(id);
+
+    auto event = TestEvent {};
+    TestChannel::Get().Dispatch(event);
+
+    EXPECT_EQ(calls, 0);
+    EXPECT_EQ(TestChannel::Get().ListenerCount(), 0);
+}
+
+#pragma endregion
+
+#pragma region Event Dispatching
+
+TEST_F(EventChannelTest, DispatchToMultipleListenersInOrder) {
+    auto order = std::vector<int> {};
+    Subscribe([&order](TestEvent& e) { order.emplace_back(e.value); });
+    Subscribe([&order](TestEvent& e) { order.emplace_back(e.value * 10); });
+
+    auto event = TestEvent {};
+    event.value = 2;
+    TestChannel::Get().Dispatch(event);
+
+    EXPECT_THAT(order, ::testing::ElementsAre(2, 20));
+}
+
+TEST_F(EventChannelTest, ListenersCanMutateEvent) {
+    Subscribe([](TestEvent& e) { e.handled = true; });
+
+    auto event = TestEvent {};
+    TestChannel::Get().Dispatch(event);
+
+    EXPECT_TRUE(event.handled);
+}
+
+#pragma endregion
+
+#pragma region Edge Cases
+
+TEST_F(EventChannelTest, UnsubscribeDuringDispatch) {
+    auto calls = 0;
+    auto self = vglx::ListenerId {0};
+    self = TestChannel::Get().Subscribe([&](TestEvent&) {
+        calls++;
+        TestChannel::Get().Unsubscribe(self);
+    });
+
+    auto event = TestEvent {};
+    TestChannel::Get().Dispatch(event);
+    TestChannel::Get().Dispatch(event);
+
+    EXPECT_EQ(calls, 1);
+    EXPECT_EQ(TestChannel::Get().ListenerCount(), 0);
+}
+
+TEST_F(EventChannelTest, SubscribeDuringDispatchIsDeferred) {
+    auto outer_calls = 0;
+    auto inner_calls = 0;
+    Subscribe([&](TestEvent&) {
+        if (outer_calls++ == 0) {
+            Subscribe([&inner_calls](TestEvent&) { inner_calls++; });
+        }
+    });
+
+    auto event = TestEvent {};
+    TestChannel::Get().Dispatch(event);
+    EXPECT_EQ(inner_calls, 0);
+
+    TestChannel::Get().Dispatch(event);
+    EXPECT_EQ(inner_calls, 1);
+}
+
+TEST_F(EventChannelTest, NestedDispatch) {
+    auto calls = 0;
+    Subscribe([&calls](TestEvent& e) {
+        calls++;
+        if (e.value > 0) {
+            auto nested = TestEvent {};
+            TestChannel::Get().Dispatch(nested);
+        }
+    });
+
+    auto event = TestEvent {};
+    event.value = 1;
+    TestChannel::Get().Dispatch(event);
+
+    EXPECT_EQ(calls, 2);
+}
+
+TEST_F(EventChannelTest, UnsubscribeNonExistentListener) {
+    testing::internal::CaptureStdout();
+    TestChannel::Get().Unsubscribe(0xFFFF);
+    vglx::Logger::Flush();
+    auto output = testing::internal::GetCapturedStdout();
+
+    EXPECT_THAT(output, ::testing::HasSubstr("Attempting to remove"));
+}
+
+#pragma endregion
\ No newline at end of file
@@ -0,0 +1,114 @@
+/*
+===========================================================================
+  VGLX https://vglx.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#include <gtest/gtest.h>
+
+#include <vglx/utilities/fixed_timestep.hpp>
+
+#include <limits>
+#include <tuple>
+
+#pragma region Accumulation
+
+TEST(FixedTimestep, AccumulatesPartialSteps) {
+    auto timestep = vglx::FixedTimestep {0.1f};
+
+    EXPECT_EQ(timestep.Accumulate(0.04f), 0);
+    EXPECT_NEAR(timestep.Alpha(), 0.4f, 1e-5f);
+
+    EXPECT_EQ(timestep.Accumulate(0.04f), 0);
+    EXPECT_NEAR(timestep.Alpha(), 0.8f, 1e-5f);
+
+    EXPECT_EQ(timestep.Accumulate(0.04f), 1);
+    EXPECT_NEAR(timestep.Alpha(), 0.2f, 1e-5f);
+}
+
+TEST(FixedTimestep, RunsMultipleStepsPerFrame) {
+    auto timestep = vglx::FixedTimestep {0.01f};
+
+    EXPECT_EQ(timestep.Accumulate(0.035f), 3);
+    EXPECT_NEAR(timestep.Alpha(), 0.5f, 1e-4f);
+}
+
+TEST(FixedTimestep, KeepsTimeOverManyFrames) {
+    auto timestep = vglx::FixedTimestep {1.0f / 30.0f};
+
+    auto steps = 0;
+    for (auto i = 0; i < 144; ++i) {
+        steps += timestep.Accumulate(1.0f / 144.0f);
+    }
+
+    const auto simulated = (steps + timestep.Alpha()) * timestep.Step();
+    EXPECT_NEAR(simulated, 1.0f, 1e-4f);
+}
+
+TEST(FixedTimestep, IgnoresNegativeDelta) {
+    auto timestep = vglx::FixedTimestep {0.1f};
+
+    EXPECT_EQ(timestep.Accumulate(-1.0f), 0);
+    EXPECT_FLOAT_EQ(timestep.Alpha(), 0.0f);
+}
+
+TEST(FixedTimestep, IgnoresNonFiniteDelta) {
+    using limits = std::numeric_limits<float>;
+    auto timestep = vglx::FixedTimestep {0.1f};
+
+    for (auto delta : {limits::quiet_NaN(), limits::infinity()}) {
+        EXPECT_EQ(timestep.Accumulate(delta), 0);
+        EXPECT_FLOAT_EQ(timestep.Alpha(), 0.0f);
+    }
+
+    EXPECT_EQ(timestep.Accumulate(0.15f), 1);
+}
+
+#pragma endregion
+
+#pragma region Step Limit
+
+TEST(FixedTimestep, ClampsStepsPerFrame) {
+    auto timestep = vglx::FixedTimestep {0.01f, 4};
+
+    EXPECT_EQ(timestep.Accumulate(0.105f), 4);
+    EXPECT_LT(timestep.Alpha(), 1.0f);
+    EXPECT_EQ(timestep.Accumulate(0.0f), 0);
+}
+
+TEST(FixedTimestep, ClampsHugeDelta) {
+    auto timestep = vglx::FixedTimestep {vglx::FixedTimestep::kMinStep, 5};
+
+    EXPECT_EQ(timestep.Accumulate(1e6f), 5);
+    EXPECT_GE(timestep.Alpha(), 0.0f);
+    EXPECT_LT(timestep.Alpha(), 1.0f);
+    EXPECT_EQ(timestep.Accumulate(0.0f), 0);
+}
+
+TEST(FixedTimestep, ClampsMaxStepsToOne) {
+    auto timestep = vglx::FixedTimestep {0.01f, 0};
+
+    EXPECT_EQ(timestep.MaxSteps(), 1);
+    EXPECT_EQ(timestep.Accumulate(0.05f), 1);
+}
+
+TEST(FixedTimestep, ClampsStepToMinimum) {
+    for (auto step : {0.0f, -0.1f}) {
+        auto timestep = vglx::FixedTimestep {step, 3};
+
+        EXPECT_EQ(timestep.Step(), vglx::FixedTimestep::kMinStep);
+        EXPECT_EQ(timestep.Accumulate(1.0f), 3);
+    }
+}
+
+TEST(FixedTimestep, Reset) {
+    auto timestep = vglx::FixedTimestep {0.1f};
+
+    std::ignore = timestep.Accumulate(0.05f);
+    timestep.Reset();
+
+    EXPECT_FLOAT_EQ(timestep.Alpha(), 0.0f);
+}
+
+#pragma endregion
\ No newline at end of file
@@ -0,0 +1,92 @@
+/*
+===========================================================================
+  VGLX https://vglx.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#include <gtest/gtest.h>
+
+#include "core/frame_arena.hpp"
+
+#include <cstdint>
+#include <memory_resource>
+#include <string>
+#include <vector>
+
+#pragma region Linear Arena
+
+TEST(LinearArena, AllocatesAlignedMemory) {
+    auto arena = vglx::LinearArena {256};
+
+    auto a = arena.allocate(3, 1);
+    auto b = arena.allocate(16, 64);
+
+    EXPECT_NE(a, b);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(b) % 64, 0);
+    EXPECT_GE(arena.Used(), 19);
+}
+
+TEST(LinearArena, ResetReusesBlocks) {
+    auto arena = vglx::LinearArena {256};
+
+    const auto first = arena.allocate(128, 8);
+    const auto large = arena.allocate(512, 8);
+    ASSERT_NE(large, nullptr);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(large) % 8, 0);
+    const auto capacity = arena.Capacity();
+    EXPECT_GT(capacity, 256);
+
+    arena.Reset();
+    EXPECT_EQ(arena.Used(), 0);
+    EXPECT_EQ(arena.allocate(128, 8), first);
+    EXPECT_EQ(arena.allocate(512, 8), large);
+    EXPECT_EQ(arena.Capacity(), capacity);
+}
+
+TEST(LinearArena, BacksPmrContainers) {
+    auto arena = vglx::LinearArena {64};
+
+    auto values = std::pmr::vector<int> {&arena};
+    for (auto i = 0; i < 1000; ++i) values.push_back(i);
+    auto text = std::pmr::string {"a string long enough to leave the small buffer", &arena};
+
+    EXPECT_EQ(values.back(), 999);
+    EXPECT_EQ(text.size(), 46);
+    EXPECT_GE(arena.Used(), 1000 * sizeof(int) + text.size());
+}
+
+#pragma endregion
+
+#pragma region Frame Arena
+
+TEST(FrameArena, KeepsPreviousFrameValid) {
+    auto arena = vglx::FrameArena {};
+
+    arena.BeginFrame();
+    auto previous = std::pmr::vector<int> {{1, 2, 3}, arena.Resource()};
+
+    arena.BeginFrame();
+    auto current = std::pmr::vector<int> {{4, 5, 6}, arena.Resource()};
+
+    EXPECT_NE(previous.get_allocator(), current.get_allocator());
+    EXPECT_EQ(previous, (std::pmr::vector<int> {1, 2, 3}));
+    EXPECT_EQ(current, (std::pmr::vector<int> {4, 5, 6}));
+}
+
+TEST(FrameArena, RebindMovesVectorToCurrentFrame) {
+    auto arena = vglx::FrameArena {};
+
+    arena.BeginFrame();
+    auto values = std::pmr::vector<int> {arena.Resource()};
+    values.assign(100, 7);
+
+    arena.BeginFrame();
+    vglx::rebind_vector(values, arena.Resource());
+
+    EXPECT_TRUE(values.empty());
+    EXPECT_GE(values.capacity(), 100);
+    EXPECT_EQ(values.get_allocator().resource(), arena.Resource());
+}
+
+#pragma endregion
\ No newline at end of file
@@ -0,0 +1,60 @@
+/*
+===========================================================================
+  VGLX https://vglx.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#include <gtest/gtest.h>
+
+#include <vglx/geometries/geometry.hpp>
+#include <vglx/materials/unlit_material.hpp>
+#include <vglx/nodes/node.hpp>
+
+#include <regex>
+#include <set>
+#include <string>
+
+#pragma region IDs
+
+TEST(Identity, AssignsIncreasingIds) {
+    auto a = vglx::Node::Create();
+    auto b = vglx::Geometry::Create();
+    auto c = vglx::UnlitMaterial::Create();
+
+    EXPECT_LT(a->Id(), b->Id());
+    EXPECT_LT(b->Id(), c->Id());
+}
+
+TEST(Identity, CopiesGetTheirOwnId) {
+    auto material = vglx::UnlitMaterial {0xFF0000};
+    material.SetName("red");
+
+    const auto copy = material;
+
+    EXPECT_NE(copy.Id(), material.Id());
+    EXPECT_EQ(copy.Name(), "red");
+}
+
+#pragma endregion
+
+#pragma region UUID
+
+TEST(Identity, UUIDIsStableAndWellFormed) {
+    static const auto format = std::regex {
+        "^[0-9a-f]{8}-[0-9a-f]{4}-4[0-9a-f]{3}-[89ab][0-9a-f]{3}-[0-9a-f]{12}$"
+    };
+    auto node = vglx::Node::Create();
+
+    EXPECT_TRUE(std::regex_match(node->UUID(), format));
+    EXPECT_EQ(node->UUID(), node->UUID());
+}
+
+TEST(Identity, UUIDsAreUnique) {
+    auto uuids = std::set<std::string> {};
+    for (auto i = 0; i < 10000; ++i) {
+        EXPECT_TRUE(uuids.emplace(vglx::Node::Create()->UUID()).second);
+    }
+}
+
+#pragma endregion
\ No newline at end of file
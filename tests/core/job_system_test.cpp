@@ -0,0 +1,202 @@
+/*
+===========================================================================
+  VGLX https://vglx.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <vglx/core/job_system.hpp>
+
+#include <atomic>
+#include <mutex>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+#pragma region Scheduling
+
+TEST(JobSystem, ScheduleRunsAllJobs) {
+    auto jobs = vglx::JobSystem {4};
+    auto counter = vglx::JobCounter {};
+    auto sum = std::atomic<int> {0};
+
+    for (auto i = 1; i <= 1000; ++i) {
+        jobs.Schedule([&sum, i] { sum += i; }, &counter);
+    }
+    jobs.Wait(counter);
+
+    EXPECT_TRUE(counter.Done());
+    EXPECT_EQ(sum.load(), 500500);
+}
+
+TEST(JobSystem, ScheduleWithoutWorkersRunsInline) {
+    auto jobs = vglx::JobSystem {0};
+    auto ran = false;
+
+    jobs.Schedule([&ran] { ran = true; });
+
+    EXPECT_EQ(jobs.WorkerCount(), 0);
+    EXPECT_TRUE(ran);
+}
+
+TEST(JobSystem, JobsCanScheduleAndWaitForNestedJobs) {
+    auto jobs = vglx::JobSystem {2};
+    auto outer = vglx::JobCounter {};
+    auto total = std::atomic<int> {0};
+
+    for (auto i = 0; i < 8; ++i) {
+        jobs.Schedule([&jobs, &total] {
+            auto inner = vglx::JobCounter {};
+            for (auto j = 0; j < 16; ++j) {
+                jobs.Schedule([&total] { total++; }, &inner);
+            }
+            jobs.Wait(inner);
+        }, &outer);
+    }
+    jobs.Wait(outer);
+
+    EXPECT_EQ(total.load(), 128);
+}
+
+TEST(JobSystem, DestructorDrainsPendingJobs) {
+    auto count = std::atomic<int> {0};
+    {
+        auto jobs = vglx::JobSystem {2};
+        for (auto i = 0; i < 100; ++i) {
+            jobs.Schedule([&count] { count++; });
+        }
+    }
+
+    EXPECT_EQ(count.load(), 100);
+}
+
+#pragma endregion
+
+#pragma region Dependencies
+
+TEST(JobSystem, ScheduleAfterWaitsForDependency) {
+    auto jobs = vglx::JobSystem {4};
+    auto first = vglx::JobCounter {};
+    auto second = vglx::JobCounter {};
+    auto produced = std::atomic<int> {0};
+    auto observed = -1;
+
+    for (auto i = 0; i < 64; ++i) {
+        jobs.Schedule([&produced] { produced++; }, &first);
+    }
+    jobs.ScheduleAfter(first, [&] { observed = produced.load(); }, &second);
+    jobs.Wait(second);
+
+    EXPECT_EQ(observed, 64);
+}
+
+TEST(JobSystem, ScheduleAfterCompletedDependency) {
+    auto jobs = vglx::JobSystem {2};
+    auto done = vglx::JobCounter {};
+    auto counter = vglx::JobCounter {};
+    auto ran = std::atomic<bool> {false};
+
+    jobs.ScheduleAfter(done, [&ran] { ran = true; }, &counter);
+    jobs.Wait(counter);
+
+    EXPECT_TRUE(ran.load());
+}
+
+TEST(JobSystem, ScheduleAfterChain) {
+    auto jobs = vglx::JobSystem {4};
+    auto stages = std::vector<int> {};
+    auto mutex = std::mutex {};
+    auto a = vglx::JobCounter {};
+    auto b = vglx::JobCounter {};
+    auto c = vglx::JobCounter {};
+
+    const auto record = [&](int stage) {
+        return [&, stage] {
+            auto lock = std::scoped_lock {mutex};
+            stages.emplace_back(stage);
+        };
+    };
+
+    jobs.Schedule(record(1), &a);
+    jobs.ScheduleAfter(a, record(2), &b);
+    jobs.ScheduleAfter(b, record(3), &c);
+    jobs.Wait(c);
+
+    EXPECT_THAT(stages, ::testing::ElementsAre(1, 2, 3));
+}
+
+#pragma endregion
+
+#pragma region Parallel For
+
+TEST(JobSystem, ParallelForVisitsEveryIndexOnce) {
+    auto jobs = vglx::JobSystem {4};
+    auto visits = std::vector<std::atomic<int>>(10000);
+
+    jobs.ParallelFor(visits.size(), [&visits](size_t begin, size_t end) {
+        for (auto i = begin; i < end; ++i) visits[i]++;
+    }, 16);
+
+    for (const auto& v : visits) {
+        EXPECT_EQ(v.load(), 1);
+    }
+}
+
+TEST(JobSystem, ParallelForEmptyRange) {
+    auto jobs = vglx::JobSystem {2};
+    auto calls = 0;
+
+    jobs.ParallelFor(0, [&calls](size_t, size_t) { calls++; });
+
+    EXPECT_EQ(calls, 0);
+}
+
+TEST(JobSystem, ParallelForProducesSameResultAsSerial) {
+    auto jobs = vglx::JobSystem {3};
+    auto values = std::vector<int>(4096);
+    std::iota(values.begin(), values.end(), 0);
+
+    jobs.ParallelFor(values.size(), [&values](size_t begin, size_t end) {
+        for (auto i = begin; i < end; ++i) values[i] *= 2;
+    });
+
+    auto expected = std::vector<int>(4096);
+    for (auto i = 0; i < 4096; ++i) expected[i] = i * 2;
+    EXPECT_EQ(values, expected);
+}
+
+#pragma endregion
+
+#pragma region Main Thread Affinity
+
+TEST(JobSystem, MainThreadJobsRunOnCreatingThread) {
+    auto jobs = vglx::JobSystem {2};
+    auto counter = vglx::JobCounter {};
+    auto thread = std::thread::id {};
+
+    jobs.Schedule([&] {
+        jobs.ScheduleOnMainThread([&thread] { thread = std::this_thread::get_id(); }, &counter);
+    });
+
+    while (counter.Done()) std::this_thread::yield();
+    jobs.RunMainThreadJobs();
+
+    EXPECT_TRUE(counter.Done());
+    EXPECT_EQ(thread, std::this_thread::get_id());
+}
+
+TEST(JobSystem, WaitOnMainThreadRunsMainThreadJobs) {
+    auto jobs = vglx::JobSystem {2};
+    auto counter = vglx::JobCounter {};
+    auto ran = false;
+
+    jobs.ScheduleOnMainThread([&ran] { ran = true; }, &counter);
+    jobs.Wait(counter);
+
+    EXPECT_TRUE(ran);
+}
+
+#pragma endregion
\ No newline at end of file
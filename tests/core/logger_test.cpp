@@ -10,7 +10,10 @@
 
 #include <utilities/logger.hpp>
 
+#include <chrono>
 #include <string>
+#include <thread>
+#include <vector>
 
 using namespace std::string_literals;
 
@@ -19,6 +22,7 @@ using namespace std::string_literals;
 TEST(Logger, LogInfo) {
     testing::internal::CaptureStdout();
     vglx::Logger::Log(vglx::LogLevel::Info, "info");
+    vglx::Logger::Flush();
     auto output = testing::internal::GetCapturedStdout();
 
     EXPECT_THAT(output, ::testing::HasSubstr("\x1B[1;34m[Info]\x1B[0m: info"));
@@ -27,6 +31,7 @@ TEST(Logger, LogInfo) {
 TEST(Logger, LogWarning) {
     testing::internal::CaptureStdout();
     vglx::Logger::Log(vglx::LogLevel::Warning, "warning");
+    vglx::Logger::Flush();
     auto output = testing::internal::GetCapturedStdout();
 
     EXPECT_THAT(output, ::testing::HasSubstr("\x1B[1;33m[Warning]\x1B[0m: warning"));
@@ -35,6 +40,7 @@ TEST(Logger, LogWarning) {
 TEST(Logger, LogError) {
     testing::internal::CaptureStderr();
     vglx::Logger::Log(vglx::LogLevel::Error, "error");
+    vglx::Logger::Flush();
     auto output = testing::internal::GetCapturedStderr();
 
     EXPECT_THAT(output, ::testing::HasSubstr("\x1B[1;31m[Error]\x1B[0m: error"));
@@ -43,6 +49,7 @@ TEST(Logger, LogError) {
 TEST(Logger, LogDebug) {
     testing::internal::CaptureStdout();
     vglx::Logger::Log(vglx::LogLevel::Debug, "debug");
+    vglx::Logger::Flush();
     auto output = testing::internal::GetCapturedStdout();
 
     EXPECT_THAT(output, ::testing::HasSubstr("\x1B[1;35m[Debug]\x1B[0m: debug"));
@@ -57,6 +64,7 @@ TEST(Logger, StringFormatting) {
 
     auto version = "OpenGL ES 3.2 NVIDIA 560.94 initialized"s;
     vglx::Logger::Log(vglx::LogLevel::Info, "version {}", version);
+    vglx::Logger::Flush();
 
     auto output = testing::internal::GetCapturedStdout();
     EXPECT_THAT(output, ::testing::HasSubstr(
@@ -64,4 +72,82 @@ TEST(Logger, StringFormatting) {
     );
 }
 
+#pragma endregion
+
+#pragma region Asynchronous writer
+
+TEST(Logger, LongMessageSpansSlots) {
+    testing::internal::CaptureStdout();
+
+    auto message = std::string(2000, 'x') + "end";
+    vglx::Logger::Log(vglx::LogLevel::Info, "{}", message);
+    vglx::Logger::Flush();
+
+    auto output = testing::internal::GetCapturedStdout();
+    EXPECT_THAT(output, ::testing::HasSubstr(message));
+}
+
+TEST(Logger, ConcurrentProducersKeepPerThreadOrder) {
+    constexpr auto kThreads = 4;
+    constexpr auto kMessages = 200;
+
+    testing::internal::CaptureStdout();
+
+    auto threads = std::vector<std::thread> {};
+    for (auto t = 0; t < kThreads; ++t) {
+        threads.emplace_back([t] {
+            for (auto i = 0; i < kMessages; ++i) {
+                vglx::Logger::Log(vglx::LogLevel::Info, "thread {} message {};", t, i);
+            }
+        });
+    }
+    for (auto& thread : threads) thread.join();
+    vglx::Logger::Flush();
+
+    auto output = testing::internal::GetCapturedStdout();
+    for (auto t = 0; t < kThreads; ++t) {
+        auto last = std::string::size_type {0};
+        for (auto i = 0; i < kMessages; ++i) {
+            const auto pos = output.find(std::format("thread {} message {};", t, i));
+            ASSERT_NE(pos, std::string::npos);
+            EXPECT_GE(pos, last);
+            last = pos;
+        }
+    }
+}
+
+#pragma endregion
+
+#pragma region Filtering
+
+TEST(Logger, LevelsUpToCompileTimeMinimumAreEnabled) {
+    static_assert(vglx::Logger::IsEnabled(vglx::LogLevel::Error));
+    EXPECT_EQ(
+        vglx::Logger::IsEnabled(vglx::LogLevel::Debug),
+        VGLX_LOG_LEVEL >= static_cast<int>(vglx::LogLevel::Debug)
+    );
+}
+
+TEST(Logger, RateLimitedCallSiteLogsOncePerInterval) {
+    testing::internal::CaptureStdout();
+
+    for (auto i = 0; i < 10; ++i) {
+        VGLX_LOG_EVERY(std::chrono::hours(1), vglx::LogLevel::Warning, "limited {}", i);
+    }
+    vglx::Logger::Flush();
+
+    auto output = testing::internal::GetCapturedStdout();
+    EXPECT_THAT(output, ::testing::HasSubstr("limited 0"));
+    EXPECT_THAT(output, ::testing::Not(::testing::HasSubstr("limited 1")));
+}
+
+TEST(Logger, RateLimiterAllowsAgainAfterInterval) {
+    auto limiter = vglx::LogRateLimiter {std::chrono::milliseconds(5)};
+
+    EXPECT_TRUE(limiter.Allow());
+    EXPECT_FALSE(limiter.Allow());
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    EXPECT_TRUE(limiter.Allow());
+}
+
 #pragma endregion
\ No newline at end of file
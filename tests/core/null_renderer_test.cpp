@@ -0,0 +1,389 @@
+/*
+===========================================================================
+  VGLX https://vglx.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#include <gtest/gtest.h>
+
+#include <vglx/cameras/perspective_camera.hpp>
+#include <vglx/core/render_commands.hpp>
+#include <vglx/core/renderer.hpp>
+#include <vglx/geometries/box_geometry.hpp>
+#include <vglx/materials/phong_material.hpp>
+#include <vglx/materials/shader_material.hpp>
+#include <vglx/materials/unlit_material.hpp>
+#include <vglx/nodes/mesh.hpp>
+#include <vglx/nodes/scene.hpp>
+#include <vglx/textures/texture_2d.hpp>
+
+#include "core/visibility_history.hpp"
+#include "scene_helpers.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace {
+
+using Command = vglx::RenderCommandType;
+
+struct Frame {
+    std::shared_ptr<vglx::Scene> scene;
+    std::shared_ptr<vglx::Camera> camera;
+};
+
+// Two boxes sharing a geometry and a material, in front of the camera.
+auto make_frame() {
+    auto scene = vglx::Scene::Create();
+    auto geometry = vglx::BoxGeometry::Create();
+    auto material = vglx::UnlitMaterial::Create(0xFFFFFF);
+    for (auto x : {-1.0f, 1.0f}) {
+        auto mesh = vglx::Mesh::Create(geometry, material);
+        mesh->transform.SetPosition({x, 0.0f, -5.0f});
+        scene->Add(mesh);
+    }
+    auto camera = vglx::PerspectiveCamera::Create({
+        .fov = 1.0f,
+        .aspect = 2.0f,
+        .near = 0.1f,
+        .far = 100.0f
+    });
+    return Frame {scene, camera};
+}
+
+}
+
+#pragma region Recording
+
+TEST(NullRendererTest, RecordsFrameWithoutContext) {
+    auto renderer = make_null_renderer();
+    auto frame = make_frame();
+    renderer->Render(frame.scene.get(), frame.camera.get());
+
+    const auto stream = renderer->GetCommandStream();
+    ASSERT_NE(stream, nullptr);
+    EXPECT_EQ(stream->Count(Command::Clear), 1);
+    EXPECT_EQ(stream->Count(Command::Draw), 2);
+    EXPECT_EQ(stream->Count(Command::CreateProgram), 1);
+    EXPECT_EQ(stream->Count(Command::UseProgram), 1);
+    EXPECT_EQ(stream->Count(Command::CreateVertexArray), 1);
+
+    const auto& profile = renderer->GetFrameProfile();
+    EXPECT_EQ(profile[vglx::ProfileCounter::DrawCalls], stream->Count(Command::Draw));
+    EXPECT_EQ(profile[vglx::ProfileCounter::Triangles], 24);
+    EXPECT_EQ(renderer->RenderedObjectsPerFrame(), 2);
+}
+
+TEST(NullRendererTest, RepeatedFrameSkipsRedundantWork) {
+    auto renderer = make_null_renderer();
+    auto frame = make_frame();
+    renderer->Render(frame.scene.get(), frame.camera.get());
+    const auto first_uniforms = renderer->GetCommandStream()->Count(Command::SetUniform);
+
+    renderer->Render(frame.scene.get(), frame.camera.get());
+    const auto stream = renderer->GetCommandStream();
+
+    EXPECT_EQ(stream->Count(Command::Draw), 2);
+    EXPECT_EQ(stream->Count(Command::CreateProgram), 0);
+    EXPECT_EQ(stream->Count(Command::CreateBuffers), 0);
+    EXPECT_EQ(stream->Count(Command::BufferData), 0);
+    EXPECT_EQ(stream->Count(Command::UseProgram), 0);
+    EXPECT_EQ(stream->Count(Command::BindVertexArray), 0);
+    EXPECT_EQ(stream->Count(Command::BufferSubData), 0);
+
+    // Only the model matrix differs between the two draws.
+    EXPECT_EQ(stream->Count(Command::SetUniform), 2);
+    EXPECT_LT(stream->Count(Command::SetUniform), first_uniforms);
+}
+
+TEST(NullRendererTest, CullsInterpolatedPose) {
+    auto renderer = make_null_renderer();
+    auto frame = make_frame();
+
+    // The simulated pose has left the view, but the interpolated pose that
+    // is drawn is still inside it.
+    frame.scene->StoreTransformHistory();
+    for (const auto& mesh : frame.scene->Children()) {
+        mesh->TranslateX(1000.0f);
+    }
+    frame.scene->UpdateTransformHierarchy();
+    frame.scene->InterpolateTransformHierarchy(0.0f);
+    renderer->Render(frame.scene.get(), frame.camera.get());
+
+    EXPECT_EQ(renderer->GetCommandStream()->Count(Command::Draw), 2);
+}
+
+TEST(NullRendererTest, UploadsTexturesDuringExtract) {
+    auto renderer = make_null_renderer();
+    auto frame = make_frame();
+    auto material = std::static_pointer_cast<vglx::UnlitMaterial>(
+        std::static_pointer_cast<vglx::Mesh>(frame.scene->Children().front())->GetMaterial()
+    );
+    material->texture_map = vglx::Texture2D::Create({
+        .width = 2,
+        .height = 2,
+        .data = std::vector<uint8_t>(16, 0xFF)
+    });
+
+    // Submission only binds the texture uploaded during extraction.
+    renderer->Extract(frame.scene.get(), frame.camera.get());
+    const auto stream = renderer->GetCommandStream();
+    EXPECT_EQ(stream->Count(Command::CreateTexture), 1);
+    EXPECT_EQ(stream->Count(Command::TexImage2D), 1);
+    const auto extracted = stream->Size();
+
+    renderer->Submit();
+    const auto submitted = stream->Commands().subspan(extracted);
+    EXPECT_EQ(std::ranges::count(submitted, Command::CreateTexture, &vglx::RenderCommand::type), 0);
+    EXPECT_EQ(std::ranges::count(submitted, Command::BindTexture, &vglx::RenderCommand::type), 1);
+}
+
+TEST(NullRendererTest, IdenticalScenesProduceIdenticalStreams) {
+    auto a = make_null_renderer();
+    auto b = make_null_renderer();
+    auto frame_a = make_frame();
+    auto frame_b = make_frame();
+
+    a->Render(frame_a.scene.get(), frame_a.camera.get());
+    b->Render(frame_b.scene.get(), frame_b.camera.get());
+
+    const auto description = a->GetCommandStream()->Describe();
+    EXPECT_FALSE(description.empty());
+    EXPECT_EQ(description, b->GetCommandStream()->Describe());
+}
+
+TEST(NullRendererTest, RecordsShaderMaterialUniformValues) {
+    auto renderer = make_null_renderer();
+    auto frame = make_frame();
+    auto material = vglx::ShaderMaterial::Create({
+        .vertex_shader = R"(
+            #version 410 core
+            #pragma inject_attributes
+            #include "snippets/vert_global_params.glsl"
+            void main() {
+                #include "snippets/vert_main_varyings.glsl"
+                gl_Position = u_Projection * v_Position;
+            })",
+        .fragment_shader = R"(
+            #version 410 core
+            #pragma inject_attributes
+            #include "snippets/frag_global_params.glsl"
+            uniform float u_Time;
+            void main() {
+                v_FragColor = vec4(vec3(u_Time), u_Opacity);
+            })",
+        .uniforms = {{"u_Time", 0.25f}}
+    });
+    frame.scene->Add(vglx::Mesh::Create(vglx::BoxGeometry::Create(), material));
+
+    renderer->Render(frame.scene.get(), frame.camera.get());
+    const auto stream = renderer->GetCommandStream();
+    EXPECT_EQ(stream->Count(Command::CreateProgram), 2);
+    EXPECT_EQ(stream->Count(Command::Draw), 3);
+
+    const auto commands = stream->Commands();
+    const auto found = std::ranges::any_of(commands, [&](const vglx::RenderCommand& command) {
+        if (command.type != Command::SetUniform) return false;
+        const auto payload = stream->Payload(command);
+        auto value = 0.0f;
+        if (payload.size() != sizeof(value)) return false;
+        std::memcpy(&value, payload.data(), sizeof(value));
+        return value == 0.25f;
+    });
+    EXPECT_TRUE(found);
+}
+
+TEST(NullRendererTest, ExtractClearsPreviousFrame) {
+    auto renderer = make_null_renderer();
+    auto frame = make_frame();
+    renderer->Render(frame.scene.get(), frame.camera.get());
+    ASSERT_GT(renderer->GetCommandStream()->Size(), 0);
+
+    auto empty = vglx::Scene::Create();
+    renderer->Render(empty.get(), frame.camera.get());
+    const auto stream = renderer->GetCommandStream();
+    EXPECT_EQ(stream->Count(Command::Draw), 0);
+    EXPECT_EQ(stream->Count(Command::Clear), 1);
+}
+
+#pragma endregion
+
+#pragma region Draw Packets
+
+TEST(NullRendererTest, GroupsOpaqueDrawsByProgram) {
+    auto renderer = make_null_renderer();
+    auto frame = make_frame();
+    frame.scene = vglx::Scene::Create();
+    auto geometry = vglx::BoxGeometry::Create();
+    auto materials = std::array<std::shared_ptr<vglx::Material>, 2> {
+        vglx::UnlitMaterial::Create(0xFFFFFF),
+        vglx::PhongMaterial::Create(0xFFFFFF)
+    };
+
+    // Front to back the programs alternate.
+    for (auto i = 0; i < 4; ++i) {
+        auto mesh = vglx::Mesh::Create(geometry, materials[i % 2]);
+        mesh->transform.SetPosition({0.0f, 0.0f, -3.0f - i});
+        frame.scene->Add(mesh);
+    }
+
+    renderer->Render(frame.scene.get(), frame.camera.get());
+    const auto stream = renderer->GetCommandStream();
+    EXPECT_EQ(stream->Count(Command::Draw), 4);
+    EXPECT_EQ(stream->Count(Command::UseProgram), 2);
+}
+
+TEST(NullRendererTest, SkipsGeometryDisposedAfterValidation) {
+    auto renderer = make_null_renderer();
+    auto frame = make_frame();
+    renderer->Render(frame.scene.get(), frame.camera.get());
+    ASSERT_EQ(renderer->RenderedObjectsPerFrame(), 2);
+
+    auto mesh = std::static_pointer_cast<vglx::Mesh>(frame.scene->Children().front());
+    mesh->GetGeometry()->Dispose();
+
+    renderer->Render(frame.scene.get(), frame.camera.get());
+    EXPECT_EQ(renderer->GetCommandStream()->Count(Command::Draw), 0);
+    EXPECT_EQ(renderer->RenderedObjectsPerFrame(), 0);
+}
+
+TEST(NullRendererTest, TimesDrawsTogetherByDefault) {
+    auto renderer = make_null_renderer();
+    auto frame = make_frame();
+    renderer->Render(frame.scene.get(), frame.camera.get());
+
+    const auto& profile = renderer->GetFrameProfile();
+    EXPECT_GT(profile[vglx::ProfilePhase::DrawSubmit], 0.0);
+    EXPECT_EQ(profile[vglx::ProfilePhase::ProgramResolve], 0.0);
+    EXPECT_EQ(profile[vglx::ProfilePhase::UniformUpload], 0.0);
+}
+
+TEST(NullRendererTest, SplitsDrawPhasesWhenAsked) {
+    auto params = null_renderer_parameters();
+    params.draw_phase_timers = true;
+    auto renderer = make_null_renderer(params);
+    auto frame = make_frame();
+    renderer->Render(frame.scene.get(), frame.camera.get());
+
+    const auto& profile = renderer->GetFrameProfile();
+    EXPECT_GT(profile[vglx::ProfilePhase::DrawSubmit], 0.0);
+    EXPECT_GT(profile[vglx::ProfilePhase::ProgramResolve], 0.0);
+    EXPECT_GT(profile[vglx::ProfilePhase::UniformUpload], 0.0);
+}
+
+#pragma endregion
+
+#pragma region Occlusion Culling
+
+TEST(NullRendererTest, SkipsMeshesHiddenBehindOccluders) {
+    auto params = null_renderer_parameters();
+    params.occlusion_culling = true;
+    auto renderer = make_null_renderer(params);
+    auto frame = make_frame();
+    auto wall = vglx::Mesh::Create(
+        vglx::BoxGeometry::Create({.width = 6.0f, .height = 4.0f, .depth = 0.5f}),
+        vglx::UnlitMaterial::Create(0x808080)
+    );
+    wall->occluder = true;
+    wall->transform.SetPosition({0.0f, 0.0f, -3.0f});
+    frame.scene->Add(wall);
+    renderer->Render(frame.scene.get(), frame.camera.get());
+
+    // The wall hides both boxes but is drawn itself.
+    const auto& profile = renderer->GetFrameProfile();
+    EXPECT_EQ(profile[vglx::ProfileCounter::OccludedObjects], 2);
+    EXPECT_EQ(renderer->GetCommandStream()->Count(Command::Draw), 1);
+}
+
+TEST(NullRendererTest, DrawsQueriedMeshesConditionally) {
+    auto params = null_renderer_parameters();
+    params.occlusion_queries = true;
+    auto renderer = make_null_renderer(params);
+    auto frame = make_frame();
+    auto mesh = std::static_pointer_cast<vglx::Mesh>(frame.scene->Children().front());
+    mesh->occlusion_query = true;
+    renderer->Render(frame.scene.get(), frame.camera.get());
+
+    // The first frame queries the mesh's bounds before drawing it, with the
+    // target the null device reports.
+    const auto stream = renderer->GetCommandStream();
+    EXPECT_EQ(stream->Count(Command::BeginQuery), 1);
+    const auto commands = stream->Commands();
+    const auto begin = std::ranges::find(commands, Command::BeginQuery, &vglx::RenderCommand::type);
+    ASSERT_NE(begin, commands.end());
+    EXPECT_EQ(begin->args[0], 0x8C2F); // GL_ANY_SAMPLES_PASSED
+    EXPECT_EQ(stream->Count(Command::BeginConditionalRender), 1);
+    EXPECT_EQ(stream->Count(Command::Draw), 3);
+    EXPECT_EQ(renderer->GetFrameProfile()[vglx::ProfileCounter::OcclusionQueries], 1);
+
+    // The query box is not counted as one of the frame's draws.
+    EXPECT_EQ(renderer->GetFrameProfile()[vglx::ProfileCounter::DrawCalls], 2);
+
+    // The null device reports every query visible, so the mesh is only
+    // queried again once per interval.
+    auto queries = 0;
+    for (auto i = uint32_t {0}; i < vglx::VisibilityHistory::kVisibleInterval; ++i) {
+        renderer->Render(frame.scene.get(), frame.camera.get());
+        queries += renderer->GetCommandStream()->Count(Command::BeginQuery);
+        EXPECT_EQ(renderer->GetFrameProfile()[vglx::ProfileCounter::OccludedObjects], 0);
+    }
+    EXPECT_EQ(queries, 1);
+}
+
+TEST(NullRendererTest, DrawsDepthPrepassBeforeShading) {
+    auto params = null_renderer_parameters();
+    params.depth_prepass = true;
+    auto renderer = make_null_renderer(params);
+    auto frame = make_frame();
+    renderer->Render(frame.scene.get(), frame.camera.get());
+
+    // Both boxes are drawn by the depth-only program, then shaded where
+    // their depth is equal to the one already written.
+    const auto stream = renderer->GetCommandStream();
+    EXPECT_EQ(stream->Count(Command::CreateProgram), 2);
+    EXPECT_EQ(stream->Count(Command::Draw), 4);
+    EXPECT_EQ(stream->Count(Command::ColorMask), 2);
+
+    const auto commands = stream->Commands();
+    const auto depth_func = std::ranges::find(commands, Command::DepthFunc, &vglx::RenderCommand::type);
+    ASSERT_NE(depth_func, commands.end());
+    EXPECT_EQ(depth_func->args[0], 0x0202); // GL_EQUAL
+    EXPECT_EQ(std::ranges::count(commands, Command::DepthFunc, &vglx::RenderCommand::type), 2);
+    EXPECT_EQ(std::ranges::count(commands.begin(), depth_func, Command::Draw, &vglx::RenderCommand::type), 2);
+}
+
+TEST(NullRendererTest, KeepsDepthPrepassWithoutTimers) {
+    auto params = null_renderer_parameters();
+    params.depth_prepass = true;
+    auto renderer = make_null_renderer(params);
+    auto frame = make_frame();
+
+    // Nothing can time the null backend, so no frame is drawn without the
+    // pre-pass to measure it.
+    for (auto i = 0; i < 120; ++i) {
+        renderer->Render(frame.scene.get(), frame.camera.get());
+        EXPECT_EQ(renderer->GetCommandStream()->Count(Command::Draw), 4);
+    }
+}
+
+TEST(NullRendererTest, SkipsDepthPrepassForOptedOutMaterials) {
+    auto params = null_renderer_parameters();
+    params.depth_prepass = true;
+    auto renderer = make_null_renderer(params);
+    auto frame = make_frame();
+    auto mesh = std::static_pointer_cast<vglx::Mesh>(frame.scene->Children().front());
+    mesh->GetMaterial()->depth_prepass = false;
+    renderer->Render(frame.scene.get(), frame.camera.get());
+
+    const auto stream = renderer->GetCommandStream();
+    EXPECT_EQ(stream->Count(Command::CreateProgram), 1);
+    EXPECT_EQ(stream->Count(Command::Draw), 2);
+    EXPECT_EQ(stream->Count(Command::DepthFunc), 0);
+}
+
+#pragma endregion
\ No newline at end of file
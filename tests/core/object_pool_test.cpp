@@ -0,0 +1,91 @@
+/*
+===========================================================================
+  VGLX https://vglx.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#include <gtest/gtest.h>
+
+#include <vglx/core/object_pool.hpp>
+#include <vglx/nodes/node.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <set>
+#include <thread>
+#include <vector>
+
+#pragma region Allocation
+
+TEST(ObjectPool, ReusesFreedBlocks) {
+    auto first = vglx::ObjectPool::Allocate(40);
+    vglx::ObjectPool::Deallocate(first, 40);
+
+    // Sizes in the same 16 byte class share blocks.
+    auto second = vglx::ObjectPool::Allocate(48);
+    EXPECT_EQ(first, second);
+    vglx::ObjectPool::Deallocate(second, 48);
+}
+
+TEST(ObjectPool, ReturnsDistinctAlignedBlocks) {
+    auto blocks = std::vector<void*> {};
+    for (auto i = 0; i < 1000; ++i) {
+        blocks.emplace_back(vglx::ObjectPool::Allocate(24));
+    }
+
+    EXPECT_EQ(std::set<void*>(blocks.begin(), blocks.end()).size(), blocks.size());
+    for (auto block : blocks) {
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(block) % alignof(std::max_align_t), 0);
+        vglx::ObjectPool::Deallocate(block, 24);
+    }
+    EXPECT_GT(vglx::ObjectPool::ReservedBytes(), 0);
+}
+
+TEST(ObjectPool, FallsBackForLargeAndOveralignedRequests) {
+    auto large = vglx::ObjectPool::Allocate(vglx::ObjectPool::kMaxBlockSize + 1);
+    auto aligned = vglx::ObjectPool::Allocate(64, 64);
+
+    EXPECT_NE(large, nullptr);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(aligned) % 64, 0);
+
+    vglx::ObjectPool::Deallocate(large, vglx::ObjectPool::kMaxBlockSize + 1);
+    vglx::ObjectPool::Deallocate(aligned, 64, 64);
+}
+
+TEST(ObjectPool, AcceptsBlocksFreedOnAnotherThread) {
+    auto nodes = std::vector<std::shared_ptr<vglx::Node>> {};
+    for (auto i = 0; i < 500; ++i) {
+        nodes.emplace_back(vglx::Node::Create());
+    }
+
+    auto worker = std::thread {[&nodes] { nodes.clear(); }};
+    worker.join();
+
+    EXPECT_TRUE(nodes.empty());
+    EXPECT_NE(vglx::Node::Create(), nullptr);
+}
+
+#pragma endregion
+
+#pragma region Shared Objects
+
+TEST(ObjectPool, MakePooledCreatesSharedObjects) {
+    auto node = vglx::MakePooled<vglx::Node>();
+    auto child = vglx::Node::Create();
+    node->Add(child);
+
+    EXPECT_EQ(node.use_count(), 1);
+    EXPECT_EQ(child->Parent(), node.get());
+    EXPECT_EQ(node->Children().size(), 1);
+}
+
+TEST(ObjectPool, NodesAcceptOtherAllocators) {
+    auto node = std::allocate_shared<vglx::Node>(std::allocator<vglx::Node> {});
+    node->Add(vglx::Node::Create());
+
+    EXPECT_EQ(node->Children().size(), 1);
+    EXPECT_EQ(node->UUID().size(), 36);
+}
+
+#pragma endregion
\ No newline at end of file
@@ -0,0 +1,141 @@
+/*
+===========================================================================
+  VGLX https://vglx.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#include <gtest/gtest.h>
+
+#include <vglx/cameras/perspective_camera.hpp>
+#include <vglx/core/job_system.hpp>
+#include <vglx/geometries/box_geometry.hpp>
+#include <vglx/geometries/plane_geometry.hpp>
+#include <vglx/materials/unlit_material.hpp>
+#include <vglx/math/box3.hpp>
+#include <vglx/math/utilities.hpp>
+#include <vglx/math/vector3.hpp>
+#include <vglx/nodes/mesh.hpp>
+#include <vglx/nodes/scene.hpp>
+
+#include "core/occlusion_buffer.hpp"
+
+#include <memory>
+#include <vector>
+
+namespace {
+
+struct Fixture {
+    std::shared_ptr<vglx::Scene> scene;
+    std::shared_ptr<vglx::PerspectiveCamera> camera;
+    std::vector<vglx::Mesh*> occluders;
+
+    auto ViewProjection() const {
+        return camera->projection_matrix * camera->view_matrix;
+    }
+};
+
+// A 4x4 wall facing the camera, 5 units in front of it.
+auto make_fixture() {
+    auto fixture = Fixture {
+        vglx::Scene::Create(),
+        vglx::PerspectiveCamera::Create({
+            .fov = 1.0f,
+            .aspect = 2.0f,
+            .near = 0.1f,
+            .far = 100.0f
+        })
+    };
+    auto wall = vglx::Mesh::Create(
+        vglx::PlaneGeometry::Create({.width = 4.0f, .height = 4.0f}),
+        vglx::UnlitMaterial::Create(0xFFFFFF)
+    );
+    wall->occluder = true;
+    wall->transform.SetPosition({0.0f, 0.0f, -5.0f});
+    fixture.scene->Add(wall);
+    fixture.scene->UpdateTransformHierarchy();
+    fixture.camera->UpdateViewMatrix();
+    fixture.occluders.emplace_back(wall.get());
+    return fixture;
+}
+
+auto unit_box(float x, float y, float z) {
+    return vglx::Box3 {{x - 0.5f, y - 0.5f, z - 0.5f}, {x + 0.5f, y + 0.5f, z + 0.5f}};
+}
+
+}
+
+#pragma region Rasterization
+
+TEST(OcclusionBufferTest, RasterizesOccluderDepth) {
+    auto fixture = make_fixture();
+    auto buffer = vglx::OcclusionBuffer {};
+    buffer.Rasterize(fixture.occluders, fixture.ViewProjection());
+
+    EXPECT_EQ(buffer.TriangleCount(), 2);
+    EXPECT_LT(buffer.Depth(vglx::OcclusionBuffer::kWidth / 2, vglx::OcclusionBuffer::kHeight / 2), 1.0f);
+    EXPECT_EQ(buffer.Depth(0, 0), 1.0f);
+}
+
+TEST(OcclusionBufferTest, SkipsBackFaces) {
+    auto fixture = make_fixture();
+    fixture.occluders[0]->transform.Rotate(vglx::Vector3::Up(), vglx::math::pi);
+    fixture.scene->UpdateTransformHierarchy();
+
+    auto buffer = vglx::OcclusionBuffer {};
+    buffer.Rasterize(fixture.occluders, fixture.ViewProjection());
+
+    EXPECT_EQ(buffer.TriangleCount(), 0);
+}
+
+TEST(OcclusionBufferTest, ParallelRasterizationMatchesSerial) {
+    auto fixture = make_fixture();
+    auto serial = vglx::OcclusionBuffer {};
+    serial.Rasterize(fixture.occluders, fixture.ViewProjection());
+
+    auto jobs = vglx::JobSystem {3};
+    auto parallel = vglx::OcclusionBuffer {};
+    parallel.Rasterize(fixture.occluders, fixture.ViewProjection(), &jobs);
+
+    for (auto y = 0; y < vglx::OcclusionBuffer::kHeight; ++y) {
+        for (auto x = 0; x < vglx::OcclusionBuffer::kWidth; ++x) {
+            ASSERT_EQ(parallel.Depth(x, y), serial.Depth(x, y)) << x << ", " << y;
+        }
+    }
+}
+
+#pragma endregion
+
+#pragma region Occlusion Tests
+
+TEST(OcclusionBufferTest, OccludesBoxesBehindOccluders) {
+    auto fixture = make_fixture();
+    auto buffer = vglx::OcclusionBuffer {};
+    buffer.Rasterize(fixture.occluders, fixture.ViewProjection());
+
+    EXPECT_TRUE(buffer.IsOccluded(unit_box(0.0f, 0.0f, -10.0f)));
+    EXPECT_TRUE(buffer.IsOccluded(unit_box(1.0f, -1.0f, -20.0f)));
+}
+
+TEST(OcclusionBufferTest, KeepsVisibleBoxes) {
+    auto fixture = make_fixture();
+    auto buffer = vglx::OcclusionBuffer {};
+    buffer.Rasterize(fixture.occluders, fixture.ViewProjection());
+
+    // In front of the wall, beside it and straddling its edge.
+    EXPECT_FALSE(buffer.IsOccluded(unit_box(0.0f, 0.0f, -3.0f)));
+    EXPECT_FALSE(buffer.IsOccluded(unit_box(7.0f, 0.0f, -10.0f)));
+    EXPECT_FALSE(buffer.IsOccluded(unit_box(4.0f, 0.0f, -10.0f)));
+    // Reaching behind the camera.
+    EXPECT_FALSE(buffer.IsOccluded({{-0.5f, -0.5f, -10.0f}, {0.5f, 0.5f, 1.0f}}));
+}
+
+TEST(OcclusionBufferTest, EmptyBufferOccludesNothing) {
+    auto fixture = make_fixture();
+    auto buffer = vglx::OcclusionBuffer {};
+    buffer.Rasterize({}, fixture.ViewProjection());
+
+    EXPECT_FALSE(buffer.IsOccluded(unit_box(0.0f, 0.0f, -10.0f)));
+}
+
+#pragma endregion
\ No newline at end of file
@@ -0,0 +1,206 @@
+/*
+===========================================================================
+  VGLX https://vglx.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#include <gtest/gtest.h>
+
+#include <vglx/cameras/orthographic_camera.hpp>
+#include <vglx/core/offscreen_context.hpp>
+#include <vglx/core/renderer.hpp>
+#include <vglx/geometries/plane_geometry.hpp>
+#include <vglx/materials/unlit_material.hpp>
+#include <vglx/nodes/mesh.hpp>
+#include <vglx/nodes/scene.hpp>
+
+#include <array>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <vector>
+
+namespace {
+
+class OffscreenRendererTest : public ::testing::Test {
+protected:
+    std::unique_ptr<vglx::OffscreenContext> context;
+
+    std::unique_ptr<vglx::Renderer> renderer;
+
+    auto SetUp() -> void override {
+        if (!vglx::OffscreenContext::IsSupported()) {
+            GTEST_SKIP() << "Built without EGL";
+        }
+
+        context = std::make_unique<vglx::OffscreenContext>();
+        if (auto result = context->Initialize(); !result) {
+            GTEST_SKIP() << result.error();
+        }
+
+        CreateRenderer(/* gpu_material_timers = */ false);
+    }
+
+    auto TearDown() -> void override {
+        renderer.reset();
+        context.reset();
+    }
+
+    auto CreateRenderer(bool gpu_material_timers) -> void {
+        renderer = std::make_unique<vglx::Renderer>(vglx::Renderer::Parameters {
+            .framebuffer_width = 64,
+            .framebuffer_height = 32,
+            .clear_color = 0xFF0000,
+            .offscreen = true,
+            .gpu_material_timers = gpu_material_timers
+        });
+    }
+
+    // Renders frames until the GPU timings of an earlier frame are read back.
+    auto RenderUntilGpuTimed() -> bool {
+        for (auto i = 0; i < 8; ++i) {
+            RenderFrame();
+            if (renderer->GetFrameProfile().gpu_latency > 0) return true;
+            // Waiting on a readback lets the GPU catch up with the frame.
+            renderer->ReadPixels([](const vglx::ReadbackImage&) {});
+            renderer->FlushReadbacks();
+        }
+        return false;
+    }
+
+    // Renders a white quad covering the left half of the frame.
+    auto RenderFrame() -> void {
+        auto scene = vglx::Scene::Create();
+        auto quad = vglx::Mesh::Create(
+            vglx::PlaneGeometry::Create({.width = 1.0f, .height = 2.0f}),
+            vglx::UnlitMaterial::Create(0xFFFFFF)
+        );
+        quad->transform.SetPosition({-0.5f, 0.0f, 0.0f});
+        scene->Add(quad);
+
+        auto camera = vglx::OrthographicCamera::Create({
+            .left = -1.0f,
+            .right = 1.0f,
+            .top = 1.0f,
+            .bottom = -1.0f,
+            .near = 0.1f,
+            .far = 10.0f
+        });
+        camera->transform.SetPosition({0.0f, 0.0f, 1.0f});
+
+        renderer->Render(scene.get(), camera.get());
+    }
+};
+
+auto pixel_at(const vglx::ReadbackImage& image, int x, int y) {
+    const auto offset = (static_cast<size_t>(y) * image.width + x) * 4;
+    return std::array<uint8_t, 4> {
+        image.pixels[offset],
+        image.pixels[offset + 1],
+        image.pixels[offset + 2],
+        image.pixels[offset + 3]
+    };
+}
+
+}
+
+#pragma region Readback
+
+TEST_F(OffscreenRendererTest, ReadPixelsDeliversFrame) {
+    RenderFrame();
+
+    auto calls = 0;
+    renderer->ReadPixels([&calls](const vglx::ReadbackImage& image) {
+        ++calls;
+        ASSERT_EQ(image.width, 64);
+        ASSERT_EQ(image.height, 32);
+        ASSERT_EQ(image.pixels.size(), 64 * 32 * 4);
+
+        EXPECT_EQ(pixel_at(image, 8, 16), (std::array<uint8_t, 4> {255, 255, 255, 255}));
+        EXPECT_EQ(pixel_at(image, 56, 16), (std::array<uint8_t, 4> {255, 0, 0, 255}));
+    });
+    renderer->FlushReadbacks();
+
+    EXPECT_EQ(calls, 1);
+}
+
+TEST_F(OffscreenRendererTest, ReadPixelsPreservesRequestOrder) {
+    auto order = std::vector<int> {};
+    for (auto i = 0; i < 8; ++i) {
+        RenderFrame();
+        renderer->ReadPixels([&order, i](const vglx::ReadbackImage&) {
+            order.emplace_back(i);
+        });
+    }
+    renderer->FlushReadbacks();
+
+    EXPECT_EQ(order, (std::vector<int> {0, 1, 2, 3, 4, 5, 6, 7}));
+}
+
+TEST_F(OffscreenRendererTest, ReadPixelsWritesImageFile) {
+    const auto path = std::filesystem::temp_directory_path() / "vglx_offscreen_test.tga";
+    std::filesystem::remove(path);
+
+    RenderFrame();
+    renderer->ReadPixels(path);
+    renderer->FlushReadbacks();
+
+    ASSERT_TRUE(std::filesystem::exists(path));
+    EXPECT_EQ(std::filesystem::file_size(path), 18 + 64 * 32 * 4);
+
+    auto file = std::ifstream {path, std::ios::binary};
+    auto header = std::array<char, 18> {};
+    file.read(header.data(), header.size());
+    EXPECT_EQ(header[2], 2);
+    EXPECT_EQ(static_cast<uint8_t>(header[12]), 64);
+    EXPECT_EQ(static_cast<uint8_t>(header[14]), 32);
+
+    std::filesystem::remove(path);
+}
+
+#pragma endregion
+
+#pragma region Profile
+
+TEST_F(OffscreenRendererTest, FrameProfileCountsDrawWork) {
+    RenderFrame();
+
+    const auto& profile = renderer->GetFrameProfile();
+    EXPECT_EQ(profile[vglx::ProfileCounter::DrawCalls], 1);
+    EXPECT_EQ(profile[vglx::ProfileCounter::Triangles], 2);
+    EXPECT_EQ(profile[vglx::ProfileCounter::ProgramSwitches], 1);
+    EXPECT_EQ(profile[vglx::ProfileCounter::VertexArraySwitches], 1);
+    EXPECT_GT(profile[vglx::ProfileCounter::UploadedBytes], 0);
+    EXPECT_GT(profile[vglx::ProfilePhase::DrawSubmit], 0.0);
+}
+
+TEST_F(OffscreenRendererTest, CommandStreamIsOnlyRecordedByNullBackend) {
+    RenderFrame();
+    EXPECT_EQ(renderer->GetCommandStream(), nullptr);
+}
+
+TEST_F(OffscreenRendererTest, GpuTimingsArriveWithoutStalling) {
+    RenderFrame();
+    EXPECT_EQ(renderer->GetFrameProfile().gpu_latency, 0);
+
+    ASSERT_TRUE(RenderUntilGpuTimed());
+    const auto& profile = renderer->GetFrameProfile();
+    EXPECT_GE(profile.gpu_latency, 1);
+    EXPECT_GE(profile[vglx::GpuPass::Opaque], 0.0);
+    EXPECT_TRUE(renderer->GetGpuMaterialTimings().empty());
+}
+
+TEST_F(OffscreenRendererTest, GpuMaterialTimingsGroupDrawsByProgram) {
+    CreateRenderer(/* gpu_material_timers = */ true);
+
+    ASSERT_TRUE(RenderUntilGpuTimed());
+    const auto& timings = renderer->GetGpuMaterialTimings();
+    ASSERT_EQ(timings.size(), 1);
+    EXPECT_EQ(timings[0].type, vglx::Material::Type::UnlitMaterial);
+    EXPECT_EQ(timings[0].draws, 1);
+    EXPECT_GE(timings[0].ms, 0.0);
+}
+
+#pragma endregion
\ No newline at end of file
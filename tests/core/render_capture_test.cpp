@@ -0,0 +1,227 @@
+/*
+===========================================================================
+  VGLX https://vglx.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#include <gtest/gtest.h>
+
+#include <vglx/cameras/perspective_camera.hpp>
+#include <vglx/core/offscreen_context.hpp>
+#include <vglx/core/render_capture.hpp>
+#include <vglx/core/renderer.hpp>
+#include <vglx/geometries/box_geometry.hpp>
+#include <vglx/materials/unlit_material.hpp>
+#include <vglx/nodes/mesh.hpp>
+#include <vglx/nodes/scene.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <span>
+
+namespace {
+
+using Command = vglx::RenderCommandType;
+
+constexpr auto kFrames = 3;
+
+// Renders a few frames of two boxes into a capture file.
+auto capture_frames(const std::filesystem::path& path, vglx::Renderer::Backend backend) {
+    auto renderer = vglx::Renderer {{
+        .framebuffer_width = 64,
+        .framebuffer_height = 32,
+        .clear_color = 0x000000,
+        .offscreen = true,
+        .gpu_timers = false,
+        .backend = backend,
+        .capture_path = path
+    }};
+    if (!renderer.Initialize()) return false;
+
+    auto scene = vglx::Scene::Create();
+    auto geometry = vglx::BoxGeometry::Create();
+    auto material = vglx::UnlitMaterial::Create(0xFFFFFF);
+    for (auto x : {-1.0f, 1.0f}) {
+        auto mesh = vglx::Mesh::Create(geometry, material);
+        mesh->transform.SetPosition({x, 0.0f, -5.0f});
+        scene->Add(mesh);
+    }
+    auto camera = vglx::PerspectiveCamera::Create({
+        .fov = 1.0f,
+        .aspect = 2.0f,
+        .near = 0.1f,
+        .far = 100.0f
+    });
+
+    for (auto i = 0; i < kFrames; ++i) {
+        renderer.Render(scene.get(), camera.get());
+    }
+    return true;
+}
+
+auto temp_path(std::string_view name) {
+    return std::filesystem::temp_directory_path() / name;
+}
+
+template <typename T>
+auto bytes(const T& value) {
+    return std::as_bytes(std::span {&value, 1});
+}
+
+}
+
+#pragma region Capture
+
+TEST(RenderCaptureTest, WritesOneStreamPerFrame) {
+    const auto path = temp_path("vglx_capture_test.vcap");
+    ASSERT_TRUE(capture_frames(path, vglx::Renderer::Backend::Null));
+
+    auto capture = vglx::RenderCapture::Load(path);
+    ASSERT_TRUE(capture.has_value()) << capture.error();
+
+    const auto frames = capture->Frames();
+    ASSERT_EQ(frames.size(), kFrames);
+    for (const auto& frame : frames) {
+        EXPECT_EQ(frame.Count(Command::Clear), 1);
+        EXPECT_EQ(frame.Count(Command::Draw), 2);
+    }
+
+    // Resources are created once, with the data they upload.
+    EXPECT_EQ(frames[0].Count(Command::CreateProgram), 1);
+    EXPECT_EQ(frames[1].Count(Command::CreateProgram), 0);
+    const auto commands = frames[0].Commands();
+    const auto has_data = [&](Command type) {
+        return std::ranges::any_of(commands, [&](const vglx::RenderCommand& command) {
+            return command.type == type && command.payload_size == command.args[1];
+        });
+    };
+    EXPECT_TRUE(has_data(Command::BufferData));
+    const auto program = std::ranges::find(commands, Command::CreateProgram, &vglx::RenderCommand::type);
+    ASSERT_NE(program, commands.end());
+    EXPECT_GT(program->payload_size, 0);
+
+    std::filesystem::remove(path);
+}
+
+TEST(RenderCaptureTest, InitializeFailsWhenCaptureFileCannotBeCreated) {
+    auto renderer = vglx::Renderer {{
+        .framebuffer_width = 64,
+        .framebuffer_height = 32,
+        .clear_color = 0x000000,
+        .backend = vglx::Renderer::Backend::Null,
+        .capture_path = temp_path("vglx_missing_directory") / "capture.vcap"
+    }};
+    EXPECT_FALSE(renderer.Initialize().has_value());
+}
+
+TEST(RenderCaptureTest, LoadRejectsInvalidFiles) {
+    EXPECT_FALSE(vglx::RenderCapture::Load(temp_path("vglx_missing_capture.vcap")).has_value());
+
+    const auto path = temp_path("vglx_invalid_capture.vcap");
+    std::ofstream {path} << "not a capture";
+    EXPECT_FALSE(vglx::RenderCapture::Load(path).has_value());
+    std::filesystem::remove(path);
+}
+
+#pragma endregion
+
+#pragma region Redundancy
+
+TEST(RenderCaptureTest, FindsRedundantBindsStateAndUploads) {
+    const auto value = 0.5f;
+    const auto other = 1.0f;
+
+    auto stream = vglx::RenderCommandStream {};
+    stream.Record(Command::UseProgram, {1});
+    stream.Record(Command::UseProgram, {1}); // redundant bind
+    stream.Record(Command::SetUniform, {0, 0}, bytes(value));
+    stream.Record(Command::SetUniform, {0, 0}, bytes(value)); // redundant upload
+    stream.Record(Command::SetUniform, {0, 0}, bytes(other));
+    stream.Record(Command::UseProgram, {2});
+    stream.Record(Command::SetUniform, {0, 0}, bytes(value)); // other program
+    stream.Record(Command::Enable, {0x0B71});
+    stream.Record(Command::Enable, {0x0B71}); // redundant state
+    stream.Record(Command::Disable, {0x0B71});
+
+    const auto frames = std::array {stream};
+    const auto redundant = vglx::FindRedundantCommands(frames);
+    ASSERT_EQ(redundant.size(), 3);
+
+    EXPECT_EQ(redundant[0].kind, vglx::Redundancy::Bind);
+    EXPECT_EQ(redundant[0].index, 1);
+    EXPECT_EQ(redundant[1].kind, vglx::Redundancy::Upload);
+    EXPECT_EQ(redundant[1].type, Command::SetUniform);
+    EXPECT_EQ(redundant[1].bytes, sizeof(value));
+    EXPECT_EQ(redundant[2].kind, vglx::Redundancy::State);
+    EXPECT_EQ(redundant[2].index, 8);
+}
+
+TEST(RenderCaptureTest, StateCarriesOverBetweenFrames) {
+    auto first = vglx::RenderCommandStream {};
+    first.Record(Command::BindVertexArray, {3});
+    auto second = vglx::RenderCommandStream {};
+    second.Record(Command::BindVertexArray, {3});
+
+    const auto frames = std::array {first, second};
+    const auto redundant = vglx::FindRedundantCommands(frames);
+    ASSERT_EQ(redundant.size(), 1);
+    EXPECT_EQ(redundant[0].frame, 1);
+    EXPECT_EQ(redundant[0].index, 0);
+}
+
+#pragma endregion
+
+#pragma region Replay
+
+class RenderCaptureReplayTest : public ::testing::Test {
+protected:
+    std::unique_ptr<vglx::OffscreenContext> context;
+
+    auto SetUp() -> void override {
+        if (!vglx::OffscreenContext::IsSupported()) {
+            GTEST_SKIP() << "Built without EGL";
+        }
+
+        context = std::make_unique<vglx::OffscreenContext>();
+        if (auto result = context->Initialize(); !result) {
+            GTEST_SKIP() << result.error();
+        }
+    }
+
+    auto ExpectReplays(vglx::Renderer::Backend backend) -> void {
+        const auto path = temp_path("vglx_replay_test.vcap");
+        ASSERT_TRUE(capture_frames(path, backend));
+
+        auto capture = vglx::RenderCapture::Load(path);
+        ASSERT_TRUE(capture.has_value()) << capture.error();
+
+        auto report = capture->Replay();
+        ASSERT_TRUE(report.has_value()) << report.error();
+        ASSERT_EQ(report->frames.size(), kFrames);
+        for (auto i = size_t {0}; i < kFrames; ++i) {
+            EXPECT_EQ(report->frames[i].commands, capture->Frames()[i].Size());
+            EXPECT_GE(report->frames[i].total_ms, report->frames[i].cpu_ms);
+        }
+
+        const auto draws = std::ranges::find(report->commands, Command::Draw, &vglx::ReplayCommandTiming::type);
+        ASSERT_NE(draws, report->commands.end());
+        EXPECT_EQ(draws->count, 2 * kFrames);
+
+        std::filesystem::remove(path);
+    }
+};
+
+TEST_F(RenderCaptureReplayTest, ReplaysOpenGLCapture) {
+    ExpectReplays(vglx::Renderer::Backend::OpenGL);
+}
+
+TEST_F(RenderCaptureReplayTest, ReplaysNullBackendCapture) {
+    ExpectReplays(vglx::Renderer::Backend::Null);
+}
+
+#pragma endregion
\ No newline at end of file
@@ -0,0 +1,202 @@
+/*
+===========================================================================
+  VGLX https://vglx.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#include <gtest/gtest.h>
+
+#include <vglx/core/job_system.hpp>
+#include <vglx/geometries/box_geometry.hpp>
+#include <vglx/lights/point_light.hpp>
+#include <vglx/materials/unlit_material.hpp>
+#include <vglx/nodes/mesh.hpp>
+#include <vglx/nodes/scene.hpp>
+
+#include "core/render_lists.hpp"
+#include "scene_helpers.hpp"
+
+#include <algorithm>
+#include <initializer_list>
+#include <vector>
+
+namespace {
+
+struct Lists {
+    std::vector<vglx::Renderable*> opaque;
+    std::vector<vglx::Renderable*> transparent;
+    std::vector<vglx::Light*> lights;
+
+    auto operator==(const Lists&) const -> bool = default;
+};
+
+// Adds meshes to `meshes` in traversal order.
+auto find_meshes(vglx::Node* node, std::vector<vglx::Mesh*>& meshes) -> void {
+    for (const auto& child : node->Children()) {
+        if (child->GetNodeType() == vglx::Node::Type::Mesh) {
+            meshes.emplace_back(static_cast<vglx::Mesh*>(child.get()));
+        }
+        find_meshes(child.get(), meshes);
+    }
+}
+
+// The shared test scene, with every tenth mesh transparent and a light
+// attached to every hundredth.
+auto make_mixed_scene(int count, int fanout) {
+    auto scene = make_scene(count, fanout);
+    auto transparent = vglx::UnlitMaterial::Create(0xFFFFFF);
+    transparent->transparent = true;
+
+    auto meshes = std::vector<vglx::Mesh*> {};
+    find_meshes(scene.get(), meshes);
+    for (auto i = size_t {0}; i < meshes.size(); ++i) {
+        if (i % 10 == 0) meshes[i]->SetMaterial(transparent);
+        if (i % 100 == 0) meshes[i]->Add(vglx::PointLight::Create({.color = 0xFFFFFF, .intensity = 1.0f}));
+    }
+    scene->UpdateTransformHierarchy();
+    return scene;
+}
+
+// A scene where every interior node is a mesh, so parallel culling splits
+// renderables from their renderable children. `fanouts` lists the children
+// per node at each level.
+auto make_nested_scene(std::initializer_list<int> fanouts) {
+    auto scene = vglx::Scene::Create();
+    auto geometry = vglx::BoxGeometry::Create();
+    auto material = vglx::UnlitMaterial::Create(0xFFFFFF);
+
+    auto level = std::vector<vglx::Node*> {scene.get()};
+    for (auto fanout : fanouts) {
+        auto next = std::vector<vglx::Node*> {};
+        for (auto parent : level) {
+            for (auto i = 0; i < fanout; ++i) {
+                auto mesh = vglx::Mesh::Create(geometry, material);
+                mesh->transform.SetPosition({0.1f * static_cast<float>(i - fanout / 2), 0.0f, -2.0f});
+                next.emplace_back(mesh.get());
+                parent->Add(mesh);
+            }
+        }
+        level = std::move(next);
+    }
+    scene->UpdateTransformHierarchy();
+    return scene;
+}
+
+auto collect(vglx::Scene* scene, vglx::JobSystem* jobs) {
+    auto camera = make_camera();
+    auto render_lists = vglx::RenderLists {};
+    render_lists.SetJobSystem(jobs);
+    // The first collection sizes the scene, the second one runs in parallel.
+    render_lists.ProcessScene(scene, camera.get());
+    render_lists.ProcessScene(scene, camera.get());
+
+    return Lists {
+        {render_lists.Opaque().begin(), render_lists.Opaque().end()},
+        {render_lists.Transparent().begin(), render_lists.Transparent().end()},
+        {render_lists.Lights().begin(), render_lists.Lights().end()}
+    };
+}
+
+}
+
+#pragma region Parallel Collection
+
+TEST(RenderListsTest, ParallelCollectionMatchesSerial) {
+    for (auto fanout : {0, 7}) {
+        auto scene = make_mixed_scene(static_cast<int>(vglx::RenderLists::kParallelThreshold) * 2, fanout);
+        const auto serial = collect(scene.get(), nullptr);
+        ASSERT_FALSE(serial.opaque.empty());
+        ASSERT_FALSE(serial.transparent.empty());
+        ASSERT_FALSE(serial.lights.empty());
+
+        for (auto workers : {1u, 3u, 7u}) {
+            auto jobs = vglx::JobSystem {workers};
+            EXPECT_EQ(collect(scene.get(), &jobs), serial) << "fanout " << fanout << ", workers " << workers;
+        }
+    }
+}
+
+TEST(RenderListsTest, ParallelCollectionOfNestedRenderables) {
+    auto scene = make_nested_scene({4, 8, 8, 32});
+    const auto serial = collect(scene.get(), nullptr);
+    ASSERT_GE(serial.opaque.size(), vglx::RenderLists::kParallelThreshold);
+
+    for (auto workers : {1u, 3u, 7u}) {
+        auto jobs = vglx::JobSystem {workers};
+        EXPECT_EQ(collect(scene.get(), &jobs), serial) << "workers " << workers;
+    }
+}
+
+TEST(RenderListsTest, ParallelCollectionSkipsChildrenOfHiddenParents) {
+    auto scene = make_nested_scene({4, 8, 8, 32});
+    auto hidden = vglx::UnlitMaterial::Create(0xFFFFFF);
+    hidden->visible = false;
+    const auto& parents = scene->Children();
+    static_cast<vglx::Mesh*>(parents[0].get())->SetMaterial(hidden);
+    static_cast<vglx::Mesh*>(parents[1]->Children()[0].get())->SetMaterial(hidden);
+
+    const auto serial = collect(scene.get(), nullptr);
+    ASSERT_GE(serial.opaque.size(), vglx::RenderLists::kParallelThreshold);
+    EXPECT_EQ(std::ranges::count(serial.opaque, parents[0]->Children()[0].get()), 0);
+
+    for (auto workers : {1u, 3u, 7u}) {
+        auto jobs = vglx::JobSystem {workers};
+        EXPECT_EQ(collect(scene.get(), &jobs), serial) << "workers " << workers;
+    }
+}
+
+TEST(RenderListsTest, ParallelCollectionSkipsChildrenOfCulledParents) {
+    auto scene = make_nested_scene({4, 8, 8, 32});
+
+    // The parent is behind the camera while its children are in front.
+    auto parent = scene->Children()[0].get();
+    parent->transform.SetPosition({0.0f, 0.0f, 10.0f});
+    for (const auto& child : parent->Children()) {
+        child->TranslateZ(-10.0f);
+    }
+    scene->UpdateTransformHierarchy();
+
+    const auto serial = collect(scene.get(), nullptr);
+    ASSERT_GE(serial.opaque.size(), vglx::RenderLists::kParallelThreshold);
+    EXPECT_EQ(std::ranges::count(serial.opaque, parent->Children()[0].get()), 0);
+
+    for (auto workers : {1u, 3u, 7u}) {
+        auto jobs = vglx::JobSystem {workers};
+        EXPECT_EQ(collect(scene.get(), &jobs), serial) << "workers " << workers;
+    }
+}
+
+#pragma endregion
+#pragma region Sorting
+
+TEST(RenderListsTest, SortsByRenderTransform) {
+    auto scene = vglx::Scene::Create();
+    auto geometry = vglx::BoxGeometry::Create();
+    auto material = vglx::UnlitMaterial::Create(0xFFFFFF);
+    auto near = vglx::Mesh::Create(geometry, material);
+    auto far = vglx::Mesh::Create(geometry, material);
+    near->transform.SetPosition({0.0f, 0.0f, -5.0f});
+    far->transform.SetPosition({0.0f, 0.0f, -10.0f});
+    scene->Add(far);
+    scene->Add(near);
+    scene->UpdateTransformHierarchy();
+
+    // The simulation moved the near mesh behind the far one, but the frame
+    // is still drawn at the previous state.
+    scene->StoreTransformHistory();
+    near->transform.SetPosition({0.0f, 0.0f, -20.0f});
+    scene->UpdateTransformHierarchy();
+    scene->InterpolateTransformHierarchy(0.0f);
+
+    auto camera = make_camera();
+    auto render_lists = vglx::RenderLists {};
+    render_lists.ProcessScene(scene.get(), camera.get());
+
+    const auto opaque = render_lists.Opaque();
+    ASSERT_EQ(opaque.size(), 2);
+    EXPECT_EQ(opaque[0], near.get());
+    EXPECT_EQ(opaque[1], far.get());
+}
+
+#pragma endregion
@@ -0,0 +1,131 @@
+/*
+===========================================================================
+  VGLX https://vglx.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#include <gtest/gtest.h>
+
+#include <vglx/utilities/stats.hpp>
+
+#include "utilities/data_series.hpp"
+
+#pragma region Helpers
+
+namespace {
+
+auto record(vglx::Stats& stats, double cull_ms, uint64_t draw_calls) {
+    auto profile = vglx::FrameProfile {};
+    profile[vglx::ProfilePhase::Cull] = cull_ms;
+    profile[vglx::ProfileCounter::DrawCalls] = draw_calls;
+    stats.BeforeRender();
+    stats.AfterRender(0, profile);
+}
+
+}
+
+#pragma endregion
+
+#pragma region Data Series
+
+TEST(DataSeries, KeepsMostRecentValuesInOrder) {
+    auto series = DataSeries<int, 4> {};
+    for (auto i = 1; i <= 6; ++i) series.Push(i);
+
+    EXPECT_EQ(series.Size(), 4);
+    EXPECT_EQ(series.At(0), 3);
+    EXPECT_EQ(series.At(3), 6);
+    EXPECT_EQ(series.LastValue(), 6);
+    EXPECT_EQ(series.Average(), (3 + 4 + 5 + 6) / 4);
+}
+
+TEST(DataSeries, OffsetPointsToOldestValue) {
+    auto series = DataSeries<int, 3> {};
+    series.Push(1);
+    series.Push(2);
+
+    EXPECT_EQ(series.Offset(), 0);
+
+    series.Push(3);
+    series.Push(4);
+
+    EXPECT_EQ(series.Buffer()[series.Offset()], 2);
+}
+
+#pragma endregion
+
+#pragma region Queries
+
+TEST(Stats, EmptyHistorySummarizesToZero) {
+    auto stats = vglx::Stats {};
+    const auto summary = stats.Query(vglx::ProfilePhase::Cull);
+
+    EXPECT_EQ(summary.frames, 0);
+    EXPECT_DOUBLE_EQ(summary.avg, 0.0);
+}
+
+TEST(Stats, QueriesPhaseOverWindow) {
+    auto stats = vglx::Stats {};
+    for (auto i = 1; i <= 100; ++i) record(stats, i, 0);
+
+    const auto all = stats.Query(vglx::ProfilePhase::Cull);
+    EXPECT_EQ(all.frames, 100);
+    EXPECT_DOUBLE_EQ(all.min, 1.0);
+    EXPECT_DOUBLE_EQ(all.avg, 50.5);
+    EXPECT_DOUBLE_EQ(all.p99, 99.0);
+
+    const auto recent = stats.Query(vglx::ProfilePhase::Cull, 10);
+    EXPECT_EQ(recent.frames, 10);
+    EXPECT_DOUBLE_EQ(recent.min, 91.0);
+    EXPECT_DOUBLE_EQ(recent.p99, 100.0);
+}
+
+TEST(Stats, QueriesCounters) {
+    auto stats = vglx::Stats {};
+    record(stats, 0.0, 4);
+    record(stats, 0.0, 8);
+
+    const auto summary = stats.Query(vglx::ProfileCounter::DrawCalls);
+    EXPECT_DOUBLE_EQ(summary.min, 4.0);
+    EXPECT_DOUBLE_EQ(summary.avg, 6.0);
+    EXPECT_EQ(stats.LastProfile()[vglx::ProfileCounter::DrawCalls], 8);
+}
+
+TEST(Stats, HistoryIsBounded) {
+    auto stats = vglx::Stats {};
+    for (auto i = 0; i < static_cast<int>(vglx::Stats::kHistorySize) + 50; ++i) {
+        record(stats, i, 0);
+    }
+
+    const auto summary = stats.Query(vglx::ProfilePhase::Cull, vglx::Stats::kHistorySize * 2);
+    EXPECT_EQ(summary.frames, vglx::Stats::kHistorySize);
+    EXPECT_DOUBLE_EQ(summary.min, 50.0);
+}
+
+TEST(Stats, RecordsOnlyTimedGpuFrames) {
+    auto stats = vglx::Stats {};
+    record(stats, 0.0, 0);
+
+    auto profile = vglx::FrameProfile {};
+    profile[vglx::GpuPass::Opaque] = 2.0;
+    profile.gpu_latency = 2;
+    stats.BeforeRender();
+    stats.AfterRender(0, profile);
+
+    const auto summary = stats.Query(vglx::GpuPass::Opaque);
+    EXPECT_EQ(summary.frames, 1);
+    EXPECT_DOUBLE_EQ(summary.avg, 2.0);
+    EXPECT_EQ(stats.Query(vglx::ProfilePhase::Cull).frames, 2);
+}
+
+TEST(Stats, RecordsFrameTime) {
+    auto stats = vglx::Stats {};
+    record(stats, 0.0, 0);
+
+    const auto summary = stats.FrameTime();
+    EXPECT_EQ(summary.frames, 1);
+    EXPECT_GE(summary.min, 0.0);
+}
+
+#pragma endregion
\ No newline at end of file
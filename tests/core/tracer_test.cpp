@@ -0,0 +1,149 @@
+/*
+===========================================================================
+  VGLX https://vglx.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <vglx/utilities/tracer.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <thread>
+
+using ::testing::HasSubstr;
+using ::testing::Not;
+
+#pragma region Recording
+
+TEST(Tracer, RecordsZonesOnlyWhileRecording) {
+    vglx::Tracer::Start();
+    vglx::Tracer::Stop();
+    {
+        auto zone = vglx::TraceZone {"Ignored"};
+    }
+
+    vglx::Tracer::Start();
+    {
+        auto zone = vglx::TraceZone {"Recorded"};
+    }
+    vglx::Tracer::Stop();
+
+    const auto json = vglx::Tracer::ToJson();
+    EXPECT_THAT(json, HasSubstr("\"name\":\"Recorded\",\"ph\":\"X\""));
+    EXPECT_THAT(json, Not(HasSubstr("Ignored")));
+}
+
+TEST(Tracer, StartDiscardsPreviousZones) {
+    vglx::Tracer::Start();
+    {
+        auto zone = vglx::TraceZone {"First"};
+    }
+    vglx::Tracer::Start();
+    vglx::Tracer::Stop();
+
+    EXPECT_THAT(vglx::Tracer::ToJson(), Not(HasSubstr("First")));
+}
+
+TEST(Tracer, KeepsMostRecentZonesPerThread) {
+    vglx::Tracer::Start();
+    {
+        auto zone = vglx::TraceZone {"Oldest"};
+    }
+    for (auto i = size_t {0}; i < vglx::Tracer::kMaxEventsPerThread; ++i) {
+        auto zone = vglx::TraceZone {"Newest"};
+    }
+    vglx::Tracer::Stop();
+
+    const auto json = vglx::Tracer::ToJson();
+    EXPECT_THAT(json, HasSubstr("Newest"));
+    EXPECT_THAT(json, Not(HasSubstr("Oldest")));
+}
+
+TEST(Tracer, FiltersByFrameRange) {
+    vglx::Tracer::Start();
+    const auto first = vglx::Tracer::CurrentFrame();
+    {
+        auto zone = vglx::TraceZone {"FrameA"};
+    }
+    vglx::Tracer::NextFrame();
+    {
+        auto zone = vglx::TraceZone {"FrameB"};
+    }
+    vglx::Tracer::Stop();
+
+    const auto json = vglx::Tracer::ToJson(first + 1, first + 1);
+    EXPECT_THAT(json, HasSubstr("FrameB"));
+    EXPECT_THAT(json, Not(HasSubstr("FrameA")));
+}
+
+TEST(Tracer, SeparatesThreads) {
+    vglx::Tracer::Start();
+    std::thread([] {
+        vglx::Tracer::SetThreadName("Loader \"1\"");
+        auto zone = vglx::TraceZone {"Background"};
+    }).join();
+    {
+        auto zone = vglx::TraceZone {"Foreground"};
+    }
+    vglx::Tracer::Stop();
+
+    const auto json = vglx::Tracer::ToJson();
+    EXPECT_THAT(json, HasSubstr("\"name\":\"thread_name\""));
+    EXPECT_THAT(json, HasSubstr("Loader \\\"1\\\""));
+
+    const auto tid = [&json](const std::string& name) {
+        const auto event = json.find("\"name\":\"" + name + "\"");
+        const auto start = json.find("\"tid\":", event) + 6;
+        return json.substr(start, json.find(',', start) - start);
+    };
+    EXPECT_NE(tid("Background"), tid("Foreground"));
+}
+
+#ifdef VGLX_TRACING
+TEST(Tracer, MacroRecordsZone) {
+    vglx::Tracer::Start();
+    {
+        VGLX_TRACE_ZONE("MacroZone");
+    }
+    vglx::Tracer::Stop();
+
+    EXPECT_THAT(vglx::Tracer::ToJson(), HasSubstr("MacroZone"));
+}
+#endif
+
+#pragma endregion
+
+#pragma region Export
+
+TEST(Tracer, ExportWritesChromeTraceFile) {
+    const auto path = std::filesystem::temp_directory_path() / "vglx_tracer_test.json";
+
+    vglx::Tracer::Start();
+    {
+        auto zone = vglx::TraceZone {"Exported"};
+    }
+    vglx::Tracer::Stop();
+
+    ASSERT_TRUE(vglx::Tracer::Export(path));
+
+    auto file = std::ifstream {path};
+    const auto contents = std::string {std::istreambuf_iterator<char> {file}, {}};
+    EXPECT_THAT(contents, ::testing::StartsWith("{\"displayTimeUnit\":\"ms\",\"traceEvents\":["));
+    EXPECT_THAT(contents, HasSubstr("Exported"));
+    EXPECT_THAT(contents, ::testing::EndsWith("]}"));
+
+    std::filesystem::remove(path);
+}
+
+TEST(Tracer, ExportFailsForInvalidPath) {
+    const auto result = vglx::Tracer::Export("/nonexistent/directory/trace.json");
+    EXPECT_FALSE(result);
+}
+
+#pragma endregion
\ No newline at end of file
@@ -0,0 +1,109 @@
+/*
+===========================================================================
+  VGLX https://vglx.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#include <gtest/gtest.h>
+
+#include "core/visibility_history.hpp"
+
+#include <cstdint>
+
+namespace {
+
+// Runs `frames` frames, issuing and immediately resolving every query the
+// history asks for, and returns how many were issued.
+auto run_frames(vglx::VisibilityHistory& history, uint64_t object, bool visible, uint32_t frames) {
+    auto queries = 0;
+    for (auto frame = uint32_t {0}; frame < frames; ++frame) {
+        history.BeginFrame();
+        if (!history.NeedsQuery(object)) continue;
+        history.QueryIssued(object);
+        history.Resolve(object, visible);
+        ++queries;
+    }
+    return queries;
+}
+
+}
+
+#pragma region Visibility
+
+TEST(VisibilityHistoryTest, NewObjectsAreVisibleAndQueried) {
+    auto history = vglx::VisibilityHistory {};
+    history.BeginFrame();
+
+    EXPECT_FALSE(history.IsHidden(7));
+    EXPECT_TRUE(history.NeedsQuery(7));
+}
+
+TEST(VisibilityHistoryTest, KeepsStateUntilResolved) {
+    auto history = vglx::VisibilityHistory {};
+    history.BeginFrame();
+    history.QueryIssued(7);
+    history.BeginFrame();
+
+    EXPECT_FALSE(history.IsHidden(7));
+    EXPECT_FALSE(history.NeedsQuery(7));
+
+    history.Resolve(7, false);
+    EXPECT_TRUE(history.IsHidden(7));
+}
+
+TEST(VisibilityHistoryTest, ResolvingUnknownObjectsIsIgnored) {
+    auto history = vglx::VisibilityHistory {};
+    history.Resolve(7, false);
+
+    EXPECT_FALSE(history.IsHidden(7));
+    EXPECT_EQ(history.Size(), 0);
+}
+
+#pragma endregion
+
+#pragma region Query Scheduling
+
+TEST(VisibilityHistoryTest, QueriesHiddenObjectsEveryFrame) {
+    auto history = vglx::VisibilityHistory {};
+
+    EXPECT_EQ(run_frames(history, 7, false, 10), 10);
+}
+
+TEST(VisibilityHistoryTest, QueriesVisibleObjectsOncePerInterval) {
+    constexpr auto interval = vglx::VisibilityHistory::kVisibleInterval;
+    auto history = vglx::VisibilityHistory {};
+    run_frames(history, 7, true, 1);
+
+    EXPECT_EQ(run_frames(history, 7, true, interval * 4), 4);
+}
+
+TEST(VisibilityHistoryTest, StaggersVisibleQueriesByObject) {
+    auto history = vglx::VisibilityHistory {};
+    for (auto object = uint64_t {1}; object <= vglx::VisibilityHistory::kVisibleInterval; ++object) {
+        history.QueryIssued(object);
+        history.Resolve(object, true);
+    }
+    history.BeginFrame();
+
+    auto due = 0;
+    for (auto object = uint64_t {1}; object <= vglx::VisibilityHistory::kVisibleInterval; ++object) {
+        due += history.NeedsQuery(object);
+    }
+    EXPECT_EQ(due, 1);
+}
+
+TEST(VisibilityHistoryTest, ForgetsObjectsWithoutQueries) {
+    auto history = vglx::VisibilityHistory {};
+    run_frames(history, 7, false, 1);
+    ASSERT_TRUE(history.IsHidden(7));
+
+    for (auto frame = uint32_t {0}; frame <= vglx::VisibilityHistory::kExpiry; ++frame) {
+        history.BeginFrame();
+    }
+
+    EXPECT_FALSE(history.IsHidden(7));
+    EXPECT_EQ(history.Size(), 0);
+}
+
+#pragma endregion
\ No newline at end of file
@@ -339,4 +339,34 @@ TEST(Transform3, TranslateAfterRotation) {
     static_assert(m[3].z == 0.0f);
 }
 
+#pragma endregion
+
+#pragma region Interpolation
+
+TEST(Transform3, LerpComponents) {
+    auto a = vglx::Transform3 {};
+    auto b = vglx::Transform3 {};
+    b.SetPosition({2.0f, 4.0f, -2.0f});
+    b.SetScale({3.0f, 1.0f, 1.0f});
+    b.SetRotation({0.0f, vglx::math::pi_over_2, 0.0f});
+
+    const auto t = vglx::Lerp(a, b, 0.5f);
+
+    EXPECT_VEC3_EQ(t.position, {1.0f, 2.0f, -1.0f});
+    EXPECT_VEC3_EQ(t.scale, {2.0f, 1.0f, 1.0f});
+    EXPECT_NEAR(t.rotation.yaw, vglx::math::pi_over_4, 1e-5f);
+    EXPECT_TRUE(t.touched);
+}
+
+TEST(Transform3, LerpRotationAcrossPi) {
+    auto a = vglx::Transform3 {};
+    auto b = vglx::Transform3 {};
+    a.SetRotation({0.0f, 0.0f, 3.0f});
+    b.SetRotation({0.0f, 0.0f, -3.0f});
+
+    const auto t = vglx::Lerp(a, b, 0.5f);
+
+    EXPECT_NEAR(vglx::math::Fabs(t.rotation.roll), vglx::math::pi, 1e-5f);
+}
+
 #pragma endregion
\ No newline at end of file
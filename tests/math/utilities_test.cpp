@@ -237,6 +237,18 @@ TEST(MathUtilities, LerpOutOfRangeFactor) {
     EXPECT_FLOAT_EQ(math::Lerp(0.0f, 1.0f, 1.5f), 1.5f);
 }
 
+TEST(MathUtilities, LerpAngleShortestArc) {
+    EXPECT_NEAR(math::LerpAngle(0.0f, math::pi_over_2, 0.5f), math::pi_over_4, 1e-5f);
+    EXPECT_NEAR(math::LerpAngle(math::pi_over_2, 0.0f, 0.5f), math::pi_over_4, 1e-5f);
+    EXPECT_NEAR(math::LerpAngle(3.0f, -3.0f, 0.5f), math::pi, 1e-5f);
+    EXPECT_NEAR(math::LerpAngle(-3.0f, 3.0f, 0.5f), -math::pi, 1e-5f);
+}
+
+TEST(MathUtilities, LerpAngleWrappedEndpoints) {
+    EXPECT_NEAR(math::LerpAngle(0.0f, math::two_pi, 1.0f), 0.0f, 1e-5f);
+    EXPECT_NEAR(math::LerpAngle(0.1f, 0.1f + math::two_pi * 2.0f, 0.5f), 0.1f, 1e-5f);
+}
+
 #pragma endregion
 
 #pragma region Atan
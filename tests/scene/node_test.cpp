@@ -11,6 +11,24 @@
 #include <vglx/cameras/perspective_camera.hpp>
 #include <vglx/nodes/mesh.hpp>
 #include <vglx/nodes/node.hpp>
+#include <vglx/nodes/scene.hpp>
+
+namespace {
+
+class AttachCounter : public vglx::Node {
+public:
+    int attached_calls {0};
+
+    auto OnAttached(vglx::SharedContextPointer) -> void override {
+        ++attached_calls;
+    }
+
+    static auto Create() {
+        return std::make_shared<AttachCounter>();
+    }
+};
+
+}
 
 #pragma region Node Operations
 
@@ -86,6 +104,71 @@ TEST(Node, IsChildWithNullptr) {
     EXPECT_FALSE(node->IsChild(nullptr));
 }
 
+TEST(Node, IsChildDeepHierarchy) {
+    auto root = vglx::Node::Create();
+    auto sibling = vglx::Node::Create();
+    root->Add(sibling);
+
+    auto current = root;
+    for (auto i = 0; i < 64; ++i) {
+        auto child = vglx::Node::Create();
+        current->Add(child);
+        current = child;
+    }
+
+    EXPECT_TRUE(root->IsChild(current.get()));
+    EXPECT_FALSE(sibling->IsChild(current.get()));
+    EXPECT_FALSE(current->IsChild(root.get()));
+}
+
+TEST(Node, Depth) {
+    auto node_1 = vglx::Node::Create();
+    auto node_2 = vglx::Node::Create();
+    auto node_3 = vglx::Node::Create();
+
+    node_2->Add(node_3);
+    EXPECT_EQ(node_3->Depth(), 1);
+
+    node_1->Add(node_2);
+    EXPECT_EQ(node_1->Depth(), 0);
+    EXPECT_EQ(node_2->Depth(), 1);
+    EXPECT_EQ(node_3->Depth(), 2);
+
+    node_1->Remove(node_2);
+    EXPECT_EQ(node_2->Depth(), 0);
+    EXPECT_EQ(node_3->Depth(), 1);
+}
+
+TEST(Node, GetScene) {
+    auto scene = vglx::Scene::Create();
+    auto parent = vglx::Node::Create();
+    auto child = vglx::Node::Create();
+
+    parent->Add(child);
+    EXPECT_EQ(child->GetScene(), nullptr);
+
+    scene->Add(parent);
+    EXPECT_EQ(scene->GetScene(), scene.get());
+    EXPECT_EQ(parent->GetScene(), scene.get());
+    EXPECT_EQ(child->GetScene(), scene.get());
+
+    scene->Remove(parent);
+    EXPECT_EQ(parent->GetScene(), nullptr);
+    EXPECT_EQ(child->GetScene(), nullptr);
+}
+
+TEST(Node, GetSceneAfterReparenting) {
+    auto scene_1 = vglx::Scene::Create();
+    auto scene_2 = vglx::Scene::Create();
+    auto node = AttachCounter::Create();
+
+    scene_1->Add(node);
+    scene_2->Add(node);
+
+    EXPECT_EQ(node->GetScene(), scene_2.get());
+    EXPECT_EQ(node->attached_calls, 2);
+}
+
 #pragma endregion
 
 #pragma region Update Transforms
@@ -169,6 +252,71 @@ TEST(Node, MarkDetachedNodesAsTouched) {
 
 #pragma endregion
 
+#pragma region Transform Interpolation
+
+TEST(Node, InterpolateWithoutHistoryUsesCurrentTransform) {
+    auto node = vglx::Node::Create();
+    node->transform.SetPosition({2.0f, 0.0f, 0.0f});
+
+    node->InterpolateTransformHierarchy(0.5f);
+
+    EXPECT_TRUE(node->IsInterpolated());
+    EXPECT_MAT4_EQ(node->GetRenderTransform(), node->GetWorldTransform());
+}
+
+TEST(Node, InterpolateBetweenSimulationStates) {
+    auto parent = vglx::Node::Create();
+    auto child = vglx::Node::Create();
+    parent->Add(child);
+    parent->SetScale(2.0f);
+
+    parent->StoreTransformHistory();
+    child->transform.SetPosition({4.0f, 0.0f, 0.0f});
+
+    parent->InterpolateTransformHierarchy(0.25f);
+
+    EXPECT_MAT4_EQ(child->GetRenderTransform(), {
+        2.0f, 0.0f, 0.0f, 2.0f,
+        0.0f, 2.0f, 0.0f, 0.0f,
+        0.0f, 0.0f, 2.0f, 0.0f,
+        0.0f, 0.0f, 0.0f, 1.0f
+    });
+
+    // The simulated transform is unaffected by interpolation.
+    parent->UpdateTransformHierarchy();
+    EXPECT_MAT4_EQ(child->GetWorldTransform(), {
+        2.0f, 0.0f, 0.0f, 8.0f,
+        0.0f, 2.0f, 0.0f, 0.0f,
+        0.0f, 0.0f, 2.0f, 0.0f,
+        0.0f, 0.0f, 0.0f, 1.0f
+    });
+}
+
+TEST(Node, RenderTransformDefaultsToWorldTransform) {
+    auto node = vglx::Node::Create();
+    node->SetScale(3.0f);
+
+    EXPECT_FALSE(node->IsInterpolated());
+    EXPECT_MAT4_EQ(node->GetRenderTransform(), node->GetWorldTransform());
+}
+
+TEST(Node, RemovingNodeDiscardsInterpolation) {
+    auto scene = vglx::Scene::Create();
+    auto node = vglx::Node::Create();
+    scene->Add(node);
+
+    scene->StoreTransformHistory();
+    node->transform.SetPosition({1.0f, 0.0f, 0.0f});
+    scene->InterpolateTransformHierarchy(0.5f);
+    EXPECT_TRUE(node->IsInterpolated());
+
+    scene->Remove(node);
+    EXPECT_FALSE(node->IsInterpolated());
+    EXPECT_VEC3_EQ(node->GetWorldPosition(), {1.0f, 0.0f, 0.0f});
+}
+
+#pragma endregion
+
 #pragma region ShouldUpdate Checks
 
 TEST(Node, ShouldUpdateTransformWhenDirty) {
@@ -180,6 +328,83 @@ TEST(Node, ShouldUpdateTransformWhenDirty) {
 
 #pragma endregion
 
+#pragma region Batched Changes
+
+TEST(Node, AttachToSceneWithoutBatch) {
+    auto scene = vglx::Scene::Create();
+    auto node = AttachCounter::Create();
+
+    scene->Add(node);
+
+    EXPECT_EQ(node->attached_calls, 1);
+}
+
+TEST(Node, BatchDefersAttachUntilCommit) {
+    auto scene = vglx::Scene::Create();
+    auto node = AttachCounter::Create();
+
+    vglx::Node::BeginBatch();
+    scene->Add(node);
+    EXPECT_EQ(node->attached_calls, 0);
+    vglx::Node::CommitBatch();
+
+    EXPECT_EQ(node->attached_calls, 1);
+}
+
+TEST(Node, BatchAttachesNestedNodesOnce) {
+    auto scene = vglx::Scene::Create();
+    auto parent = AttachCounter::Create();
+    auto child = AttachCounter::Create();
+
+    vglx::Node::BeginBatch();
+    scene->Add(parent);
+    parent->Add(child);
+    vglx::Node::CommitBatch();
+
+    EXPECT_EQ(parent->attached_calls, 1);
+    EXPECT_EQ(child->attached_calls, 1);
+}
+
+TEST(Node, BatchSkipsNodesRemovedBeforeCommit) {
+    auto scene = vglx::Scene::Create();
+    auto node = AttachCounter::Create();
+
+    vglx::Node::BeginBatch();
+    scene->Add(node);
+    scene->Remove(node);
+    vglx::Node::CommitBatch();
+
+    EXPECT_EQ(node->attached_calls, 0);
+}
+
+TEST(Node, NestedBatchesCommitOnOutermost) {
+    auto scene = vglx::Scene::Create();
+    auto node = AttachCounter::Create();
+
+    vglx::Node::BeginBatch();
+    vglx::Node::BeginBatch();
+    scene->Add(node);
+    vglx::Node::CommitBatch();
+    EXPECT_EQ(node->attached_calls, 0);
+    vglx::Node::CommitBatch();
+
+    EXPECT_EQ(node->attached_calls, 1);
+}
+
+TEST(Node, BatchIgnoresNodesOutsideScene) {
+    auto scene = vglx::Scene::Create();
+    auto parent = vglx::Node::Create();
+    auto node = AttachCounter::Create();
+
+    vglx::Node::BeginBatch();
+    parent->Add(node);
+    vglx::Node::CommitBatch();
+
+    EXPECT_EQ(node->attached_calls, 0);
+}
+
+#pragma endregion
+
 #pragma region Edge Cases
 
 TEST(Node, AddChildWithExistingParent) {
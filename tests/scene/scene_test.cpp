@@ -0,0 +1,249 @@
+/*
+===========================================================================
+  VGLX https://vglx.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#include <gtest/gtest.h>
+
+#include <vglx/core/shared_context.hpp>
+#include <vglx/lights/point_light.hpp>
+#include <vglx/nodes/node.hpp>
+#include <vglx/nodes/scene.hpp>
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace {
+
+class UpdateCounter : public vglx::Node {
+public:
+    int update_calls {0};
+
+    std::function<void()> on_update;
+
+    auto OnUpdate(float delta) -> void override {
+        ++update_calls;
+        if (on_update) on_update();
+    }
+
+    static auto Create() {
+        return std::make_shared<UpdateCounter>();
+    }
+};
+
+}
+
+#pragma region Update Registry
+
+TEST(Scene, AdvanceUpdatesNestedNodes) {
+    auto scene = vglx::Scene::Create();
+    auto parent = UpdateCounter::Create();
+    auto child = UpdateCounter::Create();
+
+    parent->Add(child);
+    scene->Add(parent);
+    scene->Advance(0.016f);
+    scene->Advance(0.016f);
+
+    EXPECT_EQ(parent->update_calls, 2);
+    EXPECT_EQ(child->update_calls, 2);
+}
+
+TEST(Scene, AdvanceKeepsEnabledOverridesThatCallTheBase) {
+    class Derived : public UpdateCounter {
+    public:
+        Derived() { SetUpdateEnabled(true); }
+
+        auto OnUpdate(float delta) -> void override {
+            vglx::Node::OnUpdate(delta);
+            UpdateCounter::OnUpdate(delta);
+        }
+    };
+
+    auto scene = vglx::Scene::Create();
+    auto node = std::make_shared<Derived>();
+
+    scene->Add(node);
+    for (auto i = 0; i < 3; ++i) scene->Advance(0.016f);
+
+    EXPECT_EQ(node->update_calls, 3);
+}
+
+TEST(Scene, AdvanceSkipsNodesWithoutUpdates) {
+    auto scene = vglx::Scene::Create();
+    auto node = UpdateCounter::Create();
+    node->SetUpdateEnabled(false);
+
+    scene->Add(node);
+    scene->Advance(0.016f);
+    EXPECT_EQ(node->update_calls, 0);
+
+    node->SetUpdateEnabled(true);
+    scene->Advance(0.016f);
+    EXPECT_EQ(node->update_calls, 1);
+
+    node->SetUpdateEnabled(false);
+    scene->Advance(0.016f);
+    EXPECT_EQ(node->update_calls, 1);
+}
+
+TEST(Scene, AdvanceDropsNodesWithoutUpdateLogic) {
+    class Plain : public vglx::Node {};
+
+    auto scene = vglx::Scene::Create();
+    auto plain = vglx::Node::Create();
+    auto derived = std::make_shared<Plain>();
+    auto pinned = vglx::Node::Create();
+    pinned->SetUpdateEnabled(true);
+
+    scene->Add(plain);
+    scene->Add(derived);
+    scene->Add(pinned);
+    EXPECT_TRUE(plain->IsUpdateEnabled());
+
+    scene->Advance(0.016f);
+    EXPECT_FALSE(plain->IsUpdateEnabled());
+    EXPECT_FALSE(derived->IsUpdateEnabled());
+    EXPECT_TRUE(pinned->IsUpdateEnabled());
+}
+
+TEST(Scene, AdvanceUpdatesLightsOnlyInDebugMode) {
+    auto scene = vglx::Scene::Create();
+    auto light = vglx::PointLight::Create({
+        .color = 0xFFFFFF,
+        .intensity = 1.0f,
+        .attenuation = {}
+    });
+
+    scene->Add(light);
+    scene->Advance(0.016f);
+    EXPECT_FALSE(light->IsUpdateEnabled());
+
+    light->SetDebugMode(true);
+    EXPECT_TRUE(light->IsUpdateEnabled());
+
+    light->SetDebugMode(false);
+    EXPECT_FALSE(light->IsUpdateEnabled());
+}
+
+TEST(Scene, AdvanceSkipsRemovedNodes) {
+    auto scene = vglx::Scene::Create();
+    auto node = UpdateCounter::Create();
+
+    scene->Add(node);
+    scene->Advance(0.016f);
+    scene->Remove(node);
+    scene->Advance(0.016f);
+
+    EXPECT_EQ(node->update_calls, 1);
+}
+
+TEST(Scene, AdvanceUpdatesNodesUnderPlainParents) {
+    auto scene = vglx::Scene::Create();
+    auto parent = vglx::Node::Create();
+    auto child = UpdateCounter::Create();
+
+    parent->Add(child);
+    scene->Add(parent);
+    scene->Advance(0.016f);
+    scene->Advance(0.016f);
+
+    EXPECT_EQ(child->update_calls, 2);
+}
+
+TEST(Scene, NodesAddedDuringAdvanceUpdateNextFrame) {
+    auto scene = vglx::Scene::Create();
+    auto spawner = UpdateCounter::Create();
+    auto spawned = UpdateCounter::Create();
+
+    spawner->on_update = [&] {
+        if (spawned->Parent() == nullptr) scene->Add(spawned);
+    };
+
+    scene->Add(spawner);
+    scene->Advance(0.016f);
+    EXPECT_EQ(spawned->update_calls, 0);
+
+    scene->Advance(0.016f);
+    EXPECT_EQ(spawned->update_calls, 1);
+}
+
+TEST(Scene, NodeCanRemoveItselfDuringAdvance) {
+    auto scene = vglx::Scene::Create();
+    auto node = UpdateCounter::Create();
+    auto weak = std::weak_ptr<UpdateCounter> {node};
+
+    node->on_update = [&scene, weak] {
+        if (auto self = weak.lock()) scene->Remove(self);
+    };
+
+    scene->Add(node);
+    node.reset();
+    scene->Advance(0.016f);
+
+    EXPECT_TRUE(weak.expired());
+    EXPECT_TRUE(scene->Children().empty());
+}
+
+TEST(Scene, AdvanceUpdatesThreadSafeNodes) {
+    auto context = vglx::SharedContext {};
+    context.jobs = vglx::JobSystem::Create(4);
+
+    auto scene = vglx::Scene::Create();
+    scene->SetContext(&context);
+    auto nodes = std::vector<std::shared_ptr<UpdateCounter>> {};
+    for (auto i = 0; i < 2048; ++i) {
+        auto node = UpdateCounter::Create();
+        node->update_thread_safe = true;
+        scene->Add(node);
+        nodes.emplace_back(node);
+    }
+
+    scene->Advance(0.016f);
+    scene->Advance(0.016f);
+
+    for (const auto& node : nodes) {
+        EXPECT_EQ(node->update_calls, 2);
+    }
+}
+
+TEST(Scene, AdvanceSkipsThreadSafeNodesRemovedDuringUpdate) {
+    auto scene = vglx::Scene::Create();
+    auto remover = UpdateCounter::Create();
+    auto removed = UpdateCounter::Create();
+    auto disabled = UpdateCounter::Create();
+    removed->update_thread_safe = true;
+    disabled->update_thread_safe = true;
+
+    remover->on_update = [&] {
+        scene->Remove(removed);
+        disabled->SetUpdateEnabled(false);
+    };
+
+    scene->Add(removed);
+    scene->Add(disabled);
+    scene->Add(remover);
+    scene->Advance(0.016f);
+
+    EXPECT_EQ(remover->update_calls, 1);
+    EXPECT_EQ(removed->update_calls, 0);
+    EXPECT_EQ(disabled->update_calls, 0);
+}
+
+TEST(Scene, NodesOutliveScene) {
+    auto node = UpdateCounter::Create();
+    {
+        auto scene = vglx::Scene::Create();
+        scene->Add(node);
+        EXPECT_EQ(node->GetScene(), scene.get());
+    }
+
+    EXPECT_EQ(node->GetScene(), nullptr);
+    EXPECT_EQ(node->Parent(), nullptr);
+    EXPECT_EQ(node->Depth(), 0);
+}
+
+#pragma endregion
\ No newline at end of file
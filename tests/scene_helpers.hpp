@@ -0,0 +1,96 @@
+/*
+===========================================================================
+  VGLX https://vglx.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#pragma once
+
+#include <vglx/cameras/perspective_camera.hpp>
+#include <vglx/core/renderer.hpp>
+#include <vglx/geometries/box_geometry.hpp>
+#include <vglx/materials/unlit_material.hpp>
+#include <vglx/math/utilities.hpp>
+#include <vglx/nodes/mesh.hpp>
+#include <vglx/nodes/node.hpp>
+#include <vglx/nodes/scene.hpp>
+
+#include <cmath>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <vector>
+
+// Scene, camera and renderer fixtures shared by the tests and benchmarks.
+
+// Parameters of a small null backend renderer. Tests that need other
+// options set them on the result before creating the renderer.
+inline auto null_renderer_parameters(int width = 64, int height = 32) {
+    return vglx::Renderer::Parameters {
+        .framebuffer_width = width,
+        .framebuffer_height = height,
+        .clear_color = 0x000000,
+        .backend = vglx::Renderer::Backend::Null
+    };
+}
+
+inline auto make_null_renderer(const vglx::Renderer::Parameters& params = null_renderer_parameters()) {
+    return std::make_unique<vglx::Renderer>(params);
+}
+
+// Builds a scene of `count` leaf nodes scattered around a camera at the
+// origin that looks down -Z, so roughly a tenth of them fall inside its
+// frustum. With a non-zero `fanout`, the leaves are grouped under a tree of
+// plain nodes with at most `fanout` children each; otherwise they are direct
+// children of the scene. Leaves are meshes sharing a single geometry and
+// material, or plain nodes when `meshes` is false. The same arguments always
+// produce the same scene.
+inline auto make_scene(int64_t count, int64_t fanout = 0, bool meshes = true) {
+    auto scene = vglx::Scene::Create();
+    auto geometry = vglx::BoxGeometry::Create();
+    auto material = vglx::UnlitMaterial::Create(0xFFFFFF);
+    auto random = std::mt19937 {42};
+    const auto extent = 4.0f * std::cbrt(static_cast<float>(count));
+    auto position = std::uniform_real_distribution<float> {-extent, extent};
+
+    auto leaves = std::vector<std::shared_ptr<vglx::Node>> {};
+    leaves.reserve(count);
+    for (auto i = int64_t {0}; i < count; ++i) {
+        auto leaf = meshes
+            ? std::static_pointer_cast<vglx::Node>(vglx::Mesh::Create(geometry, material))
+            : vglx::Node::Create();
+        leaf->transform.SetPosition({position(random), position(random), position(random)});
+        leaves.emplace_back(std::move(leaf));
+    }
+
+    // Group the current level into parents until it fits under the scene.
+    auto level = std::move(leaves);
+    while (fanout > 0 && static_cast<int64_t>(level.size()) > fanout) {
+        auto parents = std::vector<std::shared_ptr<vglx::Node>> {};
+        parents.reserve(level.size() / fanout + 1);
+        for (auto i = size_t {0}; i < level.size(); ++i) {
+            if (i % fanout == 0) parents.emplace_back(vglx::Node::Create());
+            parents.back()->Add(level[i]);
+        }
+        level = std::move(parents);
+    }
+
+    vglx::Node::BeginBatch();
+    for (const auto& node : level) scene->Add(node);
+    vglx::Node::CommitBatch();
+
+    scene->UpdateTransformHierarchy();
+    return scene;
+}
+
+inline auto make_camera() {
+    auto camera = vglx::PerspectiveCamera::Create({
+        .fov = vglx::math::DegToRad(60.0f),
+        .aspect = 16.0f / 9.0f,
+        .near = 0.1f,
+        .far = 1000.0f
+    });
+    camera->UpdateViewMatrix();
+    return camera;
+}
\ No newline at end of file
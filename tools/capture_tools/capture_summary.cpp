@@ -0,0 +1,125 @@
+/*
+===========================================================================
+  VGLX https://vglx.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#include <vglx/vglx.hpp>
+
+#include <array>
+#include <cstdlib>
+#include <format>
+#include <iostream>
+#include <string_view>
+
+using namespace vglx;
+
+namespace {
+
+constexpr auto kDefaultListed = 20;
+constexpr auto kCommandTypes = static_cast<size_t>(RenderCommandType::Count);
+constexpr auto kRedundancyKinds = 3;
+
+auto get_name(Redundancy kind) -> std::string_view {
+    switch (kind) {
+        case Redundancy::Bind: return "bind";
+        case Redundancy::State: return "state";
+        case Redundancy::Upload: return "upload";
+        default: return "unknown";
+    }
+}
+
+struct Totals {
+    size_t count {0};
+    size_t bytes {0};
+};
+
+}
+
+// Prints the command mix of a render capture and the binds, state changes
+// and uploads that repeat the state already set on the GPU, followed by the
+// first redundant commands found.
+//
+// usage: capture_summary <capture file> [listed commands]
+auto main(int argc, char** argv) -> int {
+    if (argc < 2) {
+        std::cerr << "usage: capture_summary <capture file> [listed commands]\n";
+        return 1;
+    }
+    const auto listed = argc > 2 ? static_cast<size_t>(std::atoi(argv[2])) : kDefaultListed;
+
+    auto capture = RenderCapture::Load(argv[1]);
+    if (!capture) {
+        std::cerr << capture.error() << '\n';
+        return 1;
+    }
+
+    const auto frames = capture->Frames();
+    auto commands = std::array<Totals, kCommandTypes> {};
+    for (const auto& frame : frames) {
+        for (const auto& command : frame.Commands()) {
+            auto& totals = commands[static_cast<size_t>(command.type)];
+            ++totals.count;
+            totals.bytes += command.payload_size;
+        }
+    }
+
+    const auto redundant = FindRedundantCommands(frames);
+    auto redundant_totals = std::array<std::array<Totals, kCommandTypes>, kRedundancyKinds> {};
+    for (const auto& command : redundant) {
+        auto& totals = redundant_totals[static_cast<size_t>(command.kind)][static_cast<size_t>(command.type)];
+        ++totals.count;
+        totals.bytes += command.bytes;
+    }
+
+    std::cout << std::format("{} frames\n\n", frames.size());
+    std::cout << std::format("{:<24} {:>9} {:>12} {:>11}\n", "command", "count", "bytes", "redundant");
+    for (auto i = size_t {0}; i < kCommandTypes; ++i) {
+        if (commands[i].count == 0) continue;
+        auto redundant_count = size_t {0};
+        for (const auto& kind : redundant_totals) redundant_count += kind[i].count;
+        std::cout << std::format(
+            "{:<24} {:>9} {:>12} {:>11}\n",
+            GetName(static_cast<RenderCommandType>(i)),
+            commands[i].count,
+            commands[i].bytes,
+            redundant_count
+        );
+    }
+
+    std::cout << std::format("\n{:<8} {:<24} {:>9} {:>12}\n", "kind", "command", "count", "bytes");
+    for (auto kind = size_t {0}; kind < kRedundancyKinds; ++kind) {
+        for (auto i = size_t {0}; i < kCommandTypes; ++i) {
+            const auto& totals = redundant_totals[kind][i];
+            if (totals.count == 0) continue;
+            std::cout << std::format(
+                "{:<8} {:<24} {:>9} {:>12}\n",
+                get_name(static_cast<Redundancy>(kind)),
+                GetName(static_cast<RenderCommandType>(i)),
+                totals.count,
+                totals.bytes
+            );
+        }
+    }
+
+    std::cout << std::format("\n{} redundant commands", redundant.size());
+    std::cout << (redundant.empty() ? "\n" : std::format(", first {}:\n", std::min(listed, redundant.size())));
+    for (auto i = size_t {0}; i < std::min(listed, redundant.size()); ++i) {
+        const auto& command = redundant[i];
+        const auto& recorded = frames[command.frame].Commands()[command.index];
+        std::cout << std::format(
+            "  frame {} command {}: {} {} {} {} {} ({})\n",
+            command.frame,
+            command.index,
+            GetName(command.type),
+            recorded.args[0],
+            recorded.args[1],
+            recorded.args[2],
+            recorded.args[3],
+            get_name(command.kind)
+        );
+    }
+
+    return 0;
+}
\ No newline at end of file
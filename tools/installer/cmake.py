@@ -47,6 +47,7 @@ def cmake_configure(
         f"-DVGLX_BUILD_ASSET_BUILDER={'ON' if config.build_asset_builder else 'OFF'}",
         f"-DVGLX_BUILD_IMGUI={'ON' if config.build_imgui else 'OFF'}",
         "-DVGLX_BUILD_EXAMPLES=OFF",
+        "-DVGLX_BUILD_BENCHMARKS=OFF",
         "-DVGLX_BUILD_DOCS=OFF",
         "-DVGLX_BUILD_TESTS=OFF"
     ]